@@ -0,0 +1,269 @@
+// Measures the window bits and the parallel strategy of the CPU MSM for each
+// size and thread count on this machine, and writes the fastest ones to an
+// MSM profile. Set TACHYON_MSM_PROFILE to the written path so that
+// VariableBaseMSM picks them up. See tachyon/math/elliptic_curves/msm/
+// msm_profile.h for details.
+
+#include <stdint.h>
+
+#include <algorithm>
+#include <iostream>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include "absl/strings/substitute.h"
+
+#include "tachyon/base/console/iostream.h"
+#include "tachyon/base/files/file_path_flag.h"
+#include "tachyon/base/files/file_util.h"
+#include "tachyon/base/flag/flag_parser.h"
+#include "tachyon/base/logging.h"
+#include "tachyon/base/openmp_util.h"
+#include "tachyon/base/ranges/algorithm.h"
+#include "tachyon/base/time/time.h"
+#include "tachyon/math/elliptic_curves/bn/bn254/g1.h"
+#include "tachyon/math/elliptic_curves/bn/bn254/g2.h"
+#include "tachyon/math/elliptic_curves/msm/algorithms/pippenger/pippenger_adapter.h"
+#include "tachyon/math/elliptic_curves/msm/msm_ctx.h"
+#include "tachyon/math/elliptic_curves/msm/msm_profile.h"
+#include "tachyon/math/elliptic_curves/msm/test/variable_base_msm_test_set.h"
+
+namespace tachyon {
+namespace base {
+
+template <>
+class FlagValueTraits<math::PippengerParallelStrategy> {
+ public:
+  static bool ParseValue(std::string_view input,
+                         math::PippengerParallelStrategy* value,
+                         std::string* reason) {
+    return math::ParsePippengerParallelStrategy(input, value, reason);
+  }
+};
+
+}  // namespace base
+
+namespace {
+
+// The largest window bits to try. Beyond this, the buckets of a window no
+// longer fit in the cache for any size of interest.
+constexpr uint32_t kMaxWindowBits = 22;
+
+struct AutotunerConfig {
+  std::string curve;
+  std::vector<uint32_t> degrees;
+  std::vector<uint32_t> thread_counts;
+  std::vector<math::PippengerParallelStrategy> strategies;
+  uint32_t window_bits_range = 3;
+  uint32_t repeats = 3;
+  base::FilePath out;
+};
+
+void SetThreadCount(uint32_t thread_count) {
+#if defined(TACHYON_HAS_OPENMP)
+  omp_set_num_threads(static_cast<int>(thread_count));
+#endif  // defined(TACHYON_HAS_OPENMP)
+}
+
+uint32_t GetThreadCount() {
+#if defined(TACHYON_HAS_OPENMP)
+  return static_cast<uint32_t>(omp_get_max_threads());
+#else
+  return 1;
+#endif  // defined(TACHYON_HAS_OPENMP)
+}
+
+template <typename Point>
+class MSMAutotuner {
+ public:
+  using Bucket = typename math::PippengerAdapter<Point>::Bucket;
+
+  explicit MSMAutotuner(const AutotunerConfig& config) : config_(config) {}
+
+  void Run(math::MSMProfile* profile) {
+    std::cout << "Generating random points..." << std::endl;
+    uint64_t max_size = uint64_t{1} << config_.degrees.back();
+    test_set_ = math::VariableBaseMSMTestSet<Point>::Random(
+        max_size, math::VariableBaseMSMMethod::kNone);
+    std::cout << "Generation completed" << std::endl;
+
+    std::string curve = math::MSMProfile::GetCurveName<Point>();
+    for (uint32_t thread_count : config_.thread_counts) {
+      for (uint32_t degree : config_.degrees) {
+        profile->AddEntry(Tune(curve, degree, thread_count));
+      }
+    }
+    SetThreadCount(config_.thread_counts.back());
+  }
+
+ private:
+  math::MSMProfileEntry Tune(const std::string& curve, uint32_t degree,
+                             uint32_t thread_count) {
+    size_t size = size_t{1} << degree;
+    // The default window bits for |kParallelTerm| are computed from the size
+    // of a chunk, which is smaller than |size|.
+    uint32_t lo = math::MSMCtx::ComputeWindowsBits(
+        std::max(size / thread_count, size_t{1}));
+    uint32_t hi = math::MSMCtx::ComputeWindowsBits(size);
+    lo = lo > config_.window_bits_range + 2 ? lo - config_.window_bits_range
+                                            : 2;
+    hi = std::min(hi + config_.window_bits_range, kMaxWindowBits);
+
+    Bucket expected;
+    double default_time =
+        Measure(size, thread_count, 0,
+                math::PippengerParallelStrategy::kParallelTerm, &expected);
+
+    math::MSMProfileEntry best{curve, degree, thread_count, 0,
+                               math::PippengerParallelStrategy::kParallelTerm};
+    double best_time = std::numeric_limits<double>::max();
+    for (math::PippengerParallelStrategy strategy : config_.strategies) {
+      for (uint32_t window_bits = lo; window_bits <= hi; ++window_bits) {
+        Bucket result;
+        double time =
+            Measure(size, thread_count, window_bits, strategy, &result);
+        CHECK_EQ(result, expected)
+            << "Result not matched with window bits " << window_bits
+            << " and strategy "
+            << math::PippengerParallelStrategyToString(strategy);
+        if (time < best_time) {
+          best_time = time;
+          best.window_bits = window_bits;
+          best.strategy = strategy;
+        }
+      }
+    }
+
+    std::cout << absl::Substitute(
+                     "2^$0 with $1 threads: $2 bits, $3 ($4 s, $5x faster "
+                     "than the default)",
+                     degree, thread_count, best.window_bits,
+                     math::PippengerParallelStrategyToString(best.strategy),
+                     best_time, default_time / best_time)
+              << std::endl;
+    return best;
+  }
+
+  // Returns the fastest of |config_.repeats| runs in seconds.
+  double Measure(size_t size, uint32_t thread_count, uint32_t window_bits,
+                 math::PippengerParallelStrategy strategy, Bucket* result) {
+    double best_time = std::numeric_limits<double>::max();
+    for (uint32_t i = 0; i < config_.repeats; ++i) {
+      // NOTE: |kParallelWindowAndTerm| lowers the number of threads of
+      // OpenMP, so it is restored before every run.
+      SetThreadCount(thread_count);
+      math::PippengerAdapter<Point> pippenger;
+      pippenger.SetWindowBits(window_bits);
+      base::TimeTicks now = base::TimeTicks::Now();
+      CHECK(pippenger.RunWithStrategy(
+          test_set_.bases.begin(), test_set_.bases.begin() + size,
+          test_set_.scalars.begin(), test_set_.scalars.begin() + size,
+          strategy, result));
+      best_time =
+          std::min(best_time, (base::TimeTicks::Now() - now).InSecondsF());
+    }
+    return best_time;
+  }
+
+  const AutotunerConfig& config_;
+  math::VariableBaseMSMTestSet<Point> test_set_;
+};
+
+int RealMain(int argc, char** argv) {
+  AutotunerConfig config;
+  base::FlagParser parser;
+  parser
+      .AddFlag<base::StringChoicesFlag>(
+          &config.curve, std::vector<std::string>{"bn254_g1", "bn254_g2"})
+      .set_long_name("--curve")
+      .set_default_value("bn254_g1")
+      .set_help("Curve to be tuned. (supported curves: bn254_g1, bn254_g2)");
+  // clang-format off
+  parser.AddFlag<base::Flag<std::vector<uint32_t>>>(&config.degrees)
+      .set_short_name("-n")
+      .set_required()
+      .set_help("Specify the exponent 'n' where the number of points to tune is 2ⁿ.");
+  // clang-format on
+  parser.AddFlag<base::Flag<std::vector<uint32_t>>>(&config.thread_counts)
+      .set_long_name("--thread_count")
+      .set_help(
+          "Number of threads to be tuned with. By default, the number of "
+          "threads of OpenMP.");
+  parser
+      .AddFlag<base::Flag<std::vector<math::PippengerParallelStrategy>>>(
+          &config.strategies)
+      .set_long_name("--strategy")
+      .set_help(
+          "Parallel strategies to be tried. By default, all of them. "
+          "(supported strategies: none, parallel_window, parallel_term, "
+          "parallel_window_and_term, parallel_bucket)");
+  parser.AddFlag<base::Uint32Flag>(&config.window_bits_range)
+      .set_long_name("--window_bits_range")
+      .set_default_value(3)
+      .set_help(
+          "How far from the default window bits to try. By default, 3.");
+  parser.AddFlag<base::Uint32Flag>(&config.repeats)
+      .set_long_name("--repeats")
+      .set_default_value(3)
+      .set_help("Number of runs per configuration. By default, 3.");
+  parser.AddFlag<base::FilePathFlag>(&config.out)
+      .set_long_name("--out")
+      .set_required()
+      .set_help(
+          "Path to the msm profile. Entries of an existing profile are kept "
+          "unless they are tuned again.");
+  {
+    std::string error;
+    if (!parser.Parse(argc, argv, &error)) {
+      tachyon_cerr << error << std::endl;
+      return 1;
+    }
+  }
+  if (config.repeats == 0) {
+    tachyon_cerr << "--repeats should be positive" << std::endl;
+    return 1;
+  }
+
+  base::ranges::sort(config.degrees);
+  if (config.thread_counts.empty()) {
+    config.thread_counts.push_back(GetThreadCount());
+  }
+  if (base::ranges::find(config.thread_counts, uint32_t{0}) !=
+      config.thread_counts.end()) {
+    tachyon_cerr << "--thread_count should be positive" << std::endl;
+    return 1;
+  }
+  if (config.strategies.empty()) {
+    config.strategies = {
+        math::PippengerParallelStrategy::kNone,
+        math::PippengerParallelStrategy::kParallelWindow,
+        math::PippengerParallelStrategy::kParallelTerm,
+        math::PippengerParallelStrategy::kParallelWindowAndTerm,
+        math::PippengerParallelStrategy::kParallelBucket,
+    };
+  }
+
+  math::MSMProfile profile;
+  if (base::PathExists(config.out) && !profile.Load(config.out)) {
+    tachyon_cerr << "Failed to load " << config.out.value() << std::endl;
+    return 1;
+  }
+
+  if (config.curve == "bn254_g1") {
+    math::bn254::G1Curve::Init();
+    MSMAutotuner<math::bn254::G1AffinePoint>(config).Run(&profile);
+  } else {
+    math::bn254::G2Curve::Init();
+    MSMAutotuner<math::bn254::G2AffinePoint>(config).Run(&profile);
+  }
+
+  if (!profile.Save(config.out)) return 1;
+  std::cout << "Saved to " << config.out.value() << std::endl;
+  return 0;
+}
+
+}  // namespace
+}  // namespace tachyon
+
+int main(int argc, char** argv) { return tachyon::RealMain(argc, argv); }
@@ -0,0 +1,119 @@
+// Copyright 2012 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "tachyon/base/cpu.h"
+
+#include <stdint.h>
+
+#if defined(ARCH_CPU_X86_FAMILY)
+#if defined(COMPILER_MSVC)
+#include <immintrin.h>  // For _xgetbv()
+#include <intrin.h>
+#endif
+#endif
+
+namespace tachyon::base {
+
+CPU::CPU() { Initialize(); }
+
+CPU::CPU(CPU&&) = default;
+
+namespace {
+
+#if defined(ARCH_CPU_X86_FAMILY)
+#if !defined(COMPILER_MSVC)
+
+#if defined(__pic__) && defined(__i386__)
+
+void __cpuid(int cpu_info[4], int info_type) {
+  __asm__ volatile(
+      "mov %%ebx, %%edi\n"
+      "cpuid\n"
+      "xchg %%edi, %%ebx\n"
+      : "=a"(cpu_info[0]), "=D"(cpu_info[1]), "=c"(cpu_info[2]),
+        "=d"(cpu_info[3])
+      : "a"(info_type), "c"(0));
+}
+
+#else
+
+void __cpuid(int cpu_info[4], int info_type) {
+  __asm__ volatile("cpuid\n"
+                   : "=a"(cpu_info[0]), "=b"(cpu_info[1]), "=c"(cpu_info[2]),
+                     "=d"(cpu_info[3])
+                   : "a"(info_type), "c"(0));
+}
+
+#endif
+
+// xgetbv returns the value of an Intel Extended Control Register (XCR).
+// Currently only XCR0 is defined by Intel so |xcr| should always be zero.
+uint64_t xgetbv(uint32_t xcr) {
+  uint32_t eax, edx;
+
+  __asm__ volatile("xgetbv" : "=a"(eax), "=d"(edx) : "c"(xcr));
+  return (static_cast<uint64_t>(edx) << 32) | eax;
+}
+
+#else
+
+uint64_t xgetbv(uint32_t xcr) { return _xgetbv(xcr); }
+
+#endif  // !defined(COMPILER_MSVC)
+#endif  // defined(ARCH_CPU_X86_FAMILY)
+
+}  // namespace
+
+void CPU::Initialize() {
+#if defined(ARCH_CPU_X86_FAMILY)
+  int cpu_info[4] = {-1};
+
+  // __cpuid with an InfoType argument of 0 returns the number of
+  // valid Ids in CPUInfo[0].
+  __cpuid(cpu_info, 0);
+  int num_ids = cpu_info[0];
+
+  // Interpret CPU feature information.
+  if (num_ids > 0) {
+    int cpu_info7[4] = {0};
+    __cpuid(cpu_info, 1);
+    if (num_ids >= 7) {
+#if defined(COMPILER_MSVC)
+      __cpuidex(cpu_info7, 7, 0);
+#else
+      __cpuid(cpu_info7, 7);
+#endif
+    }
+
+    // "Hypervisors may not expose AVX to guests, and the OS must also
+    // support saving the AVX registers" – so both the CPUID bit and the
+    // OSXSAVE bit must be set, and XCR0 must enable the XMM and YMM state.
+    // See https://software.intel.com/en-us/blogs/2011/04/14/is-avx-enabled
+    bool os_saves_ymm = false;
+    bool os_saves_zmm = false;
+    if ((cpu_info[2] & 0x08000000) != 0) {
+      uint64_t xcr0 = xgetbv(0);
+      os_saves_ymm = (xcr0 & 6) == 6;
+      // The opmask, the upper halves of ZMM0-15 and ZMM16-31 should be
+      // saved as well.
+      os_saves_zmm = os_saves_ymm && (xcr0 & 0xe0) == 0xe0;
+    }
+
+    has_avx_ = (cpu_info[2] & 0x10000000) != 0 && os_saves_ymm;
+    has_avx2_ = has_avx_ && (cpu_info7[1] & 0x00000020) != 0;
+    has_bmi2_ = (cpu_info7[1] & 0x00000100) != 0;
+    has_adx_ = (cpu_info7[1] & 0x00080000) != 0;
+    has_avx512f_ = os_saves_zmm && (cpu_info7[1] & 0x00010000) != 0;
+    has_avx512ifma_ = has_avx512f_ && (cpu_info7[1] & 0x00200000) != 0;
+  }
+#endif  // defined(ARCH_CPU_X86_FAMILY)
+}
+
+// static
+const CPU& CPU::GetInstanceNoAllocation() {
+  static const CPU cpu;
+  return cpu;
+}
+
+}  // namespace tachyon::base
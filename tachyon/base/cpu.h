@@ -0,0 +1,51 @@
+// Copyright 2012 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef TACHYON_BASE_CPU_H_
+#define TACHYON_BASE_CPU_H_
+
+#include "tachyon/export.h"
+#include "tachyon/build/build_config.h"
+
+namespace tachyon::base {
+
+// Query information about the processor. Only the features that tachyon
+// dispatches on are detected.
+class TACHYON_EXPORT CPU final {
+ public:
+  CPU();
+  CPU(CPU&&);
+  CPU(const CPU&) = delete;
+
+  // Get a preallocated instance of CPU.
+  // This can be used in very early application startup or in hot paths like
+  // field multiplication. The instance of CPU is created once, on the first
+  // call.
+  static const CPU& GetInstanceNoAllocation();
+
+  bool has_avx() const { return has_avx_; }
+  bool has_avx2() const { return has_avx2_; }
+  // BMI2 provides MULX.
+  bool has_bmi2() const { return has_bmi2_; }
+  // ADX provides ADCX and ADOX.
+  bool has_adx() const { return has_adx_; }
+  bool has_avx512f() const { return has_avx512f_; }
+  // AVX512-IFMA provides VPMADD52LUQ and VPMADD52HUQ.
+  bool has_avx512ifma() const { return has_avx512ifma_; }
+
+ private:
+  // Query the processor for CPUID information.
+  void Initialize();
+
+  bool has_avx_ = false;
+  bool has_avx2_ = false;
+  bool has_bmi2_ = false;
+  bool has_adx_ = false;
+  bool has_avx512f_ = false;
+  bool has_avx512ifma_ = false;
+};
+
+}  // namespace tachyon::base
+
+#endif  // TACHYON_BASE_CPU_H_
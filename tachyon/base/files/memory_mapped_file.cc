@@ -0,0 +1,60 @@
+// Copyright 2013 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "tachyon/base/files/memory_mapped_file.h"
+
+#include <utility>
+
+#include "tachyon/base/logging.h"
+
+namespace tachyon::base {
+
+const MemoryMappedFile::Region MemoryMappedFile::Region::kWholeFile = {0, 0};
+
+bool MemoryMappedFile::Region::operator==(
+    const MemoryMappedFile::Region& other) const {
+  return other.offset == offset && other.size == size;
+}
+
+bool MemoryMappedFile::Region::operator!=(
+    const MemoryMappedFile::Region& other) const {
+  return other.offset != offset || other.size != size;
+}
+
+MemoryMappedFile::MemoryMappedFile() = default;
+
+MemoryMappedFile::~MemoryMappedFile() { CloseHandles(); }
+
+bool MemoryMappedFile::Initialize(const FilePath& file_name) {
+  if (IsValid()) return false;
+
+  file_ = File(file_name, File::FLAG_OPEN | File::FLAG_READ);
+  if (!file_.IsValid()) {
+    LOG(ERROR) << "Couldn't open " << file_name.value();
+    return false;
+  }
+
+  if (!MapFileRegionToMemory(Region::kWholeFile)) {
+    CloseHandles();
+    return false;
+  }
+  return true;
+}
+
+bool MemoryMappedFile::Initialize(File file, const Region& region) {
+  if (IsValid()) return false;
+
+  if (region != Region::kWholeFile) DCHECK_GE(region.offset, 0);
+
+  file_ = std::move(file);
+  if (!MapFileRegionToMemory(region)) {
+    CloseHandles();
+    return false;
+  }
+  return true;
+}
+
+bool MemoryMappedFile::IsValid() const { return data_ != nullptr; }
+
+}  // namespace tachyon::base
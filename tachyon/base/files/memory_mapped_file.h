@@ -0,0 +1,88 @@
+// Copyright 2013 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef TACHYON_BASE_FILES_MEMORY_MAPPED_FILE_H_
+#define TACHYON_BASE_FILES_MEMORY_MAPPED_FILE_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "tachyon/export.h"
+#include "tachyon/base/files/file.h"
+#include "tachyon/base/files/file_path.h"
+
+namespace tachyon::base {
+
+// A read-only view of a file mapped into memory. The pages are loaded by the
+// OS on demand, so a file larger than the physical memory can be read as
+// long as only a part of it is accessed at once.
+class TACHYON_EXPORT MemoryMappedFile {
+ public:
+  // Hints to the OS about how a range of the mapping is going to be accessed.
+  enum class Advice {
+    // The range is going to be accessed soon, so it is read ahead.
+    kWillNeed,
+    // The range is not going to be accessed again soon, so its pages can be
+    // dropped.
+    kDontNeed,
+  };
+
+  // A region of a file to be mapped.
+  struct TACHYON_EXPORT Region {
+    static const Region kWholeFile;
+
+    bool operator==(const Region& other) const;
+    bool operator!=(const Region& other) const;
+
+    // Start of the region in bytes.
+    int64_t offset;
+    // Length of the region in bytes.
+    size_t size;
+  };
+
+  MemoryMappedFile();
+  MemoryMappedFile(const MemoryMappedFile&) = delete;
+  MemoryMappedFile& operator=(const MemoryMappedFile&) = delete;
+  ~MemoryMappedFile();
+
+  // Opens an existing file and maps it into memory. Returns false if the file
+  // fails to be opened or mapped, or if it is empty.
+  [[nodiscard]] bool Initialize(const FilePath& file_name);
+
+  // As above, but works with an already-opened file. MemoryMappedFile takes
+  // ownership of |file| and closes it when done. |region| is the part of the
+  // file to be mapped.
+  [[nodiscard]] bool Initialize(File file,
+                                const Region& region = Region::kWholeFile);
+
+  const uint8_t* data() const { return data_; }
+  size_t length() const { return length_; }
+
+  // Is file_ a valid file handle that points to an open, memory mapped file?
+  bool IsValid() const;
+
+  // Gives |advice| about [|offset|, |offset| + |length|) of the mapping.
+  // Returns false if the range is out of the mapping or the OS rejects it. It
+  // is only a hint, so callers may ignore the result.
+  bool Advise(size_t offset, size_t length, Advice advice) const;
+
+ private:
+  // Maps the |region| of |file_| into memory. On success, sets |data_| and
+  // |length_|.
+  bool MapFileRegionToMemory(const Region& region);
+
+  // Closes all open handles.
+  void CloseHandles();
+
+  File file_;
+  // The start of the page that contains |data_|.
+  uint8_t* mapped_data_ = nullptr;
+  size_t mapped_length_ = 0;
+  uint8_t* data_ = nullptr;
+  size_t length_ = 0;
+};
+
+}  // namespace tachyon::base
+
+#endif  // TACHYON_BASE_FILES_MEMORY_MAPPED_FILE_H_
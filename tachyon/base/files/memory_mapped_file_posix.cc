@@ -0,0 +1,96 @@
+// Copyright 2013 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "tachyon/base/files/memory_mapped_file.h"
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <limits>
+
+#include "tachyon/base/logging.h"
+#include "tachyon/base/numerics/safe_conversions.h"
+
+namespace tachyon::base {
+
+bool MemoryMappedFile::MapFileRegionToMemory(const Region& region) {
+  int64_t map_start = 0;
+  size_t map_size = 0;
+  size_t data_offset = 0;
+
+  if (region == Region::kWholeFile) {
+    int64_t file_len = file_.GetLength();
+    if (file_len < 0) {
+      PLOG(ERROR) << "fstat " << file_.GetPlatformFile();
+      return false;
+    }
+    if (!IsValueInRangeForNumericType<size_t>(file_len)) return false;
+    map_size = static_cast<size_t>(file_len);
+  } else {
+    // The region can be arbitrarily aligned. mmap, instead, requires both the
+    // start and size to be page-aligned. Hence, we map here the page-aligned
+    // outer region [|aligned_start|, |aligned_start| + |size|] which contains
+    // |region| and then add up the |data_offset| displacement.
+    int64_t page_size = static_cast<int64_t>(sysconf(_SC_PAGESIZE));
+    int64_t aligned_start = region.offset - region.offset % page_size;
+    data_offset = static_cast<size_t>(region.offset - aligned_start);
+    if (region.size > std::numeric_limits<size_t>::max() - data_offset) {
+      DLOG(ERROR) << "Region bounds exceed maximum for size_t";
+      return false;
+    }
+    map_start = aligned_start;
+    map_size = data_offset + region.size;
+  }
+
+  if (map_size == 0) {
+    LOG(ERROR) << "Can't map an empty region";
+    return false;
+  }
+
+  void* mapped = mmap(nullptr, map_size, PROT_READ, MAP_SHARED,
+                      file_.GetPlatformFile(), map_start);
+  if (mapped == MAP_FAILED) {
+    PLOG(ERROR) << "mmap " << file_.GetPlatformFile();
+    return false;
+  }
+
+  mapped_data_ = static_cast<uint8_t*>(mapped);
+  mapped_length_ = map_size;
+  data_ = mapped_data_ + data_offset;
+  length_ = map_size - data_offset;
+  return true;
+}
+
+bool MemoryMappedFile::Advise(size_t offset, size_t length,
+                              Advice advice) const {
+  if (!IsValid() || offset > length_ || length > length_ - offset) {
+    return false;
+  }
+  if (length == 0) return true;
+
+  // madvise() requires a page-aligned start.
+  size_t page_size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+  size_t start = static_cast<size_t>(data_ - mapped_data_) + offset;
+  size_t aligned_start = start - start % page_size;
+  int native_advice =
+      advice == Advice::kWillNeed ? MADV_WILLNEED : MADV_DONTNEED;
+  if (madvise(mapped_data_ + aligned_start, start - aligned_start + length,
+              native_advice) != 0) {
+    DPLOG(ERROR) << "madvise";
+    return false;
+  }
+  return true;
+}
+
+void MemoryMappedFile::CloseHandles() {
+  if (mapped_data_ != nullptr) munmap(mapped_data_, mapped_length_);
+  file_.Close();
+
+  mapped_data_ = nullptr;
+  mapped_length_ = 0;
+  data_ = nullptr;
+  length_ = 0;
+}
+
+}  // namespace tachyon::base
@@ -0,0 +1,100 @@
+// Copyright 2013 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "tachyon/base/files/memory_mapped_file.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <string>
+#include <utility>
+
+#include "gtest/gtest.h"
+
+#include "tachyon/base/files/file_util.h"
+#include "tachyon/base/files/scoped_temp_dir.h"
+
+namespace tachyon::base {
+
+namespace {
+
+// Creates a test string of |size| bytes that depends on |offset|.
+std::string CreateTestString(size_t size, size_t offset) {
+  std::string ret(size, '\0');
+  for (size_t i = 0; i < size; ++i) {
+    ret[i] = static_cast<char>((i + offset) % 253);
+  }
+  return ret;
+}
+
+class MemoryMappedFileTest : public testing::Test {
+ public:
+  void SetUp() override {
+    ASSERT_TRUE(temp_dir_.CreateUniqueTempDir());
+    path_ = temp_dir_.GetPath().Append("mapped_file");
+  }
+
+  void CreateTemporaryTestFile(size_t size) {
+    ASSERT_TRUE(WriteFile(path_, CreateTestString(size, 0)));
+  }
+
+ protected:
+  ScopedTempDir temp_dir_;
+  FilePath path_;
+};
+
+}  // namespace
+
+TEST_F(MemoryMappedFileTest, MapWholeFile) {
+  const size_t kFileSize = 68 * 1024;
+  CreateTemporaryTestFile(kFileSize);
+  MemoryMappedFile map;
+  ASSERT_TRUE(map.Initialize(path_));
+  ASSERT_EQ(map.length(), kFileSize);
+  ASSERT_TRUE(map.IsValid());
+  EXPECT_EQ(std::string(reinterpret_cast<const char*>(map.data()),
+                        map.length()),
+            CreateTestString(kFileSize, 0));
+}
+
+TEST_F(MemoryMappedFileTest, MapEmptyFile) {
+  CreateTemporaryTestFile(0);
+  MemoryMappedFile map;
+  EXPECT_FALSE(map.Initialize(path_));
+  EXPECT_FALSE(map.IsValid());
+}
+
+TEST_F(MemoryMappedFileTest, MapPartialRegion) {
+  const size_t kFileSize = 157 * 1024;
+  const size_t kOffset = 1024 * 5 + 32;
+  const size_t kPartialSize = 1024 * 75 + 11;
+  CreateTemporaryTestFile(kFileSize);
+  MemoryMappedFile map;
+  File file(path_, File::FLAG_OPEN | File::FLAG_READ);
+  MemoryMappedFile::Region region = {kOffset, kPartialSize};
+  ASSERT_TRUE(map.Initialize(std::move(file), region));
+  ASSERT_EQ(map.length(), kPartialSize);
+  EXPECT_EQ(std::string(reinterpret_cast<const char*>(map.data()),
+                        map.length()),
+            CreateTestString(kFileSize, 0).substr(kOffset, kPartialSize));
+}
+
+TEST_F(MemoryMappedFileTest, Advise) {
+  const size_t kFileSize = 68 * 1024;
+  CreateTemporaryTestFile(kFileSize);
+  MemoryMappedFile map;
+  File file(path_, File::FLAG_OPEN | File::FLAG_READ);
+  MemoryMappedFile::Region region = {33, kFileSize - 33};
+  ASSERT_TRUE(map.Initialize(std::move(file), region));
+  const size_t length = map.length();
+  EXPECT_TRUE(map.Advise(100, 5000, MemoryMappedFile::Advice::kWillNeed));
+  EXPECT_TRUE(map.Advise(0, length, MemoryMappedFile::Advice::kDontNeed));
+  EXPECT_FALSE(map.Advise(length, 1, MemoryMappedFile::Advice::kWillNeed));
+  EXPECT_FALSE(map.Advise(1, length, MemoryMappedFile::Advice::kWillNeed));
+  // The pages are read again after they are dropped.
+  EXPECT_EQ(std::string(reinterpret_cast<const char*>(map.data()), length),
+            CreateTestString(kFileSize, 0).substr(33));
+}
+
+}  // namespace tachyon::base
@@ -17,6 +17,9 @@
 #include "tachyon/crypto/commitments/polynomial_openings.h"
 #include "tachyon/crypto/commitments/univariate_polynomial_commitment_scheme.h"
 #include "tachyon/crypto/transcripts/transcript.h"
+#include "tachyon/math/elliptic_curves/msm/comb_fixed_base_msm.h"
+#include "tachyon/math/elliptic_curves/msm/wnaf.h"
+#include "tachyon/math/elliptic_curves/pairing/g2_prepared_cache.h"
 #include "tachyon/math/elliptic_curves/pairing/pairing.h"
 
 namespace tachyon {
@@ -44,6 +47,7 @@ class GWC final : public UnivariatePolynomialCommitmentScheme<
   using G1Point = typename Curve::G1Curve::AffinePoint;
   using G2Point = typename Curve::G2Curve::AffinePoint;
   using G2Prepared = typename Curve::G2Prepared;
+  using G2PreparedCache = math::G2PreparedCache<Curve>;
   using Fp12 = typename Curve::Fp12;
   using Field = typename Base::Field;
   using Poly = typename Base::Poly;
@@ -56,8 +60,8 @@ class GWC final : public UnivariatePolynomialCommitmentScheme<
   GWC(KZG<G1Point, MaxDegree, Commitment>&& kzg, G2Point&& s_g2)
       : KZGFamily<G1Point, MaxDegree, Commitment>(std::move(kzg)),
         s_g2_(std::move(s_g2)),
-        g2_arr_({G2Prepared::From(G2Point::Generator()),
-                 G2Prepared::From(-s_g2)}) {}
+        g2_arr_({G2PreparedCache::GetInstance().Get(G2Point::Generator()),
+                 G2PreparedCache::GetInstance().Get(-s_g2_)}) {}
 
   const G2Point& s_g2() const { return s_g2_; }
 
@@ -180,7 +184,8 @@ class GWC final : public UnivariatePolynomialCommitmentScheme<
         // |commitment_batch₂| = C₀ + vC₁ + v²C₂ + v³C₃
         // |commitment_batch₃| = C₃
         // |commitment_batch₄| = C₄
-        commitment_batch *= v;
+        commitment_batch =
+            math::WNAF<G1JacobianPoint>::Mul(commitment_batch, v);
         commitment_batch += *poly_openings.poly_oracle;
       }
 
@@ -189,8 +194,8 @@ class GWC final : public UnivariatePolynomialCommitmentScheme<
       //                              u²(C₀ + vC₁ + v²C₂ + v³C₃) +
       //                              u³C₃ +
       //                              u⁴C₄
-      commitment_batch *= power_of_u;
-      commitment_multi += commitment_batch;
+      commitment_multi +=
+          math::WNAF<G1JacobianPoint>::Mul(commitment_batch, power_of_u);
       // |opening_multi| = Oₘᵤₗₜ = P₀(x₀) + vP₁(x₀) + v²P₂(x₀) +
       //                           u(P₀(x₁) + vP₁(x₁) + v²P₂(x₁)) +
       //                           u²(P₀(x₂) + vP₁(x₂) + v²P₂(x₂) + v³P₃(x₂)) +
@@ -202,13 +207,13 @@ class GWC final : public UnivariatePolynomialCommitmentScheme<
       // clang-format off
       // |witness_with_aux| = Wₐᵤₓ = x₀[W₀(𝜏)]₁ + ux₁[W₁(𝜏)]₁ + u²x₂[W₂(𝜏)]₁ + u³x₃[W₃(𝜏)]₁ + u⁴x₄[W₄(𝜏)]₁
       // clang-format on
-      witness_with_aux += power_of_u *
-                          *grouped_poly_openings_vec[i].point_refs[0] *
-                          commitments[i];
+      witness_with_aux += math::WNAF<Commitment>::Mul(
+          commitments[i],
+          power_of_u * *grouped_poly_openings_vec[i].point_refs[0]);
       // clang-format off
       // |witness| = W = [W₀(𝜏)]₁ + u[W₁(𝜏)]₁ + u²[W₂(𝜏)]₁ + u³[W₃(𝜏)]₁ + u⁴[W₄(𝜏)]₁
       // clang-format on
-      witness += power_of_u * commitments[i];
+      witness += math::WNAF<Commitment>::Mul(commitments[i], power_of_u);
 
       power_of_u *= u;
     }
@@ -222,8 +227,10 @@ class GWC final : public UnivariatePolynomialCommitmentScheme<
     // H₀(𝜏) - uH₁(𝜏) - u²H₂(𝜏) - u³H₃(𝜏) - u⁴H₄(𝜏) ≟ 0
     // clang-format on
     G1JacobianPoint g1_jacobian_arr[] = {
-        witness, (witness_with_aux + commitment_multi -
-                  opening_multi * G1JacobianPoint::Generator())};
+        witness,
+        (witness_with_aux + commitment_multi -
+         math::CombFixedBaseMSM<G1Point>::GetGeneratorInstance().ScalarMul(
+             opening_multi))};
     G1Point g1_arr[2];
     if (!G1JacobianPoint::BatchNormalize(g1_jacobian_arr, &g1_arr))
       return false;
@@ -234,9 +241,10 @@ class GWC final : public UnivariatePolynomialCommitmentScheme<
   [[nodiscard]] bool DoUnsafeSetupWithTau(size_t size,
                                           const Field& tau) override {
     s_g2_ = (G2Point::Generator() * tau).ToAffine();
+    // NOTE: |s_g2_| is not cached, since it varies per setup.
     g2_arr_ = {
         G2Prepared::From(s_g2_),
-        G2Prepared::From(-G2Point::Generator()),
+        G2PreparedCache::GetInstance().Get(-G2Point::Generator()),
     };
     return true;
   }
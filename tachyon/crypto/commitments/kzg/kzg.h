@@ -10,15 +10,24 @@
 #include <stddef.h>
 
 #include <algorithm>
+#include <limits>
 #include <memory>
 #include <utility>
 #include <vector>
 
+#include "absl/types/span.h"
+
 #include "tachyon/base/buffer/copyable.h"
+#include "tachyon/base/containers/container_util.h"
+#include "tachyon/base/files/memory_mapped_file.h"
 #include "tachyon/base/logging.h"
 #include "tachyon/crypto/commitments/batch_commitment_state.h"
+#include "tachyon/math/elliptic_curves/msm/algorithms/pippenger/pippenger_with_precomputation.h"
+#include "tachyon/math/elliptic_curves/msm/comb_fixed_base_msm.h"
+#include "tachyon/math/elliptic_curves/msm/memory_mapped_bases.h"
 #include "tachyon/math/elliptic_curves/msm/variable_base_msm.h"
 #include "tachyon/math/elliptic_curves/point_conversions.h"
+#include "tachyon/math/elliptic_curves/short_weierstrass/compressed_affine_point.h"
 #include "tachyon/math/polynomials/univariate/univariate_evaluation_domain.h"
 
 namespace tachyon {
@@ -30,6 +39,8 @@ class KZG {
  public:
   using Field = typename G1Point::ScalarField;
   using Bucket = typename math::Pippenger<G1Point>::Bucket;
+  using Precomputation = math::PippengerWithPrecomputation<G1Point>;
+  using MappedBases = math::MemoryMappedBases<G1Point>;
 
   static constexpr size_t kMaxDegree = MaxDegree;
 
@@ -43,6 +54,20 @@ class KZG {
     CHECK_LE(g1_powers_of_tau_.size(), kMaxDegree + 1);
   }
 
+  KZG(std::vector<G1Point>&& g1_powers_of_tau,
+      std::vector<G1Point>&& g1_powers_of_tau_lagrange,
+      Precomputation&& precomputed_g1_powers_of_tau,
+      Precomputation&& precomputed_g1_powers_of_tau_lagrange)
+      : KZG(std::move(g1_powers_of_tau), std::move(g1_powers_of_tau_lagrange)) {
+    precomputed_g1_powers_of_tau_ = std::move(precomputed_g1_powers_of_tau);
+    precomputed_g1_powers_of_tau_lagrange_ =
+        std::move(precomputed_g1_powers_of_tau_lagrange);
+    CHECK_LE(precomputed_g1_powers_of_tau_.bases_size(),
+             g1_powers_of_tau_.size());
+    CHECK_LE(precomputed_g1_powers_of_tau_lagrange_.bases_size(),
+             g1_powers_of_tau_lagrange_.size());
+  }
+
   const std::vector<G1Point>& g1_powers_of_tau() const {
     return g1_powers_of_tau_;
   }
@@ -51,6 +76,46 @@ class KZG {
     return g1_powers_of_tau_lagrange_;
   }
 
+  const Precomputation& precomputed_g1_powers_of_tau() const {
+    return precomputed_g1_powers_of_tau_;
+  }
+
+  const Precomputation& precomputed_g1_powers_of_tau_lagrange() const {
+    return precomputed_g1_powers_of_tau_lagrange_;
+  }
+
+  // If true, Copyable<KZG> writes |g1_powers_of_tau_| and
+  // |g1_powers_of_tau_lagrange_| in the compressed form, which is about a half
+  // of the uncompressed one. Copyable<KZG> reads either form and sets this to
+  // the form it has read.
+  bool compressed() const { return compressed_; }
+  void set_compressed(bool compressed) { compressed_ = compressed; }
+
+  // Copyable<KZG> writes the original form, i.e., |g1_powers_of_tau_| and
+  // |g1_powers_of_tau_lagrange_| only, if they are neither compressed nor
+  // precomputed. Otherwise, it starts with one of these tags in place of the
+  // size of |g1_powers_of_tau_|, which no size reaches, so that the files
+  // written in the original form are still read.
+  constexpr static size_t kPrecomputedTag = std::numeric_limits<size_t>::max();
+  constexpr static size_t kCompressedTag = kPrecomputedTag - 1;
+  constexpr static size_t kCompressedPrecomputedTag = kPrecomputedTag - 2;
+
+  bool HasPrecomputedBases() const {
+    return !precomputed_g1_powers_of_tau_.IsEmpty();
+  }
+
+  // Precomputes |table_size| multiples of each of |g1_powers_of_tau_| and
+  // |g1_powers_of_tau_lagrange_|, so that every later commitment does fewer
+  // doublings and window merges. The first multiple is the base itself, so
+  // memory for the bases grows by a factor of |table_size|. See
+  // math::PippengerWithPrecomputation for details.
+  [[nodiscard]] bool PrecomputeBases(size_t table_size) {
+    return precomputed_g1_powers_of_tau_.Precompute(g1_powers_of_tau_,
+                                                    table_size) &&
+           precomputed_g1_powers_of_tau_lagrange_.Precompute(
+               g1_powers_of_tau_lagrange_, table_size);
+  }
+
   void ResizeBatchCommitments(size_t size) { batch_commitments_.resize(size); }
 
   std::vector<Commitment> GetBatchCommitments(BatchCommitmentState& state) {
@@ -75,15 +140,16 @@ class KZG {
   [[nodiscard]] bool UnsafeSetup(size_t size, const Field& tau) {
     using Domain = math::UnivariateEvaluationDomain<Field, kMaxDegree>;
 
+    // The powers of 𝜏 and the Lagrange coefficients are multiplied by g₁ with
+    // the same comb tables.
+    math::CombFixedBaseMSM<G1Point> msm;
+    msm.Reset(G1Point::Generator());
+
     // |g1_powers_of_tau_| = [𝜏⁰g₁, 𝜏¹g₁, ... , 𝜏ⁿ⁻¹g₁]
-    G1Point g1 = G1Point::Generator();
     std::vector<Field> powers_of_tau = Field::GetSuccessivePowers(size, tau);
 
     g1_powers_of_tau_.resize(size);
-    if (!G1Point::BatchMapScalarFieldToPoint(g1, powers_of_tau,
-                                             &g1_powers_of_tau_)) {
-      return false;
-    }
+    if (!msm.Run(powers_of_tau, &g1_powers_of_tau_)) return false;
 
     // Get |g1_powers_of_tau_lagrange_| from 𝜏 and g₁.
     std::unique_ptr<Domain> domain = Domain::Create(size);
@@ -91,8 +157,9 @@ class KZG {
         domain->EvaluateAllLagrangeCoefficients(tau);
 
     g1_powers_of_tau_lagrange_.resize(size);
-    return G1Point::BatchMapScalarFieldToPoint(g1, lagrange_coeffs,
-                                               &g1_powers_of_tau_lagrange_);
+    precomputed_g1_powers_of_tau_ = Precomputation();
+    precomputed_g1_powers_of_tau_lagrange_ = Precomputation();
+    return msm.Run(lagrange_coeffs, &g1_powers_of_tau_lagrange_);
   }
 
   // Return false if |n| >= |N()|.
@@ -100,61 +167,210 @@ class KZG {
     if (n >= N()) return false;
     g1_powers_of_tau_.resize(n);
     g1_powers_of_tau_lagrange_.resize(n);
+    if (HasPrecomputedBases()) {
+      CHECK(precomputed_g1_powers_of_tau_.Downsize(n));
+      CHECK(precomputed_g1_powers_of_tau_lagrange_.Downsize(n));
+    }
     return true;
   }
 
   template <typename ScalarContainer>
   [[nodiscard]] bool Commit(const ScalarContainer& v, Commitment* out) const {
-    return DoMSM(g1_powers_of_tau_, v, out);
+    return DoMSM(g1_powers_of_tau_, precomputed_g1_powers_of_tau_, v, out);
   }
 
   template <typename ScalarContainer>
   [[nodiscard]] bool Commit(const ScalarContainer& v,
                             BatchCommitmentState& state, size_t index) {
-    return DoMSM(g1_powers_of_tau_, v, state, index);
+    return DoMSM(g1_powers_of_tau_, precomputed_g1_powers_of_tau_, v, state,
+                 index);
   }
 
   template <typename ScalarContainer>
   [[nodiscard]] bool CommitLagrange(const ScalarContainer& v,
                                     Commitment* out) const {
-    return DoMSM(g1_powers_of_tau_lagrange_, v, out);
+    return DoMSM(g1_powers_of_tau_lagrange_,
+                 precomputed_g1_powers_of_tau_lagrange_, v, out);
   }
 
   template <typename ScalarContainer>
   [[nodiscard]] bool CommitLagrange(const ScalarContainer& v,
                                     BatchCommitmentState& state, size_t index) {
-    return DoMSM(g1_powers_of_tau_lagrange_, v, state, index);
+    return DoMSM(g1_powers_of_tau_lagrange_,
+                 precomputed_g1_powers_of_tau_lagrange_, v, state, index);
+  }
+
+  // Commits to each of |vs| and populates |outs| with the commitments. This is
+  // faster than calling Commit() for each of them, since the passes over the
+  // bases are shared. See math::VariableBaseMSM::RunBatch() for details.
+  template <typename ScalarContainer>
+  [[nodiscard]] bool BatchCommit(const std::vector<ScalarContainer>& vs,
+                                 std::vector<Commitment>* outs) const {
+    return DoBatchMSM(g1_powers_of_tau_, precomputed_g1_powers_of_tau_, vs,
+                      outs);
+  }
+
+  // Commits to each of |vs| and stores the commitments in
+  // |batch_commitments_| from |index|.
+  template <typename ScalarContainer>
+  [[nodiscard]] bool BatchCommit(const std::vector<ScalarContainer>& vs,
+                                 BatchCommitmentState& state, size_t index) {
+    return DoBatchMSM(g1_powers_of_tau_, precomputed_g1_powers_of_tau_, vs,
+                      state, index);
+  }
+
+  template <typename ScalarContainer>
+  [[nodiscard]] bool BatchCommitLagrange(const std::vector<ScalarContainer>& vs,
+                                         std::vector<Commitment>* outs) const {
+    return DoBatchMSM(g1_powers_of_tau_lagrange_,
+                      precomputed_g1_powers_of_tau_lagrange_, vs, outs);
+  }
+
+  template <typename ScalarContainer>
+  [[nodiscard]] bool BatchCommitLagrange(const std::vector<ScalarContainer>& vs,
+                                         BatchCommitmentState& state,
+                                         size_t index) {
+    return DoBatchMSM(g1_powers_of_tau_lagrange_,
+                      precomputed_g1_powers_of_tau_lagrange_, vs, state, index);
+  }
+
+  // Maps |g1_powers_of_tau| and |g1_powers_of_tau_lagrange| to the bases in
+  // |file| written with Copyable<KZG> in the uncompressed form, so that
+  // commitments can be computed with CommitStreaming() without loading the SRS
+  // in memory. |file| should outlive them.
+  [[nodiscard]] static bool MapBases(const base::MemoryMappedFile* file,
+                                     MappedBases* g1_powers_of_tau,
+                                     MappedBases* g1_powers_of_tau_lagrange) {
+    base::ReadOnlyBuffer buffer(file->data(), file->length());
+    size_t tag;
+    if (!buffer.Read(&tag)) {
+      LOG(ERROR) << "Failed to read the number of bases";
+      return false;
+    }
+    if (tag == kCompressedTag || tag == kCompressedPrecomputedTag) {
+      LOG(ERROR) << "Compressed bases can't be mapped";
+      return false;
+    }
+    size_t offset = tag == kPrecomputedTag ? buffer.buffer_offset() : 0;
+    if (!MappedBases::FromVector(file, offset, g1_powers_of_tau, &offset)) {
+      return false;
+    }
+    return MappedBases::FromVector(file, offset, g1_powers_of_tau_lagrange);
+  }
+
+  // Commits to |v| with |bases| given by MapBases(). Only |chunk_size| bases
+  // are held in memory at once. See math::VariableBaseMSM::RunStreaming().
+  template <typename ScalarContainer>
+  [[nodiscard]] static bool CommitStreaming(
+      const MappedBases& bases, const ScalarContainer& v, Commitment* out,
+      size_t chunk_size =
+          math::VariableBaseMSM<G1Point>::kDefaultChunkSize) {
+    math::VariableBaseMSM<G1Point> msm;
+    if constexpr (std::is_same_v<Commitment, Bucket>) {
+      return msm.RunStreaming(bases, v, out, chunk_size);
+    } else {
+      Bucket result;
+      if (!msm.RunStreaming(bases, v, &result, chunk_size)) return false;
+      *out = math::ConvertPoint<Commitment>(result);
+      return true;
+    }
   }
 
  private:
   template <typename BaseContainer, typename ScalarContainer>
-  static bool DoMSM(const BaseContainer& bases, const ScalarContainer& scalars,
-                    Commitment* out) {
-    math::VariableBaseMSM<G1Point> msm;
-    absl::Span<const G1Point> bases_span = absl::Span<const G1Point>(
-        bases.data(), std::min(bases.size(), scalars.size()));
+  static bool DoMSM(const BaseContainer& bases,
+                    const Precomputation& precomputation,
+                    const ScalarContainer& scalars, Commitment* out) {
     if constexpr (std::is_same_v<Commitment, Bucket>) {
-      return msm.Run(bases_span, scalars, out);
+      return RunMSM(bases, precomputation, scalars, out);
     } else {
       Bucket result;
-      if (!msm.Run(bases_span, scalars, &result)) return false;
+      if (!RunMSM(bases, precomputation, scalars, &result)) return false;
       *out = math::ConvertPoint<Commitment>(result);
       return true;
     }
   }
 
   template <typename BaseContainer, typename ScalarContainer>
-  bool DoMSM(const BaseContainer& bases, const ScalarContainer& scalars,
-             BatchCommitmentState& state, size_t index) {
+  bool DoMSM(const BaseContainer& bases, const Precomputation& precomputation,
+             const ScalarContainer& scalars, BatchCommitmentState& state,
+             size_t index) {
+    return RunMSM(bases, precomputation, scalars, &batch_commitments_[index]);
+  }
+
+  template <typename BaseContainer, typename ScalarContainer>
+  static bool DoBatchMSM(const BaseContainer& bases,
+                         const Precomputation& precomputation,
+                         const std::vector<ScalarContainer>& vs,
+                         std::vector<Commitment>* outs) {
+    if constexpr (std::is_same_v<Commitment, Bucket>) {
+      return RunBatchMSM(bases, precomputation, vs, outs);
+    } else {
+      std::vector<Bucket> results;
+      if (!RunBatchMSM(bases, precomputation, vs, &results)) return false;
+      outs->resize(results.size());
+      return Bucket::BatchNormalize(results, outs);
+    }
+  }
+
+  template <typename BaseContainer, typename ScalarContainer>
+  bool DoBatchMSM(const BaseContainer& bases,
+                  const Precomputation& precomputation,
+                  const std::vector<ScalarContainer>& vs,
+                  BatchCommitmentState& state, size_t index) {
+    CHECK_LE(index + vs.size(), batch_commitments_.size());
+    std::vector<Bucket> results;
+    if (!RunBatchMSM(bases, precomputation, vs, &results)) return false;
+    std::move(results.begin(), results.end(),
+              batch_commitments_.begin() + index);
+    return true;
+  }
+
+  template <typename BaseContainer, typename ScalarContainer>
+  static bool RunBatchMSM(const BaseContainer& bases,
+                          const Precomputation& precomputation,
+                          const std::vector<ScalarContainer>& vs,
+                          std::vector<Bucket>* outs) {
+    size_t max_size = 0;
+    for (const ScalarContainer& v : vs) {
+      max_size = std::max(max_size, std::size(v));
+    }
+    if (!precomputation.IsEmpty() && max_size <= precomputation.bases_size()) {
+      outs->resize(vs.size());
+      for (size_t i = 0; i < vs.size(); ++i) {
+        if (!precomputation.Run(bases, vs[i], &(*outs)[i])) return false;
+      }
+      return true;
+    }
+    std::vector<absl::Span<const Field>> scalars_list =
+        base::Map(vs, [](const ScalarContainer& v) {
+          return absl::Span<const Field>(std::data(v), std::size(v));
+        });
+    math::VariableBaseMSM<G1Point> msm;
+    return msm.RunBatch(bases, scalars_list, outs);
+  }
+
+  template <typename BaseContainer, typename ScalarContainer>
+  static bool RunMSM(const BaseContainer& bases,
+                     const Precomputation& precomputation,
+                     const ScalarContainer& scalars, Bucket* out) {
+    if (!precomputation.IsEmpty() &&
+        std::size(scalars) <= precomputation.bases_size()) {
+      return precomputation.Run(bases, scalars, out);
+    }
     math::VariableBaseMSM<G1Point> msm;
     absl::Span<const G1Point> bases_span = absl::Span<const G1Point>(
         bases.data(), std::min(bases.size(), scalars.size()));
-    return msm.Run(bases_span, scalars, &batch_commitments_[index]);
+    return msm.Run(bases_span, scalars, out);
   }
 
   std::vector<G1Point> g1_powers_of_tau_;
   std::vector<G1Point> g1_powers_of_tau_lagrange_;
+  // Empty unless PrecomputeBases() is called.
+  Precomputation precomputed_g1_powers_of_tau_;
+  Precomputation precomputed_g1_powers_of_tau_lagrange_;
   std::vector<Bucket> batch_commitments_;
+  bool compressed_ = false;
 };
 
 }  // namespace crypto
@@ -165,27 +381,106 @@ template <typename G1Point, size_t MaxDegree, typename Commitment>
 class Copyable<crypto::KZG<G1Point, MaxDegree, Commitment>> {
  public:
   using PCS = crypto::KZG<G1Point, MaxDegree, Commitment>;
+  using Precomputation = typename PCS::Precomputation;
+  using CompressedG1Point =
+      math::CompressedAffinePoint<typename G1Point::Curve>;
 
   static bool WriteTo(const PCS& pcs, Buffer* buffer) {
-    return buffer->WriteMany(pcs.g1_powers_of_tau(),
-                             pcs.g1_powers_of_tau_lagrange());
+    bool precomputed = pcs.HasPrecomputedBases();
+    if (pcs.compressed()) {
+      if (!buffer->WriteMany(
+              precomputed ? PCS::kCompressedPrecomputedTag
+                          : PCS::kCompressedTag,
+              CompressedG1Point::BatchFrom(pcs.g1_powers_of_tau()),
+              CompressedG1Point::BatchFrom(pcs.g1_powers_of_tau_lagrange()))) {
+        return false;
+      }
+    } else {
+      if (precomputed && !buffer->Write(PCS::kPrecomputedTag)) return false;
+      if (!buffer->WriteMany(pcs.g1_powers_of_tau(),
+                             pcs.g1_powers_of_tau_lagrange())) {
+        return false;
+      }
+    }
+    if (!precomputed) return true;
+    return buffer->WriteMany(pcs.precomputed_g1_powers_of_tau(),
+                             pcs.precomputed_g1_powers_of_tau_lagrange());
   }
 
   static bool ReadFrom(const ReadOnlyBuffer& buffer, PCS* pcs) {
     std::vector<G1Point> g1_powers_of_tau;
     std::vector<G1Point> g1_powers_of_tau_lagrange;
-    if (!buffer.ReadMany(&g1_powers_of_tau, &g1_powers_of_tau_lagrange)) {
-      return false;
+    Precomputation precomputed_g1_powers_of_tau;
+    Precomputation precomputed_g1_powers_of_tau_lagrange;
+    size_t offset = buffer.buffer_offset();
+    size_t tag;
+    if (!buffer.Read(&tag)) return false;
+    bool compressed = tag == PCS::kCompressedTag ||
+                      tag == PCS::kCompressedPrecomputedTag;
+    bool precomputed = tag == PCS::kPrecomputedTag ||
+                       tag == PCS::kCompressedPrecomputedTag;
+    if (compressed) {
+      std::vector<CompressedG1Point> compressed_g1_powers_of_tau;
+      std::vector<CompressedG1Point> compressed_g1_powers_of_tau_lagrange;
+      if (!buffer.ReadMany(&compressed_g1_powers_of_tau,
+                           &compressed_g1_powers_of_tau_lagrange)) {
+        return false;
+      }
+      if (!CompressedG1Point::BatchDecompress(compressed_g1_powers_of_tau,
+                                              &g1_powers_of_tau) ||
+          !CompressedG1Point::BatchDecompress(
+              compressed_g1_powers_of_tau_lagrange,
+              &g1_powers_of_tau_lagrange)) {
+        return false;
+      }
+    } else if (precomputed) {
+      if (!buffer.ReadMany(&g1_powers_of_tau, &g1_powers_of_tau_lagrange)) {
+        return false;
+      }
+    } else {
+      // NOTE: In the original form, |tag| is the size of |g1_powers_of_tau|.
+      if (!buffer.ReadAt(offset, &g1_powers_of_tau) ||
+          !buffer.Read(&g1_powers_of_tau_lagrange)) {
+        return false;
+      }
+    }
+    if (precomputed) {
+      if (!buffer.ReadMany(&precomputed_g1_powers_of_tau,
+                           &precomputed_g1_powers_of_tau_lagrange)) {
+        return false;
+      }
+      if (precomputed_g1_powers_of_tau.bases_size() >
+              g1_powers_of_tau.size() ||
+          precomputed_g1_powers_of_tau_lagrange.bases_size() >
+              g1_powers_of_tau_lagrange.size()) {
+        LOG(ERROR) << "Precomputed bases are larger than the bases";
+        return false;
+      }
     }
 
     *pcs =
-        PCS(std::move(g1_powers_of_tau), std::move(g1_powers_of_tau_lagrange));
+        PCS(std::move(g1_powers_of_tau), std::move(g1_powers_of_tau_lagrange),
+            std::move(precomputed_g1_powers_of_tau),
+            std::move(precomputed_g1_powers_of_tau_lagrange));
+    pcs->set_compressed(compressed);
     return true;
   }
 
   static size_t EstimateSize(const PCS& pcs) {
-    return base::EstimateSize(pcs.g1_powers_of_tau(),
-                              pcs.g1_powers_of_tau_lagrange());
+    size_t size = 0;
+    if (pcs.HasPrecomputedBases()) {
+      size = base::EstimateSize(pcs.precomputed_g1_powers_of_tau(),
+                                pcs.precomputed_g1_powers_of_tau_lagrange());
+    }
+    if (pcs.compressed()) {
+      size_t num_points = pcs.g1_powers_of_tau().size() +
+                          pcs.g1_powers_of_tau_lagrange().size();
+      return size + 3 * sizeof(size_t) +
+             num_points * base::EstimateSize(CompressedG1Point());
+    }
+    if (pcs.HasPrecomputedBases()) size += sizeof(size_t);
+    return size + base::EstimateSize(pcs.g1_powers_of_tau(),
+                                     pcs.g1_powers_of_tau_lagrange());
   }
 };
 
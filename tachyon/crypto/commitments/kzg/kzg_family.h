@@ -10,7 +10,11 @@
 #include <stddef.h>
 
 #include <utility>
+#include <vector>
 
+#include "absl/types/span.h"
+
+#include "tachyon/base/containers/container_util.h"
 #include "tachyon/crypto/commitments/kzg/kzg.h"
 #include "tachyon/math/polynomials/univariate/univariate_evaluations.h"
 #include "tachyon/math/polynomials/univariate/univariate_polynomial.h"
@@ -27,6 +31,7 @@ class KZGFamily {
       : kzg_(std::move(kzg)) {}
 
   const KZG<G1Point, MaxDegree, Commitment>& kzg() const { return kzg_; }
+  KZG<G1Point, MaxDegree, Commitment>& kzg() { return kzg_; }
 
   size_t N() const { return kzg_.N(); }
 
@@ -87,6 +92,29 @@ class KZGFamily {
     return kzg_.CommitLagrange(evals.evaluations(), state, index);
   }
 
+  [[nodiscard]] bool DoBatchCommit(
+      absl::Span<const math::UnivariateDensePolynomial<F, MaxDegree>> polys,
+      BatchCommitmentState& state, size_t index) {
+    using Poly = math::UnivariateDensePolynomial<F, MaxDegree>;
+    return kzg_.BatchCommit(base::Map(polys,
+                                      [](const Poly& poly) {
+                                        return absl::MakeConstSpan(
+                                            poly.coefficients().coefficients());
+                                      }),
+                            state, index);
+  }
+
+  [[nodiscard]] bool DoBatchCommitLagrange(
+      absl::Span<const math::UnivariateEvaluations<F, MaxDegree>> evals_list,
+      BatchCommitmentState& state, size_t index) {
+    return kzg_.BatchCommitLagrange(
+        base::Map(evals_list,
+                  [](const math::UnivariateEvaluations<F, MaxDegree>& evals) {
+                    return absl::MakeConstSpan(evals.evaluations());
+                  }),
+        state, index);
+  }
+
  protected:
   [[nodiscard]] virtual bool DoUnsafeSetupWithTau(size_t size,
                                                   const F& tau) = 0;
@@ -1,8 +1,11 @@
 #include "tachyon/crypto/commitments/kzg/kzg.h"
 
+#include "absl/strings/substitute.h"
 #include "gtest/gtest.h"
 
 #include "tachyon/base/buffer/vector_buffer.h"
+#include "tachyon/base/files/file_util.h"
+#include "tachyon/base/files/scoped_temp_dir.h"
 #include "tachyon/math/elliptic_curves/bn/bn254/g1.h"
 #include "tachyon/math/polynomials/univariate/univariate_evaluation_domain_factory.h"
 
@@ -90,6 +93,75 @@ TEST_F(KZGTest, BatchCommitLagrange) {
   EXPECT_EQ(batch_commitments, batch_commitments_lagrange);
 }
 
+TEST_F(KZGTest, BatchCommit) {
+  PCS pcs;
+  ASSERT_TRUE(pcs.UnsafeSetup(N));
+
+  size_t num_polys = 10;
+  std::vector<Poly> polys =
+      base::CreateVector(num_polys, []() { return Poly::Random(N - 1); });
+  std::vector<std::vector<math::bn254::Fr>> coeffs_list =
+      base::Map(polys, [](const Poly& poly) {
+        return poly.coefficients().coefficients();
+      });
+  std::vector<math::bn254::G1AffinePoint> expected =
+      base::Map(coeffs_list,
+                [&pcs](const std::vector<math::bn254::Fr>& coeffs) {
+                  math::bn254::G1AffinePoint commit;
+                  CHECK(pcs.Commit(coeffs, &commit));
+                  return commit;
+                });
+
+  std::unique_ptr<Domain> domain = Domain::Create(N);
+  std::vector<std::vector<math::bn254::Fr>> evals_list =
+      base::Map(polys, [&domain](const Poly& poly) {
+        return domain->FFT(poly).evaluations();
+      });
+
+  for (bool precompute : {false, true}) {
+    SCOPED_TRACE(absl::Substitute("precompute: $0", precompute));
+    if (precompute) ASSERT_TRUE(pcs.PrecomputeBases(4));
+
+    std::vector<math::bn254::G1AffinePoint> commits;
+    ASSERT_TRUE(pcs.BatchCommit(coeffs_list, &commits));
+    EXPECT_EQ(commits, expected);
+
+    BatchCommitmentState state(true, num_polys + 1);
+    pcs.ResizeBatchCommitments(num_polys + 1);
+    ASSERT_TRUE(pcs.CommitLagrange(evals_list[0], state, 0));
+    ASSERT_TRUE(pcs.BatchCommitLagrange(evals_list, state, 1));
+    std::vector<math::bn254::G1AffinePoint> batch_commitments =
+        pcs.GetBatchCommitments(state);
+    EXPECT_EQ(batch_commitments[0], expected[0]);
+    EXPECT_EQ(absl::MakeConstSpan(batch_commitments).subspan(1),
+              absl::MakeConstSpan(expected));
+  }
+}
+
+TEST_F(KZGTest, CommitWithPrecomputedBases) {
+  PCS pcs;
+  ASSERT_TRUE(pcs.UnsafeSetup(N));
+
+  Poly poly = Poly::Random(N - 1);
+  std::unique_ptr<Domain> domain = Domain::Create(N);
+  Evals poly_evals = domain->FFT(poly);
+
+  math::bn254::G1AffinePoint expected;
+  ASSERT_TRUE(pcs.Commit(poly.coefficients().coefficients(), &expected));
+
+  ASSERT_FALSE(pcs.HasPrecomputedBases());
+  ASSERT_TRUE(pcs.PrecomputeBases(4));
+  ASSERT_TRUE(pcs.HasPrecomputedBases());
+
+  math::bn254::G1AffinePoint commit;
+  ASSERT_TRUE(pcs.Commit(poly.coefficients().coefficients(), &commit));
+  EXPECT_EQ(commit, expected);
+
+  math::bn254::G1AffinePoint commit_lagrange;
+  ASSERT_TRUE(pcs.CommitLagrange(poly_evals.evaluations(), &commit_lagrange));
+  EXPECT_EQ(commit_lagrange, expected);
+}
+
 TEST_F(KZGTest, Downsize) {
   PCS pcs;
   ASSERT_TRUE(pcs.UnsafeSetup(N));
@@ -98,6 +170,15 @@ TEST_F(KZGTest, Downsize) {
   EXPECT_EQ(pcs.N(), N / 2);
 }
 
+TEST_F(KZGTest, DownsizeWithPrecomputedBases) {
+  PCS pcs;
+  ASSERT_TRUE(pcs.UnsafeSetup(N));
+  ASSERT_TRUE(pcs.PrecomputeBases(2));
+  ASSERT_TRUE(pcs.Downsize(N / 2));
+  EXPECT_EQ(pcs.precomputed_g1_powers_of_tau().bases_size(), N / 2);
+  EXPECT_EQ(pcs.precomputed_g1_powers_of_tau_lagrange().bases_size(), N / 2);
+}
+
 TEST_F(KZGTest, Copyable) {
   PCS expected;
   ASSERT_TRUE(expected.UnsafeSetup(N));
@@ -115,6 +196,170 @@ TEST_F(KZGTest, Copyable) {
   EXPECT_EQ(expected.g1_powers_of_tau(), value.g1_powers_of_tau());
   EXPECT_EQ(expected.g1_powers_of_tau_lagrange(),
             value.g1_powers_of_tau_lagrange());
+  EXPECT_FALSE(value.HasPrecomputedBases());
+}
+
+TEST_F(KZGTest, CopyableOriginalForm) {
+  PCS expected;
+  ASSERT_TRUE(expected.UnsafeSetup(N));
+
+  // The form written before the precomputed bases were added.
+  base::Uint8VectorBuffer write_buf;
+  ASSERT_TRUE(
+      write_buf.Grow(base::EstimateSize(expected.g1_powers_of_tau(),
+                                        expected.g1_powers_of_tau_lagrange())));
+  ASSERT_TRUE(write_buf.WriteMany(expected.g1_powers_of_tau(),
+                                  expected.g1_powers_of_tau_lagrange()));
+  ASSERT_TRUE(write_buf.Done());
+
+  write_buf.set_buffer_offset(0);
+
+  PCS value;
+  ASSERT_TRUE(write_buf.Read(&value));
+
+  EXPECT_EQ(expected.g1_powers_of_tau(), value.g1_powers_of_tau());
+  EXPECT_EQ(expected.g1_powers_of_tau_lagrange(),
+            value.g1_powers_of_tau_lagrange());
+  EXPECT_FALSE(value.compressed());
+  EXPECT_FALSE(value.HasPrecomputedBases());
+  EXPECT_TRUE(write_buf.Done());
+}
+
+TEST_F(KZGTest, CopyableWithPrecomputedBases) {
+  PCS expected;
+  ASSERT_TRUE(expected.UnsafeSetup(N));
+  ASSERT_TRUE(expected.PrecomputeBases(3));
+
+  base::Uint8VectorBuffer write_buf;
+  ASSERT_TRUE(write_buf.Grow(base::EstimateSize(expected)));
+  ASSERT_TRUE(write_buf.Write(expected));
+  ASSERT_TRUE(write_buf.Done());
+
+  write_buf.set_buffer_offset(0);
+
+  PCS value;
+  ASSERT_TRUE(write_buf.Read(&value));
+
+  ASSERT_TRUE(value.HasPrecomputedBases());
+  EXPECT_EQ(expected.precomputed_g1_powers_of_tau().table(),
+            value.precomputed_g1_powers_of_tau().table());
+  EXPECT_EQ(expected.precomputed_g1_powers_of_tau_lagrange().table(),
+            value.precomputed_g1_powers_of_tau_lagrange().table());
+
+  expected.set_compressed(true);
+  base::Uint8VectorBuffer write_buf2;
+  ASSERT_TRUE(write_buf2.Grow(base::EstimateSize(expected)));
+  ASSERT_TRUE(write_buf2.Write(expected));
+  ASSERT_TRUE(write_buf2.Done());
+
+  write_buf2.set_buffer_offset(0);
+
+  ASSERT_TRUE(write_buf2.Read(&value));
+  EXPECT_TRUE(value.compressed());
+  EXPECT_EQ(expected.g1_powers_of_tau(), value.g1_powers_of_tau());
+  EXPECT_EQ(expected.precomputed_g1_powers_of_tau().table(),
+            value.precomputed_g1_powers_of_tau().table());
+}
+
+TEST_F(KZGTest, CopyableCompressed) {
+  PCS uncompressed;
+  ASSERT_TRUE(uncompressed.UnsafeSetup(N));
+  PCS expected = uncompressed;
+  expected.set_compressed(true);
+
+  base::Uint8VectorBuffer write_buf;
+  ASSERT_TRUE(write_buf.Grow(base::EstimateSize(expected)));
+  ASSERT_TRUE(write_buf.Write(expected));
+  ASSERT_TRUE(write_buf.Done());
+  EXPECT_LT(write_buf.buffer_len() * 3, base::EstimateSize(uncompressed) * 2);
+
+  write_buf.set_buffer_offset(0);
+
+  PCS value;
+  ASSERT_TRUE(write_buf.Read(&value));
+
+  EXPECT_TRUE(value.compressed());
+  EXPECT_EQ(expected.g1_powers_of_tau(), value.g1_powers_of_tau());
+  EXPECT_EQ(expected.g1_powers_of_tau_lagrange(),
+            value.g1_powers_of_tau_lagrange());
+
+  // The uncompressed form is still read.
+  base::Uint8VectorBuffer write_buf2;
+  ASSERT_TRUE(write_buf2.Grow(base::EstimateSize(uncompressed)));
+  ASSERT_TRUE(write_buf2.Write(uncompressed));
+  ASSERT_TRUE(write_buf2.Done());
+
+  write_buf2.set_buffer_offset(0);
+
+  ASSERT_TRUE(write_buf2.Read(&value));
+  EXPECT_FALSE(value.compressed());
+  EXPECT_EQ(expected.g1_powers_of_tau(), value.g1_powers_of_tau());
+}
+
+TEST_F(KZGTest, CommitStreaming) {
+  PCS pcs;
+  ASSERT_TRUE(pcs.UnsafeSetup(N));
+
+  base::Uint8VectorBuffer write_buf;
+  ASSERT_TRUE(write_buf.Grow(base::EstimateSize(pcs)));
+  ASSERT_TRUE(write_buf.Write(pcs));
+  ASSERT_TRUE(write_buf.Done());
+
+  base::ScopedTempDir temp_dir;
+  ASSERT_TRUE(temp_dir.CreateUniqueTempDir());
+  base::FilePath path = temp_dir.GetPath().Append("params");
+  ASSERT_TRUE(base::WriteFile(path, write_buf.owned_buffer()));
+
+  base::MemoryMappedFile file;
+  ASSERT_TRUE(file.Initialize(path));
+  PCS::MappedBases g1_powers_of_tau;
+  PCS::MappedBases g1_powers_of_tau_lagrange;
+  ASSERT_TRUE(
+      PCS::MapBases(&file, &g1_powers_of_tau, &g1_powers_of_tau_lagrange));
+
+  Poly poly = Poly::Random(N - 1);
+  math::bn254::G1AffinePoint expected;
+  ASSERT_TRUE(pcs.Commit(poly.coefficients().coefficients(), &expected));
+  math::bn254::G1AffinePoint commit;
+  ASSERT_TRUE(PCS::CommitStreaming(
+      g1_powers_of_tau, poly.coefficients().coefficients(), &commit, 3));
+  EXPECT_EQ(commit, expected);
+
+  std::unique_ptr<Domain> domain = Domain::Create(N);
+  Evals evals = domain->FFT(std::move(poly));
+  ASSERT_TRUE(pcs.CommitLagrange(evals.evaluations(), &expected));
+  ASSERT_TRUE(PCS::CommitStreaming(g1_powers_of_tau_lagrange,
+                                   evals.evaluations(), &commit, 3));
+  EXPECT_EQ(commit, expected);
+}
+
+TEST_F(KZGTest, MapBasesWithPrecomputedBases) {
+  PCS pcs;
+  ASSERT_TRUE(pcs.UnsafeSetup(N));
+  ASSERT_TRUE(pcs.PrecomputeBases(2));
+
+  base::Uint8VectorBuffer write_buf;
+  ASSERT_TRUE(write_buf.Grow(base::EstimateSize(pcs)));
+  ASSERT_TRUE(write_buf.Write(pcs));
+  ASSERT_TRUE(write_buf.Done());
+
+  base::ScopedTempDir temp_dir;
+  ASSERT_TRUE(temp_dir.CreateUniqueTempDir());
+  base::FilePath path = temp_dir.GetPath().Append("params");
+  ASSERT_TRUE(base::WriteFile(path, write_buf.owned_buffer()));
+
+  base::MemoryMappedFile file;
+  ASSERT_TRUE(file.Initialize(path));
+  PCS::MappedBases g1_powers_of_tau;
+  PCS::MappedBases g1_powers_of_tau_lagrange;
+  ASSERT_TRUE(
+      PCS::MapBases(&file, &g1_powers_of_tau, &g1_powers_of_tau_lagrange));
+
+  std::vector<math::bn254::G1AffinePoint> bases;
+  ASSERT_TRUE(g1_powers_of_tau.Read(0, N, &bases));
+  EXPECT_EQ(bases, pcs.g1_powers_of_tau());
+  ASSERT_TRUE(g1_powers_of_tau_lagrange.Read(0, N, &bases));
+  EXPECT_EQ(bases, pcs.g1_powers_of_tau_lagrange());
 }
 
 }  // namespace tachyon::crypto
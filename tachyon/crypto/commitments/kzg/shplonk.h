@@ -17,6 +17,9 @@
 #include "tachyon/crypto/commitments/polynomial_openings.h"
 #include "tachyon/crypto/commitments/univariate_polynomial_commitment_scheme.h"
 #include "tachyon/crypto/transcripts/transcript.h"
+#include "tachyon/math/elliptic_curves/msm/comb_fixed_base_msm.h"
+#include "tachyon/math/elliptic_curves/msm/wnaf.h"
+#include "tachyon/math/elliptic_curves/pairing/g2_prepared_cache.h"
 #include "tachyon/math/elliptic_curves/pairing/pairing.h"
 
 namespace tachyon {
@@ -44,6 +47,7 @@ class SHPlonk final : public UnivariatePolynomialCommitmentScheme<
   using G1Point = typename Curve::G1Curve::AffinePoint;
   using G2Point = typename Curve::G2Curve::AffinePoint;
   using G2Prepared = typename Curve::G2Prepared;
+  using G2PreparedCache = math::G2PreparedCache<Curve>;
   using Fp12 = typename Curve::Fp12;
   using Field = typename Base::Field;
   using Poly = typename Base::Poly;
@@ -56,8 +60,8 @@ class SHPlonk final : public UnivariatePolynomialCommitmentScheme<
   SHPlonk(KZG<G1Point, MaxDegree, Commitment>&& kzg, G2Point&& s_g2)
       : KZGFamily<G1Point, MaxDegree, Commitment>(std::move(kzg)),
         s_g2_(std::move(s_g2)),
-        g2_arr_({G2Prepared::From(G2Point::Generator()),
-                 G2Prepared::From(-s_g2)}) {}
+        g2_arr_({G2PreparedCache::GetInstance().Get(G2Point::Generator()),
+                 G2PreparedCache::GetInstance().Get(-s_g2_)}) {}
 
   const G2Point& s_g2() const { return s_g2_; }
 
@@ -230,6 +234,12 @@ class SHPlonk final : public UnivariatePolynomialCommitmentScheme<
       const Container& poly_openings,
       TranscriptReader<Commitment>* reader) const {
     using G1JacobianPoint = math::JacobianPoint<typename G1Point::Curve>;
+    // NOTE: The scalar multiplications below are done with
+    // CombFixedBaseMSM::GetGeneratorInstance() for the generator and
+    // math::WNAF for the others, which dominate the verification of a small
+    // proof.
+    const math::CombFixedBaseMSM<G1Point>& g1_generator_msm =
+        math::CombFixedBaseMSM<G1Point>::GetGeneratorInstance();
 
     Field y = reader->SqueezeChallenge();
     VLOG(2) << "SHPlonk(y): " << y.ToHexString(true);
@@ -312,12 +322,12 @@ class SHPlonk final : public UnivariatePolynomialCommitmentScheme<
       // |r_commitments₂| = [[R₄(u)]₁]
       std::vector<G1JacobianPoint> r_commitments = base::Map(
           poly_openings_vec,
-          [&points,
-           &u](const PolynomialOpenings<Poly, Commitment>& poly_openings) {
+          [&points, &u, &g1_generator_msm](
+              const PolynomialOpenings<Poly, Commitment>& poly_openings) {
             Poly r;
             CHECK(
                 math::LagrangeInterpolate(points, poly_openings.openings, &r));
-            return r.Evaluate(u) * G1Point::Generator();
+            return g1_generator_msm.ScalarMul(r.Evaluate(u));
           });
 
       // clang-format off
@@ -327,7 +337,7 @@ class SHPlonk final : public UnivariatePolynomialCommitmentScheme<
       // clang-format on
       G1JacobianPoint l_commitment = G1JacobianPoint::Zero();
       for (size_t j = commitments.size() - 1; j != SIZE_MAX; --j) {
-        l_commitment *= y;
+        l_commitment = math::WNAF<G1JacobianPoint>::Mul(l_commitment, y);
         l_commitment += (commitments[j] - r_commitments[j]);
       }
 
@@ -336,7 +346,8 @@ class SHPlonk final : public UnivariatePolynomialCommitmentScheme<
       // |normalized_l_commitments₁| = [L₁(𝜏)]₁ / Zᴛ\₀(u) = (C₁ - [R₁(u)]₁) * Zᴛ\₁(u) / Zᴛ\₀(u)
       // |normalized_l_commitments₂| = [L₂(𝜏)]₁ / Zᴛ\₀(u) = (C₂ - [R₂(u)]₁) * Zᴛ\₂(u) / Zᴛ\₀(u)
       // clang-format on
-      l_commitment *= normalized_z_diff;
+      l_commitment =
+          math::WNAF<G1JacobianPoint>::Mul(l_commitment, normalized_z_diff);
       normalized_l_commitments.push_back(std::move(l_commitment));
       ++i;
     }
@@ -348,8 +359,8 @@ class SHPlonk final : public UnivariatePolynomialCommitmentScheme<
         G1JacobianPoint::template LinearCombinationInPlace</*forward=*/false>(
             normalized_l_commitments, v);
 
-    p -= (first_z * h);
-    p += (u * q);
+    p -= math::WNAF<Commitment>::Mul(h, first_z);
+    p += math::WNAF<Commitment>::Mul(q, u);
 
     // clang-format off
     // e([Q(𝜏)]₁, [𝜏]₂) * e(p, [-1]₂) ≟ gᴛ⁰
@@ -366,8 +377,9 @@ class SHPlonk final : public UnivariatePolynomialCommitmentScheme<
   [[nodiscard]] bool DoUnsafeSetupWithTau(size_t size,
                                           const Field& tau) override {
     s_g2_ = (G2Point::Generator() * tau).ToAffine();
+    // NOTE: |s_g2_| is not cached, since it varies per setup.
     g2_arr_ = {G2Prepared::From(s_g2_),
-               G2Prepared::From(-G2Point::Generator())};
+               G2PreparedCache::GetInstance().Get(-G2Point::Generator())};
     return true;
   }
 
@@ -10,6 +10,7 @@
 
 #include <sstream>
 #include <string>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -17,6 +18,9 @@
 #include "tachyon/base/containers/container_util.h"
 #include "tachyon/base/strings/string_util.h"
 #include "tachyon/crypto/commitments/vector_commitment_scheme.h"
+#include "tachyon/math/elliptic_curves/affine_point.h"
+#include "tachyon/math/elliptic_curves/curve_type.h"
+#include "tachyon/math/elliptic_curves/msm/comb_fixed_base_msm.h"
 #include "tachyon/math/elliptic_curves/msm/variable_base_msm.h"
 #include "tachyon/math/elliptic_curves/point_conversions.h"
 
@@ -83,8 +87,31 @@ class Pedersen final
     // See
     // https://research.nccgroup.com/2023/03/22/breaking-pedersen-hashes-in-practice/
 
-    h_ = Point::Random();
-    generators_ = base::CreateVector(size, []() { return Point::Random(); });
+    if constexpr (Point::Curve::kType == math::CurveType::kShortWeierstrass) {
+      // Every point is a random multiple of the generator, so they are
+      // computed at once with the comb tables of the generator.
+      using AffinePoint = math::AffinePoint<typename Point::Curve>;
+      math::CombFixedBaseMSM<AffinePoint> msm;
+      msm.Reset(AffinePoint::Generator());
+      std::vector<Field> scalars =
+          base::CreateVector(size + 1, []() { return Field::Random(); });
+      std::vector<AffinePoint> points(size + 1);
+      if (!msm.Run(scalars, &points)) return false;
+      if constexpr (std::is_same_v<Point, AffinePoint>) {
+        h_ = points.back();
+        points.pop_back();
+        generators_ = std::move(points);
+      } else {
+        h_ = math::ConvertPoint<Point>(points.back());
+        points.pop_back();
+        generators_ = base::Map(points, [](const AffinePoint& point) {
+          return math::ConvertPoint<Point>(point);
+        });
+      }
+    } else {
+      h_ = Point::Random();
+      generators_ = base::CreateVector(size, []() { return Point::Random(); });
+    }
     return true;
   }
 
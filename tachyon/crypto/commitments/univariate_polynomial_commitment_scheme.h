@@ -3,6 +3,8 @@
 
 #include <stddef.h>
 
+#include "absl/types/span.h"
+
 #include "tachyon/crypto/commitments/vector_commitment_scheme.h"
 #include "tachyon/math/polynomials/univariate/univariate_evaluations.h"
 #include "tachyon/math/polynomials/univariate/univariate_polynomial.h"
@@ -64,6 +66,34 @@ class UnivariatePolynomialCommitmentScheme
     return derived->DoCommitLagrange(evals, derived->batch_commitment_state(),
                                      index);
   }
+
+  // Commit to each of |polys| and stores the commitments in
+  // |batch_commitments_| from |index| if |batch_mode| is true. The MSMs share
+  // the same bases, so they are computed together. Return false if the degree
+  // of any of |polys| exceeds |kMaxDegree|. It terminates when |batch_mode| is
+  // false.
+  template <typename T = Derived, std::enable_if_t<VectorCommitmentSchemeTraits<
+                                      T>::kSupportsBatchMode>* = nullptr>
+  [[nodiscard]] bool BatchCommit(absl::Span<const Poly> polys, size_t index) {
+    Derived* derived = static_cast<Derived*>(this);
+    CHECK(derived->GetBatchMode());
+    return derived->DoBatchCommit(polys, derived->batch_commitment_state(),
+                                  index);
+  }
+
+  // Commit to each of |evals_list| and stores the commitments in
+  // |batch_commitments_| from |index| if |batch_mode| is true. Return false if
+  // the degree of any of |evals_list| exceeds |kMaxDegree|. It terminates when
+  // |batch_mode| is false.
+  template <typename T = Derived, std::enable_if_t<VectorCommitmentSchemeTraits<
+                                      T>::kSupportsBatchMode>* = nullptr>
+  [[nodiscard]] bool BatchCommitLagrange(absl::Span<const Evals> evals_list,
+                                         size_t index) {
+    Derived* derived = static_cast<Derived*>(this);
+    CHECK(derived->GetBatchMode());
+    return derived->DoBatchCommitLagrange(
+        evals_list, derived->batch_commitment_state(), index);
+  }
 };
 
 }  // namespace tachyon::crypto
@@ -0,0 +1,114 @@
+#ifndef TACHYON_CRYPTO_SIGNATURES_BATCH_VERIFICATION_UTIL_H_
+#define TACHYON_CRYPTO_SIGNATURES_BATCH_VERIFICATION_UTIL_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <vector>
+
+#include "openssl/rand.h"
+
+#include "tachyon/base/logging.h"
+#include "tachyon/base/openmp_util.h"
+#include "tachyon/math/base/big_int.h"
+#include "tachyon/math/elliptic_curves/msm/algorithms/pippenger/pippenger_adapter.h"
+#include "tachyon/math/elliptic_curves/msm/glv.h"
+#include "tachyon/math/elliptic_curves/short_weierstrass/compressed_affine_point.h"
+
+namespace tachyon::crypto::internal {
+
+// The bit length of the random weights that combine the verification
+// equations of a batch. A batch with an invalid signature passes with a
+// probability of at most 2⁻¹²⁸. The weights are shorter than the scalar
+// field, so the terms they multiply are cheaper in the MSM.
+constexpr size_t kBatchWeightBits = 128;
+
+// Returns |num| random weights of |kBatchWeightBits| bits. The weights must be
+// unpredictable to whoever made the signatures, or invalid signatures could be
+// crafted to cancel each other out. So they are drawn from the CSPRNG of
+// BoringSSL rather than base::Uniform().
+template <typename ScalarField>
+std::vector<ScalarField> CreateBatchWeights(size_t num) {
+  constexpr size_t N = ScalarField::N;
+  constexpr size_t kLimbNums = kBatchWeightBits / 64;
+  static_assert(N > kLimbNums);
+
+  std::vector<uint64_t> limbs(num * kLimbNums);
+  CHECK(RAND_bytes(reinterpret_cast<uint8_t*>(limbs.data()),
+                   limbs.size() * sizeof(uint64_t)));
+
+  std::vector<ScalarField> weights;
+  weights.reserve(num);
+  for (size_t i = 0; i < num; ++i) {
+    math::BigInt<N> weight;
+    for (size_t j = 0; j < kLimbNums; ++j) {
+      weight[j] = limbs[i * kLimbNums + j];
+    }
+    weights.push_back(ScalarField::FromBigInt(weight));
+  }
+  return weights;
+}
+
+// Reduces |value|, e.g., an x-coordinate or a hash, modulo the order of the
+// scalar field. It assumes |value| is less than twice the order, which holds
+// for the prime order curves whose base field is of the same size, e.g.,
+// secp256k1.
+template <typename ScalarField>
+ScalarField ReduceToScalarField(math::BigInt<ScalarField::N> value) {
+  if (value >= ScalarField::Config::kModulus) {
+    value -= ScalarField::Config::kModulus;
+  }
+  return ScalarField::FromBigInt(value);
+}
+
+// Lifts |compressed_points| to |points|. The square roots are computed at
+// once with CompressedAffinePoint::BatchDecompress() and, only if some of the
+// x-coordinates are not on the curve, one by one. |lifted[i]| is set to
+// whether |compressed_points[i]| is lifted.
+template <typename Curve>
+void BatchLiftX(
+    const std::vector<math::CompressedAffinePoint<Curve>>& compressed_points,
+    std::vector<math::AffinePoint<Curve>>* points,
+    std::vector<uint8_t>* lifted) {
+  size_t size = compressed_points.size();
+  lifted->resize(size);
+  if (math::CompressedAffinePoint<Curve>::BatchDecompress(compressed_points,
+                                                          points)) {
+    std::fill(lifted->begin(), lifted->end(), 1);
+    return;
+  }
+  points->resize(size);
+  OPENMP_PARALLEL_FOR(size_t i = 0; i < size; ++i) {
+    (*lifted)[i] = compressed_points[i].Decompress(&(*points)[i]);
+  }
+}
+
+// Returns |scalar| * |point|, which is split with GLV if the curve supports it.
+template <typename AffinePoint, typename ScalarField>
+auto ScalarMul(const AffinePoint& point, const ScalarField& scalar) {
+  if constexpr (math::kSupportsGLV<AffinePoint>) {
+    return math::GLV<AffinePoint>::Mul(point, scalar);
+  } else {
+    return point * scalar;
+  }
+}
+
+// Returns true if ∑ᵢ |scalars[i]| * |bases[i]| is the point at infinity. The
+// MSM splits the scalars with GLV if the curve supports it.
+template <typename AffinePoint, typename ScalarField>
+bool IsMSMZero(const std::vector<AffinePoint>& bases,
+               const std::vector<ScalarField>& scalars) {
+  using Bucket = typename math::PippengerAdapter<AffinePoint>::Bucket;
+
+  math::PippengerAdapter<AffinePoint> pippenger;
+  pippenger.SetUseGLV(true);
+  Bucket ret;
+  CHECK(pippenger.Run(bases.begin(), bases.end(), scalars.begin(),
+                      scalars.end(), &ret));
+  return ret.IsZero();
+}
+
+}  // namespace tachyon::crypto::internal
+
+#endif  // TACHYON_CRYPTO_SIGNATURES_BATCH_VERIFICATION_UTIL_H_
@@ -0,0 +1,180 @@
+#ifndef TACHYON_CRYPTO_SIGNATURES_ECDSA_H_
+#define TACHYON_CRYPTO_SIGNATURES_ECDSA_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <utility>
+#include <vector>
+
+#include "absl/types/span.h"
+
+#include "tachyon/base/logging.h"
+#include "tachyon/base/openmp_util.h"
+#include "tachyon/crypto/signatures/batch_verification_util.h"
+#include "tachyon/math/elliptic_curves/short_weierstrass/compressed_affine_point.h"
+
+namespace tachyon::crypto {
+
+template <typename ScalarField>
+struct ECDSASignature {
+  ScalarField r;
+  ScalarField s;
+  // The bit 0 is the parity of y of R and the bit 1 tells whether x of R is
+  // r + n, where n is the order of the scalar field, as in the signatures of
+  // Ethereum. It is only used by ECDSAVerifier::BatchVerify().
+  uint8_t recovery_id = 0;
+};
+
+// ECDSAVerifier verifies ECDSA signatures over the short weierstrass curve of
+// |AffinePoint|, e.g., secp256k1. The message hashes are given as the scalar
+// field elements, i.e., the hashes truncated to the bit length of the scalar
+// field and reduced.
+template <typename AffinePoint>
+class ECDSAVerifier {
+ public:
+  using Curve = typename AffinePoint::Curve;
+  using BaseField = typename AffinePoint::BaseField;
+  using ScalarField = typename AffinePoint::ScalarField;
+  using Signature = ECDSASignature<ScalarField>;
+  using CompressedPoint = math::CompressedAffinePoint<Curve>;
+
+  // Returns true if |signature| of |message_hash| is valid under
+  // |public_key|. It checks if x of u₁ * G + u₂ * Q is r modulo n, where
+  // u₁ = z * s⁻¹ and u₂ = r * s⁻¹. The recovery id is not used.
+  static bool Verify(const AffinePoint& public_key,
+                     const ScalarField& message_hash,
+                     const Signature& signature) {
+    if (!IsWellFormed(public_key, signature)) return false;
+    ScalarField s_inv = signature.s.Inverse();
+    return DoVerify(public_key, message_hash, signature, s_inv);
+  }
+
+  // Verifies all of |signatures| at once and returns true if all of them are
+  // valid. Otherwise, |invalid_indices| is populated with the indices of the
+  // invalid ones in ascending order.
+  //
+  // With R recovered from r and the recovery id, a valid signature satisfies
+  // u₁ * G + u₂ * Q - R = 0. The equations are combined with random weights
+  // aᵢ into a single MSM of size 2N + 1:
+  //
+  //   (∑ᵢ aᵢ * u₁ᵢ) * G + ∑ᵢ (aᵢ * u₂ᵢ) * Qᵢ + ∑ᵢ aᵢ * (-Rᵢ) = 0
+  //
+  // s⁻¹ are inverted in a batch and R are recovered with a batched square
+  // root. If the MSM is not zero, the signatures are verified one by one with
+  // Verify() to locate the invalid ones. NOTE: A signature whose recovery id
+  // is wrong, including the one whose r + n is not less than the modulus of
+  // the base field, fails the MSM or is left out of it, but is reported
+  // valid by the fallback, like Verify().
+  [[nodiscard]] static bool BatchVerify(
+      absl::Span<const AffinePoint> public_keys,
+      absl::Span<const ScalarField> message_hashes,
+      absl::Span<const Signature> signatures,
+      std::vector<size_t>* invalid_indices) {
+    size_t size = signatures.size();
+    CHECK_EQ(public_keys.size(), size);
+    CHECK_EQ(message_hashes.size(), size);
+    invalid_indices->clear();
+
+    std::vector<uint8_t> well_formed(size);
+    std::vector<uint8_t> has_rx(size);
+    std::vector<ScalarField> s_invs(size);
+    std::vector<CompressedPoint> compressed_rs(size);
+    OPENMP_PARALLEL_FOR(size_t i = 0; i < size; ++i) {
+      const Signature& signature = signatures[i];
+      well_formed[i] = IsWellFormed(public_keys[i], signature);
+      // NOTE: If x of R can't be computed from the recovery id, the signature
+      // is treated like the one whose R is not lifted, so that it is left to
+      // the fallback, which doesn't use the recovery id.
+      BaseField x;
+      has_rx[i] = well_formed[i] && ComputeRx(signature, &x);
+      // NOTE: Zero s is replaced with one, so that it doesn't break the batch
+      // inversion. The signature is not well-formed anyway.
+      s_invs[i] = signature.s.IsZero() ? ScalarField::One() : signature.s;
+      if (has_rx[i]) {
+        compressed_rs[i] = CompressedPoint(
+            std::move(x),
+            (signature.recovery_id & 1) ? uint8_t{CompressedPoint::kYIsOdd}
+                                        : uint8_t{0});
+      }
+    }
+    CHECK(ScalarField::BatchInverseInPlace(s_invs));
+
+    std::vector<AffinePoint> rs;
+    std::vector<uint8_t> lifted;
+    internal::BatchLiftX(compressed_rs, &rs, &lifted);
+
+    std::vector<ScalarField> weights =
+        internal::CreateBatchWeights<ScalarField>(size);
+    std::vector<AffinePoint> bases(2 * size + 1, AffinePoint::Zero());
+    std::vector<ScalarField> scalars(2 * size + 1, ScalarField::Zero());
+    std::vector<ScalarField> generator_scalars(size, ScalarField::Zero());
+    OPENMP_PARALLEL_FOR(size_t i = 0; i < size; ++i) {
+      if (!has_rx[i] || !lifted[i]) continue;
+      const ScalarField& weight = weights[i];
+      ScalarField weighted_s_inv = weight * s_invs[i];
+      generator_scalars[i] = weighted_s_inv * message_hashes[i];
+      bases[2 * i + 1] = public_keys[i];
+      scalars[2 * i + 1] = weighted_s_inv * signatures[i].r;
+      bases[2 * i + 2] = -rs[i];
+      scalars[2 * i + 2] = weight;
+    }
+    bases[0] = AffinePoint::Generator();
+    for (const ScalarField& generator_scalar : generator_scalars) {
+      scalars[0] += generator_scalar;
+    }
+    bool batch_valid = internal::IsMSMZero(bases, scalars);
+
+    std::vector<uint8_t> valid(size);
+    OPENMP_PARALLEL_FOR(size_t i = 0; i < size; ++i) {
+      if (!well_formed[i]) {
+        valid[i] = false;
+      } else if (batch_valid && has_rx[i] && lifted[i]) {
+        valid[i] = true;
+      } else {
+        valid[i] = DoVerify(public_keys[i], message_hashes[i], signatures[i],
+                            s_invs[i]);
+      }
+    }
+    for (size_t i = 0; i < size; ++i) {
+      if (!valid[i]) invalid_indices->push_back(i);
+    }
+    return invalid_indices->empty();
+  }
+
+ private:
+  static bool IsWellFormed(const AffinePoint& public_key,
+                           const Signature& signature) {
+    return !public_key.infinity() && !signature.r.IsZero() &&
+           !signature.s.IsZero();
+  }
+
+  // Computes x of R from r and the recovery id. Returns false if it is not
+  // less than the modulus of the base field.
+  static bool ComputeRx(const Signature& signature, BaseField* x) {
+    math::BigInt<BaseField::N> value = signature.r.ToBigInt();
+    if (signature.recovery_id & 2) {
+      uint64_t carry = 0;
+      value.AddInPlace(ScalarField::Config::kModulus, carry);
+      if (carry) return false;
+    }
+    if (value >= BaseField::Config::kModulus) return false;
+    *x = BaseField::FromBigInt(value);
+    return true;
+  }
+
+  static bool DoVerify(const AffinePoint& public_key,
+                       const ScalarField& message_hash,
+                       const Signature& signature, const ScalarField& s_inv) {
+    auto r_prime = internal::ScalarMul(AffinePoint::Generator(),
+                                       message_hash * s_inv) +
+                   internal::ScalarMul(public_key, signature.r * s_inv);
+    if (r_prime.IsZero()) return false;
+    return internal::ReduceToScalarField<ScalarField>(
+               r_prime.ToAffine().x().ToBigInt()) == signature.r;
+  }
+};
+
+}  // namespace tachyon::crypto
+
+#endif  // TACHYON_CRYPTO_SIGNATURES_ECDSA_H_
@@ -0,0 +1,103 @@
+#include "tachyon/crypto/signatures/ecdsa.h"
+
+#include <vector>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include "tachyon/math/elliptic_curves/secp/secp256k1/curve.h"
+
+namespace tachyon::crypto {
+
+namespace {
+
+using AffinePoint = math::secp256k1::AffinePoint;
+using BaseField = AffinePoint::BaseField;
+using ScalarField = AffinePoint::ScalarField;
+using Verifier = ECDSAVerifier<AffinePoint>;
+using Signature = Verifier::Signature;
+
+class ECDSATest : public testing::Test {
+ public:
+  constexpr static size_t kSize = 32;
+
+  static void SetUpTestSuite() { math::secp256k1::Curve::Init(); }
+
+  void SetUp() override {
+    for (size_t i = 0; i < kSize; ++i) {
+      ScalarField private_key = ScalarField::Random();
+      public_keys_.push_back(
+          (AffinePoint::Generator() * private_key).ToAffine());
+      message_hashes_.push_back(ScalarField::Random());
+      signatures_.push_back(Sign(private_key, message_hashes_.back()));
+    }
+  }
+
+  static Signature Sign(const ScalarField& private_key,
+                        const ScalarField& message_hash) {
+    ScalarField k = ScalarField::Random();
+    AffinePoint r = (AffinePoint::Generator() * k).ToAffine();
+    Signature signature;
+    signature.r =
+        internal::ReduceToScalarField<ScalarField>(r.x().ToBigInt());
+    signature.s = k.Inverse() * (message_hash + signature.r * private_key);
+    signature.recovery_id =
+        (r.y().ToBigInt().IsOdd() ? 1 : 0) |
+        (r.x().ToBigInt() >= ScalarField::Config::kModulus ? 2 : 0);
+    return signature;
+  }
+
+ protected:
+  std::vector<AffinePoint> public_keys_;
+  std::vector<ScalarField> message_hashes_;
+  std::vector<Signature> signatures_;
+};
+
+}  // namespace
+
+TEST_F(ECDSATest, Verify) {
+  EXPECT_TRUE(
+      Verifier::Verify(public_keys_[0], message_hashes_[0], signatures_[0]));
+  EXPECT_FALSE(
+      Verifier::Verify(public_keys_[0], message_hashes_[1], signatures_[0]));
+  EXPECT_FALSE(
+      Verifier::Verify(public_keys_[1], message_hashes_[0], signatures_[0]));
+
+  Signature signature = signatures_[0];
+  signature.s = ScalarField::Zero();
+  EXPECT_FALSE(
+      Verifier::Verify(public_keys_[0], message_hashes_[0], signature));
+}
+
+TEST_F(ECDSATest, BatchVerify) {
+  std::vector<size_t> invalid_indices;
+  EXPECT_TRUE(Verifier::BatchVerify(public_keys_, message_hashes_, signatures_,
+                                    &invalid_indices));
+  EXPECT_TRUE(invalid_indices.empty());
+
+  EXPECT_TRUE(Verifier::BatchVerify({}, {}, {}, &invalid_indices));
+}
+
+TEST_F(ECDSATest, BatchVerifyWithInvalidSignatures) {
+  message_hashes_[3] = ScalarField::Random();
+  signatures_[10].s = ScalarField::Zero();
+  public_keys_[17] = AffinePoint::Random();
+  // A wrong recovery id fails the MSM, but the signature itself is valid.
+  signatures_[20].recovery_id ^= 1;
+  // So does a recovery id that tells x of R is r + n, while r + n is not
+  // less than the modulus of the base field.
+  signatures_[25].recovery_id |= 2;
+  math::BigInt<BaseField::N> rx = signatures_[25].r.ToBigInt();
+  uint64_t carry = 0;
+  rx.AddInPlace(ScalarField::Config::kModulus, carry);
+  ASSERT_TRUE(carry || rx >= BaseField::Config::kModulus);
+  ASSERT_TRUE(
+      Verifier::Verify(public_keys_[25], message_hashes_[25], signatures_[25]));
+
+  std::vector<size_t> invalid_indices;
+  EXPECT_FALSE(Verifier::BatchVerify(public_keys_, message_hashes_,
+                                     signatures_, &invalid_indices));
+  EXPECT_THAT(invalid_indices, testing::ElementsAre(3, 10, 17));
+}
+
+}  // namespace tachyon::crypto
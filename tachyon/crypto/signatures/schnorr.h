@@ -0,0 +1,178 @@
+#ifndef TACHYON_CRYPTO_SIGNATURES_SCHNORR_H_
+#define TACHYON_CRYPTO_SIGNATURES_SCHNORR_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <array>
+#include <string_view>
+#include <vector>
+
+#include "absl/types/span.h"
+#include "openssl/sha.h"
+
+#include "tachyon/base/logging.h"
+#include "tachyon/base/openmp_util.h"
+#include "tachyon/crypto/signatures/batch_verification_util.h"
+#include "tachyon/math/elliptic_curves/short_weierstrass/compressed_affine_point.h"
+
+namespace tachyon::crypto {
+
+template <typename BaseField, typename ScalarField>
+struct SchnorrSignature {
+  // x of R.
+  BaseField r;
+  ScalarField s;
+};
+
+// SchnorrVerifier verifies the BIP-340 Schnorr signatures over secp256k1.
+// The public keys are x-only and R and P are the points with even y.
+// See https://github.com/bitcoin/bips/blob/master/bip-0340.mediawiki.
+//
+// The signatures and the public keys are given as the field elements, so the
+// range checks of r < p, s < n and x of P < p belong to the deserialization.
+template <typename AffinePoint>
+class SchnorrVerifier {
+ public:
+  using Curve = typename AffinePoint::Curve;
+  using BaseField = typename AffinePoint::BaseField;
+  using ScalarField = typename AffinePoint::ScalarField;
+  using Signature = SchnorrSignature<BaseField, ScalarField>;
+  using CompressedPoint = math::CompressedAffinePoint<Curve>;
+
+  static_assert(BaseField::BigIntTy::kByteNums == 32 &&
+                    ScalarField::BigIntTy::kByteNums == 32,
+                "BIP-340 is defined over 32 byte fields");
+
+  // Returns e = int(hash_BIP0340/challenge(bytes(r) || bytes(P) || m)) mod n.
+  static ScalarField ComputeChallenge(const BaseField& r,
+                                      const BaseField& public_key,
+                                      absl::Span<const uint8_t> message) {
+    static const std::array<uint8_t, SHA256_DIGEST_LENGTH> kTagHash =
+        ComputeTagHash("BIP0340/challenge");
+
+    SHA256_CTX state;
+    SHA256_Init(&state);
+    SHA256_Update(&state, kTagHash.data(), kTagHash.size());
+    SHA256_Update(&state, kTagHash.data(), kTagHash.size());
+    SHA256_Update(&state, r.ToBigInt().ToBytesBE().data(), 32);
+    SHA256_Update(&state, public_key.ToBigInt().ToBytesBE().data(), 32);
+    SHA256_Update(&state, message.data(), message.size());
+    std::array<uint8_t, SHA256_DIGEST_LENGTH> hash;
+    SHA256_Final(hash.data(), &state);
+    return internal::ReduceToScalarField<ScalarField>(
+        BaseField::BigIntTy::FromBytesBE(hash));
+  }
+
+  // Returns true if |signature| of |message| is valid under |public_key|. It
+  // checks if R = s * G - e * P has even y and x of R is r.
+  static bool Verify(const BaseField& public_key,
+                     absl::Span<const uint8_t> message,
+                     const Signature& signature) {
+    AffinePoint p;
+    if (!CompressedPoint(public_key, 0).Decompress(&p)) return false;
+    return DoVerify(p, public_key, message, signature);
+  }
+
+  // Verifies all of |signatures| at once and returns true if all of them are
+  // valid. Otherwise, |invalid_indices| is populated with the indices of the
+  // invalid ones in ascending order.
+  //
+  // With R lifted from r, a valid signature satisfies s * G - e * P - R = 0.
+  // The equations are combined with random weights aᵢ into a single MSM of
+  // size 2N + 1, as in BIP-340 batch verification:
+  //
+  //   (∑ᵢ aᵢ * sᵢ) * G + ∑ᵢ (aᵢ * eᵢ) * (-Pᵢ) + ∑ᵢ aᵢ * (-Rᵢ) = 0
+  //
+  // P and R are lifted with a batched square root. If the MSM is not zero,
+  // the signatures are verified one by one with Verify() to locate the
+  // invalid ones.
+  [[nodiscard]] static bool BatchVerify(
+      absl::Span<const BaseField> public_keys,
+      absl::Span<const absl::Span<const uint8_t>> messages,
+      absl::Span<const Signature> signatures,
+      std::vector<size_t>* invalid_indices) {
+    size_t size = signatures.size();
+    CHECK_EQ(public_keys.size(), size);
+    CHECK_EQ(messages.size(), size);
+    invalid_indices->clear();
+
+    // NOTE: P and R are lifted together, i.e., |points[2 * i]| is Pᵢ and
+    // |points[2 * i + 1]| is Rᵢ.
+    std::vector<CompressedPoint> compressed_points(2 * size);
+    std::vector<ScalarField> challenges(size);
+    OPENMP_PARALLEL_FOR(size_t i = 0; i < size; ++i) {
+      compressed_points[2 * i] = CompressedPoint(public_keys[i], 0);
+      compressed_points[2 * i + 1] = CompressedPoint(signatures[i].r, 0);
+      challenges[i] =
+          ComputeChallenge(signatures[i].r, public_keys[i], messages[i]);
+    }
+    std::vector<AffinePoint> points;
+    std::vector<uint8_t> lifted;
+    internal::BatchLiftX(compressed_points, &points, &lifted);
+
+    std::vector<ScalarField> weights =
+        internal::CreateBatchWeights<ScalarField>(size);
+    std::vector<AffinePoint> bases(2 * size + 1, AffinePoint::Zero());
+    std::vector<ScalarField> scalars(2 * size + 1, ScalarField::Zero());
+    std::vector<ScalarField> generator_scalars(size, ScalarField::Zero());
+    OPENMP_PARALLEL_FOR(size_t i = 0; i < size; ++i) {
+      if (!lifted[2 * i] || !lifted[2 * i + 1]) continue;
+      const ScalarField& weight = weights[i];
+      generator_scalars[i] = weight * signatures[i].s;
+      bases[2 * i + 1] = -points[2 * i];
+      scalars[2 * i + 1] = weight * challenges[i];
+      bases[2 * i + 2] = -points[2 * i + 1];
+      scalars[2 * i + 2] = weight;
+    }
+    bases[0] = AffinePoint::Generator();
+    for (const ScalarField& generator_scalar : generator_scalars) {
+      scalars[0] += generator_scalar;
+    }
+    bool batch_valid = internal::IsMSMZero(bases, scalars);
+
+    std::vector<uint8_t> valid(size);
+    OPENMP_PARALLEL_FOR(size_t i = 0; i < size; ++i) {
+      if (!lifted[2 * i]) {
+        valid[i] = false;
+      } else if (batch_valid && lifted[2 * i + 1]) {
+        valid[i] = true;
+      } else {
+        valid[i] = DoVerify(points[2 * i], challenges[i], signatures[i]);
+      }
+    }
+    for (size_t i = 0; i < size; ++i) {
+      if (!valid[i]) invalid_indices->push_back(i);
+    }
+    return invalid_indices->empty();
+  }
+
+ private:
+  static std::array<uint8_t, SHA256_DIGEST_LENGTH> ComputeTagHash(
+      std::string_view tag) {
+    std::array<uint8_t, SHA256_DIGEST_LENGTH> ret;
+    SHA256(reinterpret_cast<const uint8_t*>(tag.data()), tag.size(),
+           ret.data());
+    return ret;
+  }
+
+  static bool DoVerify(const AffinePoint& p, const BaseField& public_key,
+                       absl::Span<const uint8_t> message,
+                       const Signature& signature) {
+    return DoVerify(p, ComputeChallenge(signature.r, public_key, message),
+                    signature);
+  }
+
+  static bool DoVerify(const AffinePoint& p, const ScalarField& challenge,
+                       const Signature& signature) {
+    auto r = internal::ScalarMul(AffinePoint::Generator(), signature.s) -
+             internal::ScalarMul(p, challenge);
+    if (r.IsZero()) return false;
+    AffinePoint r_affine = r.ToAffine();
+    return !Curve::IsOdd(r_affine.y()) && r_affine.x() == signature.r;
+  }
+};
+
+}  // namespace tachyon::crypto
+
+#endif  // TACHYON_CRYPTO_SIGNATURES_SCHNORR_H_
@@ -0,0 +1,120 @@
+#include "tachyon/crypto/signatures/schnorr.h"
+
+#include <vector>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include "tachyon/math/elliptic_curves/secp/secp256k1/curve.h"
+
+namespace tachyon::crypto {
+
+namespace {
+
+using AffinePoint = math::secp256k1::AffinePoint;
+using BaseField = AffinePoint::BaseField;
+using ScalarField = AffinePoint::ScalarField;
+using Verifier = SchnorrVerifier<AffinePoint>;
+using Signature = Verifier::Signature;
+
+class SchnorrTest : public testing::Test {
+ public:
+  constexpr static size_t kSize = 32;
+
+  static void SetUpTestSuite() { math::secp256k1::Curve::Init(); }
+
+  void SetUp() override {
+    for (size_t i = 0; i < kSize; ++i) {
+      ScalarField private_key = ScalarField::Random();
+      messages_.push_back(std::vector<uint8_t>(i, static_cast<uint8_t>(i)));
+      BaseField public_key;
+      signatures_.push_back(Sign(private_key, messages_.back(), &public_key));
+      public_keys_.push_back(public_key);
+    }
+  }
+
+  std::vector<absl::Span<const uint8_t>> GetMessageSpans() const {
+    std::vector<absl::Span<const uint8_t>> ret;
+    for (const std::vector<uint8_t>& message : messages_) {
+      ret.push_back(message);
+    }
+    return ret;
+  }
+
+  // See https://github.com/bitcoin/bips/blob/master/bip-0340/reference.py.
+  static Signature Sign(ScalarField private_key,
+                        absl::Span<const uint8_t> message,
+                        BaseField* public_key) {
+    AffinePoint p = (AffinePoint::Generator() * private_key).ToAffine();
+    if (p.y().ToBigInt().IsOdd()) private_key.NegInPlace();
+    *public_key = p.x();
+
+    ScalarField k = ScalarField::Random();
+    AffinePoint r = (AffinePoint::Generator() * k).ToAffine();
+    if (r.y().ToBigInt().IsOdd()) k.NegInPlace();
+    ScalarField e = Verifier::ComputeChallenge(r.x(), p.x(), message);
+    return {r.x(), k + e * private_key};
+  }
+
+ protected:
+  std::vector<BaseField> public_keys_;
+  std::vector<std::vector<uint8_t>> messages_;
+  std::vector<Signature> signatures_;
+};
+
+}  // namespace
+
+TEST_F(SchnorrTest, TestVector) {
+  // Index 0 of
+  // https://github.com/bitcoin/bips/blob/master/bip-0340/test-vectors.csv.
+  BaseField public_key = BaseField::FromHexString(
+      "F9308A019258C31049344F85F89D5229B531C845836F99B08601F113BCE036F9");
+  std::vector<uint8_t> message(32, 0);
+  Signature signature = {
+      BaseField::FromHexString(
+          "E907831F80848D1069A5371B402410364BDF1C5F8307B0084C55F1CE2DCA8215"),
+      ScalarField::FromHexString(
+          "25F66A4A85EA8B71E482A74F382D2CE5EBEEE8FDB2172F477DF4900D310536C0"),
+  };
+  EXPECT_TRUE(Verifier::Verify(public_key, message, signature));
+
+  message[0] = 1;
+  EXPECT_FALSE(Verifier::Verify(public_key, message, signature));
+}
+
+TEST_F(SchnorrTest, Verify) {
+  EXPECT_TRUE(Verifier::Verify(public_keys_[1], messages_[1], signatures_[1]));
+  EXPECT_FALSE(
+      Verifier::Verify(public_keys_[1], messages_[2], signatures_[1]));
+  EXPECT_FALSE(
+      Verifier::Verify(public_keys_[2], messages_[1], signatures_[1]));
+}
+
+TEST_F(SchnorrTest, BatchVerify) {
+  std::vector<size_t> invalid_indices;
+  EXPECT_TRUE(Verifier::BatchVerify(public_keys_, GetMessageSpans(),
+                                    signatures_, &invalid_indices));
+  EXPECT_TRUE(invalid_indices.empty());
+
+  EXPECT_TRUE(Verifier::BatchVerify({}, {}, {}, &invalid_indices));
+}
+
+TEST_F(SchnorrTest, BatchVerifyWithInvalidSignatures) {
+  messages_[3].push_back(0);
+  signatures_[10].s += ScalarField::One();
+  // R is not on the curve.
+  BaseField x = BaseField::Random();
+  AffinePoint point;
+  while (math::CompressedAffinePoint<AffinePoint::Curve>(x, 0).Decompress(
+      &point)) {
+    x = BaseField::Random();
+  }
+  signatures_[17].r = x;
+
+  std::vector<size_t> invalid_indices;
+  EXPECT_FALSE(Verifier::BatchVerify(public_keys_, GetMessageSpans(),
+                                     signatures_, &invalid_indices));
+  EXPECT_THAT(invalid_indices, testing::ElementsAre(3, 10, 17));
+}
+
+}  // namespace tachyon::crypto
@@ -17,6 +17,7 @@
 #include <vector>
 
 #include "tachyon/base/bit_cast.h"
+#include "tachyon/base/bits.h"
 #include "tachyon/base/buffer/copyable.h"
 #include "tachyon/base/compiler_specific.h"
 #include "tachyon/base/endian_utils.h"
@@ -26,6 +27,7 @@
 #include "tachyon/build/build_config.h"
 #include "tachyon/math/base/arithmetics.h"
 #include "tachyon/math/base/bit_traits_forward.h"
+#include "tachyon/math/base/sign.h"
 
 namespace tachyon {
 namespace math {
@@ -321,6 +323,16 @@ struct ALIGNAS(internal::LimbsAlignment(N)) BigInt {
   constexpr bool IsEven() const { return limbs[kSmallestLimbIdx] % 2 == 0; }
   constexpr bool IsOdd() const { return limbs[kSmallestLimbIdx] % 2 == 1; }
 
+  // Returns the number of bits without the leading zeros. Returns 0 if it is
+  // zero.
+  constexpr size_t GetBitLength() const {
+    FOR_FROM_BIGGEST(i, 0, N) {
+      if (limbs[i] == 0) continue;
+      return i * kLimbBitNums + base::bits::Log2Floor(limbs[i]) + 1;
+    }
+    return 0;
+  }
+
   // Return the largest (most significant) limb of the BigInt.
   constexpr uint64_t& biggest_limb() { return limbs[kBiggestLimbIdx]; }
   constexpr const uint64_t& biggest_limb() const {
@@ -844,6 +856,38 @@ struct ALIGNAS(internal::LimbsAlignment(N)) BigInt {
     return ret;
   }
 
+  // This converts bigint to width-w NAF, where w is |window_bits|. Each nonzero
+  // digit is odd and less than 2ʷ⁻¹ in absolute value, and any w consecutive
+  // digits contain at most one nonzero digit. ToNAF() is the case of w = 2.
+  // e.g, 7 = (1 1 1)₂ = (0 0 7)₂ for w = 4
+  // See https://www.iacr.org/archive/asiacrypt2005/014/014.pdf (Section 3.1)
+  std::vector<int8_t> ToWNAF(uint32_t window_bits) const {
+    DCHECK_GE(window_bits, uint32_t{2});
+    DCHECK_LE(window_bits, uint32_t{8});
+    uint64_t window = uint64_t{1} << window_bits;
+    BigInt v(*this);
+    std::vector<int8_t> ret;
+    ret.reserve(8 * sizeof(uint64_t) * N + 1);
+    while (!v.IsZero()) {
+      int8_t z = 0;
+      if (v.IsOdd()) {
+        // z = v mods 2ʷ, i.e., v mod 2ʷ in [-2ʷ⁻¹, 2ʷ⁻¹).
+        uint64_t m = v[kSmallestLimbIdx] & (window - 1);
+        if (m >= window / 2) {
+          z = static_cast<int8_t>(static_cast<int64_t>(m) -
+                                  static_cast<int64_t>(window));
+          v += BigInt(window - m);
+        } else {
+          z = static_cast<int8_t>(m);
+          v -= BigInt(m);
+        }
+      }
+      ret.push_back(z);
+      v.DivBy2InPlace();
+    }
+    return ret;
+  }
+
  private:
   template <typename T>
   constexpr T ExtractBits(size_t bit_offset, size_t bit_count) const {
@@ -968,6 +1012,26 @@ struct ALIGNAS(internal::LimbsAlignment(N)) BigInt {
   }
 };
 
+template <size_t N>
+class SignedValue<BigInt<N>> {
+ public:
+  Sign sign = Sign::kZero;
+  BigInt<N> abs_value;
+
+  constexpr SignedValue() = default;
+  constexpr SignedValue(Sign sign, const BigInt<N>& abs_value)
+      : sign(sign), abs_value(abs_value) {}
+
+  // Reads |value| as a two's complement integer.
+  constexpr static SignedValue FromTwosComplement(const BigInt<N>& value) {
+    if (value.IsZero()) return {Sign::kZero, value};
+    if (value.biggest_limb() >> 63) {
+      return {Sign::kNegative, BigInt<N>::Zero() - value};
+    }
+    return {Sign::kPositive, value};
+  }
+};
+
 template <size_t N>
 class BitTraits<BigInt<N>> {
  public:
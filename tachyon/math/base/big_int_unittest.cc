@@ -1,6 +1,9 @@
 #include "tachyon/math/base/big_int.h"
 
+#include <stdlib.h>
+
 #include <algorithm>
+#include <optional>
 #include <vector>
 
 #include "absl/container/inlined_vector.h"
@@ -269,6 +272,34 @@ TEST(BigIntTest, Operations) {
   }
 }
 
+TEST(BigIntTest, ToWNAF) {
+  BigInt<2> big_int = BigInt<2>::FromHexString("d201000000010000ffff");
+  EXPECT_EQ(big_int.ToWNAF(2), big_int.ToNAF());
+  for (uint32_t window_bits = 2; window_bits <= 8; ++window_bits) {
+    std::vector<int8_t> wnaf = big_int.ToWNAF(window_bits);
+    BigInt<2> value;
+    // The index of the last nonzero digit seen from the highest one.
+    std::optional<size_t> last_nonzero;
+    for (size_t i = wnaf.size(); i-- > 0;) {
+      value.MulBy2InPlace();
+      int8_t digit = wnaf[i];
+      if (digit == 0) continue;
+      EXPECT_NE(digit % 2, 0);
+      EXPECT_LT(std::abs(digit), 1 << (window_bits - 1));
+      if (last_nonzero.has_value()) {
+        EXPECT_GE(last_nonzero.value() - i, window_bits);
+      }
+      last_nonzero = i;
+      if (digit > 0) {
+        value += BigInt<2>(digit);
+      } else {
+        value -= BigInt<2>(-digit);
+      }
+    }
+    EXPECT_EQ(value, big_int);
+  }
+}
+
 TEST(BigIntTest, Copyable) {
   BigInt<2> expected = BigInt<2>::Random();
 
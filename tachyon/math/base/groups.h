@@ -1,13 +1,23 @@
 #ifndef TACHYON_MATH_BASE_GROUPS_H_
 #define TACHYON_MATH_BASE_GROUPS_H_
 
+#include <stdint.h>
+
+#include <algorithm>
+#include <atomic>
 #include <limits>
+#include <optional>
 #include <tuple>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
+#include "absl/types/span.h"
+
 #include "tachyon/base/containers/container_util.h"
+#include "tachyon/base/logging.h"
 #include "tachyon/base/openmp_util.h"
+#include "tachyon/base/time/time.h"
 #include "tachyon/base/types/always_false.h"
 #include "tachyon/math/base/semigroups.h"
 
@@ -20,6 +30,17 @@ SUPPORTS_UNARY_IN_PLACE_OPERATOR(Inverse);
 SUPPORTS_BINARY_OPERATOR(Sub);
 SUPPORTS_UNARY_IN_PLACE_OPERATOR(Neg);
 
+// Whether |G| provides G::PackedBatchInverse(), which computes the batch
+// inversion on the vector lanes. See MultiplicativeGroup::DoBatchInverse().
+template <typename G, typename SFINAE = void>
+struct SupportsPackedBatchInverse : std::false_type {};
+
+template <typename G>
+struct SupportsPackedBatchInverse<
+    G, std::void_t<decltype(G::PackedBatchInverse(
+           std::declval<absl::Span<const G>>(), std::declval<absl::Span<G>>(),
+           std::declval<const G&>()))>> : std::true_type {};
+
 }  // namespace internal
 
 // Group 'G' is a set of elements together with a binary operation (called the
@@ -33,10 +54,10 @@ SUPPORTS_UNARY_IN_PLACE_OPERATOR(Neg);
 template <typename G>
 class MultiplicativeGroup : public MultiplicativeSemigroup<G> {
  public:
-  // NOTE(chokobole): This value was chosen empirically such that
-  // |batch_inverse_benchmark| performs better at fewer inputs compared to the
-  // number of cpu cores.
-  constexpr static size_t kParallelBatchInverseDivisorThreshold = 2;
+  // The number of the independent chains of products in |DoBatchInverse()|.
+  // Each multiplication of a chain depends on the previous one, so the
+  // multiplications of the other chains fill its latency.
+  constexpr static size_t kBatchInverseChainNums = 4;
 
   // Division:
   //   1) a / b if division is supported.
@@ -114,9 +135,7 @@ class MultiplicativeGroup : public MultiplicativeSemigroup<G> {
 
 #if defined(TACHYON_HAS_OPENMP)
     using G2 = decltype(std::declval<G>().Inverse());
-    size_t thread_nums = static_cast<size_t>(omp_get_max_threads());
-    if (size >=
-        size_t{1} << (thread_nums / kParallelBatchInverseDivisorThreshold)) {
+    if (ShouldParallelizeBatchInverse(size)) {
       size_t chunk_size = base::GetNumElementsPerThread(groups);
       size_t num_chunks = (size + chunk_size - 1) / chunk_size;
       OPENMP_PARALLEL_FOR(size_t i = 0; i < num_chunks; ++i) {
@@ -148,52 +167,178 @@ class MultiplicativeGroup : public MultiplicativeSemigroup<G> {
     return true;
   }
 
+  // Returns true if a batch inversion of |size| elements runs faster when it
+  // is split into a chunk per thread. Each chunk runs its own inversion, so the
+  // inversions run concurrently and don't matter. What matters is whether the
+  // 3 multiplications per element saved by the other threads outweigh the cost
+  // of forking and joining the threads:
+  //
+  //   3 * |size| * (1 - 1 / threads) * multiplication > fork and join
+  //
+  // Both costs are measured once on the first call outside of a parallel
+  // region. Inside of one, it returns false, since the nested region would run
+  // on a single thread anyway.
+  static bool ShouldParallelizeBatchInverse(size_t size) {
+#if defined(TACHYON_HAS_OPENMP)
+    int8_t parallelize_for_testing =
+        parallelize_batch_inverse_for_testing_.load(std::memory_order_relaxed);
+    if (parallelize_for_testing != kNoParallelizeBatchInverseForTesting) {
+      return parallelize_for_testing != 0;
+    }
+    if (omp_in_parallel()) return false;
+    size_t thread_nums = static_cast<size_t>(omp_get_max_threads());
+    if (thread_nums == 1) return false;
+    static const BatchInverseCosts costs = MeasureBatchInverseCosts();
+    return 3 * size * (thread_nums - 1) * costs.multiplication >
+           thread_nums * costs.fork_join;
+#else
+    return false;
+#endif
+  }
+
+  // Makes |ShouldParallelizeBatchInverse()| return |parallelize| regardless
+  // of the measured costs, unless it is std::nullopt. See
+  // ScopedParallelBatchInverse in test/scoped_parallel_batch_inverse.h.
+  static void SetParallelizeBatchInverseForTesting(
+      std::optional<bool> parallelize) {
+    parallelize_batch_inverse_for_testing_.store(
+        parallelize.has_value() ? static_cast<int8_t>(parallelize.value())
+                                : kNoParallelizeBatchInverseForTesting,
+        std::memory_order_relaxed);
+  }
+
  private:
+  constexpr static int8_t kNoParallelizeBatchInverseForTesting = -1;
+
+  // 0 or 1 if it is set by |SetParallelizeBatchInverseForTesting()|. It is
+  // atomic, since it is read by every batch inversion on any thread.
+  inline static std::atomic<int8_t> parallelize_batch_inverse_for_testing_{
+      kNoParallelizeBatchInverseForTesting};
+
+  // The costs in nanoseconds used by |ShouldParallelizeBatchInverse()|.
+  struct BatchInverseCosts {
+    double multiplication;
+    double fork_join;
+  };
+
+  // Must be called outside of a parallel region. Otherwise, the fork and join
+  // below runs on a single thread and costs nothing.
+  static BatchInverseCosts MeasureBatchInverseCosts() {
+    constexpr size_t kMultiplicationNums = 1024;
+    constexpr size_t kTrials = 8;
+
+    BatchInverseCosts costs{std::numeric_limits<double>::max(),
+                            std::numeric_limits<double>::max()};
+    for (size_t i = 0; i < kTrials; ++i) {
+      // NOTE: Like a chain of |DoBatchInverse()|, each multiplication depends
+      // on the previous one, and the multiplier is a random element, since
+      // multiplying by one might be shortcut.
+      G g = RandomNonZeroNonOne();
+      G h = RandomNonZeroNonOne();
+      base::TimeTicks start = base::TimeTicks::Now();
+      for (size_t j = 0; j < kMultiplicationNums; ++j) {
+        g *= h;
+      }
+      base::TimeDelta elapsed = base::TimeTicks::Now() - start;
+      // NOTE: This prevents the multiplications from being optimized out.
+      CHECK(!g.IsZero());
+      costs.multiplication = std::min(
+          costs.multiplication,
+          static_cast<double>(elapsed.InNanoseconds()) / kMultiplicationNums);
+    }
+#if defined(TACHYON_HAS_OPENMP)
+    size_t thread_nums = static_cast<size_t>(omp_get_max_threads());
+    for (size_t i = 0; i < kTrials; ++i) {
+      base::TimeTicks start = base::TimeTicks::Now();
+      OPENMP_PARALLEL_FOR(size_t j = 0; j < thread_nums; ++j) {}
+      base::TimeDelta elapsed = base::TimeTicks::Now() - start;
+      costs.fork_join =
+          std::min(costs.fork_join,
+                   static_cast<double>(elapsed.InNanoseconds()));
+    }
+#endif
+    return costs;
+  }
+
+  static G RandomNonZeroNonOne() {
+    G g = G::Random();
+    while (g.IsZero() || g.IsOne()) {
+      g = G::Random();
+    }
+    return g;
+  }
+
   constexpr static void DoBatchInverse(absl::Span<const G> groups,
                                        absl::Span<G> inverses, const G& coeff) {
+    if constexpr (internal::SupportsPackedBatchInverse<G>::value) {
+      G::PackedBatchInverse(groups, inverses, coeff);
+      return;
+    }
+
     // Montgomery’s Trick and Fast Implementation of Masked AES
     // Genelle, Prouff and Quisquater
     // Section 3.2
     // but with an optimization to multiply every element in the returned
     // vector by |coeff|.
+    //
+    // The elements are dealt to |kBatchInverseChainNums| chains in turn, i.e.,
+    // aᵢ goes to the chain i mod K, where K = |kBatchInverseChainNums|, and
+    // the chains are combined into a single inversion.
+    constexpr size_t K = kBatchInverseChainNums;
 
-    // First pass: compute [a₁, a₁ * a₂, ..., a₁ * a₂ * ... * aₙ]
+    // First pass: |productions[i]| is the product of the nonzero elements of
+    // the chain of aᵢ before aᵢ, and |chains[k]| is the product of all the
+    // nonzero elements of the k-th chain.
     std::vector<G> productions;
-    productions.reserve(groups.size() + 1);
-    productions.push_back(G::One());
-    G product = G::One();
-    for (const G& g : groups) {
+    productions.reserve(groups.size());
+    std::vector<G> chains(K, G::One());
+    for (size_t i = 0, k = 0; i < groups.size(); ++i) {
+      productions.push_back(chains[k]);
+      const G& g = groups[i];
       if (!g.IsZero()) {
-        product *= g;
-        productions.push_back(product);
+        chains[k] *= g;
       }
+      if (++k == K) k = 0;
     }
 
-    // Invert |product|.
-    // (a₁ * a₂ * ... *  aₙ)⁻¹
+    // Invert the product of the chains.
+    // c * (c₀ * c₁ * ... * cₖ₋₁)⁻¹
+    G product = chains[0];
+    for (size_t k = 1; k < K; ++k) {
+      product *= chains[k];
+    }
     G product_inv = product.Inverse();
-
-    // Multiply |product_inv| by |coeff|, so all inverses will be scaled by
-    // |coeff|.
-    // c * (a₁ * a₂ * ... *  aₙ)⁻¹
     if (!coeff.IsOne()) product_inv *= coeff;
 
+    // Split it into the inverses of the chains.
+    // c * cₖ⁻¹ = c * (c₀ * c₁ * ... * cₖ)⁻¹ * (c₀ * c₁ * ... * cₖ₋₁)
+    std::vector<G> chain_invs(K, G::One());
+    for (size_t k = K - 1; k > 0; --k) {
+      G chain_prefix = chains[0];
+      for (size_t l = 1; l < k; ++l) {
+        chain_prefix *= chains[l];
+      }
+      chain_invs[k] = product_inv * chain_prefix;
+      product_inv *= chains[k];
+    }
+    chain_invs[0] = std::move(product_inv);
+
     // Second pass: iterate backwards to compute inverses.
     //              [c * a₁⁻¹, c * a₂,⁻¹ ..., c * aₙ⁻¹]
-    auto prod_it = productions.rbegin();
-    ++prod_it;
-    for (size_t i = groups.size() - 1; i != std::numeric_limits<size_t>::max();
-         --i) {
+    for (size_t i = groups.size() - 1, k = i % K;
+         i != std::numeric_limits<size_t>::max(); --i) {
       const G& g = groups[i];
       if (!g.IsZero()) {
-        // c * (a₁ * a₂ * ... *  aᵢ)⁻¹ * aᵢ = c * (a₁ * a₂ * ... *  aᵢ₋₁)⁻¹
-        G new_product_inv = product_inv * g;
-        // v = c * (a₁ * a₂ * ... *  aᵢ)⁻¹ * (a₁ * a₂ * ... aᵢ₋₁) = c * aᵢ⁻¹
-        inverses[i] = product_inv * (*(prod_it++));
-        product_inv = std::move(new_product_inv);
+        // c * (... * aᵢ)⁻¹ * aᵢ = c * (...)⁻¹, where ... is the elements of
+        // the chain before aᵢ.
+        G new_chain_inv = chain_invs[k] * g;
+        // c * (... * aᵢ)⁻¹ * (...) = c * aᵢ⁻¹
+        inverses[i] = chain_invs[k] * productions[i];
+        chain_invs[k] = std::move(new_chain_inv);
       } else {
         inverses[i] = G::Zero();
       }
+      k = k == 0 ? K - 1 : k - 1;
     }
   }
 };
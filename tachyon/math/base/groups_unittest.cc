@@ -4,6 +4,7 @@
 #include "gtest/gtest.h"
 
 #include "tachyon/base/containers/container_util.h"
+#include "tachyon/math/base/test/scoped_parallel_batch_inverse.h"
 #include "tachyon/math/finite_fields/test/gf7.h"
 
 namespace tachyon::math {
@@ -95,12 +96,8 @@ TEST(GroupsTest, InverseOverride) {
 
 TEST(GroupsTest, BatchInverse) {
   math::GF7::Init();
-#if defined(TACHYON_HAS_OPENMP)
-  size_t size = size_t{1} << (static_cast<size_t>(omp_get_max_threads()) /
-                              GF7::kParallelBatchInverseDivisorThreshold);
-#else
-  size_t size = 5;
-#endif
+  test::ScopedParallelBatchInverse<GF7> scoped_parallel_batch_inverse;
+  size_t size = test::kBatchInverseTestSize;
   // GF7 is MultiplicativeGroup because it satisfies the conditions of Field.
   std::vector<GF7> groups =
       base::CreateVector(size, []() { return GF7::Random(); });
@@ -119,6 +116,36 @@ TEST(GroupsTest, BatchInverse) {
   EXPECT_EQ(groups, inverses);
 }
 
+#if defined(TACHYON_HAS_OPENMP)
+TEST(GroupsTest, ShouldParallelizeBatchInverseInParallelRegion) {
+  math::GF7::Init();
+  // The nested region would run on a single thread, however large it is.
+  std::vector<uint8_t> parallelizes(omp_get_max_threads());
+  OPENMP_PARALLEL_FOR(size_t i = 0; i < parallelizes.size(); ++i) {
+    parallelizes[i] = GF7::ShouldParallelizeBatchInverse(size_t{1} << 30);
+  }
+  EXPECT_THAT(parallelizes, testing::Each(0));
+}
+#endif
+
+TEST(GroupsTest, BatchInverseSerialWithCoeff) {
+  math::GF7::Init();
+  // Covers the sizes around |kBatchInverseChainNums|.
+  for (size_t size = 0; size < 3 * GF7::kBatchInverseChainNums; ++size) {
+    std::vector<GF7> groups =
+        base::CreateVector(size, [](size_t i) { return GF7(i % 7); });
+    std::vector<GF7> inverses(size);
+    ASSERT_TRUE(GF7::BatchInverseSerial(groups, &inverses, GF7(3)));
+    for (size_t i = 0; i < size; ++i) {
+      if (groups[i].IsZero()) {
+        EXPECT_TRUE(inverses[i].IsZero());
+      } else {
+        EXPECT_EQ(inverses[i] * groups[i], GF7(3));
+      }
+    }
+  }
+}
+
 TEST(GroupsTest, Sub) {
   class Int : public AdditiveGroup<Int> {
    public:
@@ -0,0 +1,334 @@
+#ifndef TACHYON_MATH_BASE_SAFEGCD_H_
+#define TACHYON_MATH_BASE_SAFEGCD_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <array>
+#include <utility>
+
+#include "absl/numeric/int128.h"
+
+#include "tachyon/base/bits.h"
+#include "tachyon/math/base/big_int.h"
+
+namespace tachyon::math {
+
+// SafeGcd computes modular inverses and Jacobi symbols modulo an odd |N|-limb
+// modulus with the divsteps of Bernstein and Yang.
+// See https://eprint.iacr.org/2019/266.pdf
+//
+// As in libsecp256k1, 62 divsteps are batched into a 2x2 transition matrix
+// which is computed from the lowest 64 bits only, and then applied to the
+// multi-limb values. The values are held in signed 62-bit limbs, so that
+// applying the matrix never overflows 128 bits.
+// See https://github.com/bitcoin-core/secp256k1/blob/master/doc/safegcd_implementation.md
+//
+// Unlike the binary extended Euclidean algorithm in
+// BigInt::MontgomeryInverse(), Inverse() runs a fixed number of iterations
+// without any data dependent branches.
+template <size_t N>
+class SafeGcd {
+ public:
+  // The number of signed 62-bit limbs to hold a value in (-2ᴺ*⁶⁴, 2ᴺ*⁶⁴).
+  constexpr static size_t kLimbNums = 64 * N / 62 + 1;
+
+  using Limbs = std::array<int64_t, kLimbNums>;
+
+  constexpr explicit SafeGcd(const BigInt<N>& modulus)
+      : modulus_(ToLimbs(modulus)),
+        modulus_inverse62_(ComputeInverse62(modulus[0])),
+        iterations_((DivStepsBound(modulus.GetBitLength()) + 61) / 62) {}
+
+  // Returns |x|⁻¹ mod modulus in constant time. |x| should be less than the
+  // modulus. It returns zero if |x| is zero.
+  BigInt<N> Inverse(const BigInt<N>& x) const {
+    // Invariants: d * x = f (mod modulus) and e * x = g (mod modulus).
+    Limbs d{};
+    Limbs e{};
+    Limbs f = modulus_;
+    Limbs g = ToLimbs(x);
+    e[0] = 1;
+    // η = -δ, where δ starts from 1.
+    int64_t eta = -1;
+    for (size_t i = 0; i < iterations_; ++i) {
+      Matrix t;
+      eta = DivSteps62(eta, f[0], g[0], &t);
+      UpdateDE(t, &d, &e);
+      UpdateFG(t, &f, &g);
+    }
+    // Now g = 0 and f = ±gcd(x, modulus) = ±1, so that x⁻¹ = ±d.
+    return Normalize(d, f[kLimbNums - 1]);
+  }
+
+  // Computes the Jacobi symbol (|x| / modulus) into |ret| in variable time,
+  // where |x| should be a nonzero value less than the modulus and coprime to
+  // it. Returns false if it has not converged after a bounded number of
+  // iterations, which is not expected to happen in practice.
+  bool Jacobi(const BigInt<N>& x, int* ret) const {
+    Limbs f = modulus_;
+    Limbs g = ToLimbs(x);
+    int64_t eta = -1;
+    // The lowest bit holds whether the symbol is flipped.
+    uint64_t jacobi = 0;
+    // libsecp256k1 runs 25 iterations for 256-bit moduli.
+    for (size_t i = 0; i < 6 * N + 1; ++i) {
+      Matrix t;
+      uint64_t f0 = static_cast<uint64_t>(f[0]) |
+                    (static_cast<uint64_t>(f[1]) << 62);
+      uint64_t g0 = static_cast<uint64_t>(g[0]) |
+                    (static_cast<uint64_t>(g[1]) << 62);
+      eta = PosDivSteps62(eta, f0, g0, &t, &jacobi);
+      UpdateFG(t, &f, &g);
+      // Once g reaches zero, f is gcd(x, modulus) = 1 and (g / f) = 1.
+      if (f[0] == 1) {
+        int64_t rest = 0;
+        for (size_t j = 1; j < kLimbNums; ++j) {
+          rest |= f[j];
+        }
+        if (rest == 0) {
+          *ret = (jacobi & 1) ? -1 : 1;
+          return true;
+        }
+      }
+    }
+    return false;
+  }
+
+ private:
+  // The transition matrix of 62 divsteps, scaled by 2⁶²:
+  //   [f', g'] = [u, v; q, r] * [f, g] / 2⁶²
+  struct Matrix {
+    int64_t u;
+    int64_t v;
+    int64_t q;
+    int64_t r;
+  };
+
+  constexpr static uint64_t kMask62 = (uint64_t{1} << 62) - 1;
+
+  // The number of divsteps that are enough to reach g = 0 from 0 ≤ g ≤ f <
+  // 2ᵈ. See Theorem 11.2 of the paper above.
+  constexpr static size_t DivStepsBound(size_t d) {
+    return d < 46 ? (49 * d + 80) / 17 : (49 * d + 57) / 17;
+  }
+
+  // Returns m⁻¹ mod 2⁶² for an odd |m| by Newton's iteration. Each iteration
+  // doubles the number of the correct bits, starting from 3 bits.
+  constexpr static uint64_t ComputeInverse62(uint64_t m) {
+    uint64_t inverse = m;
+    for (size_t i = 0; i < 5; ++i) {
+      inverse *= 2 - m * inverse;
+    }
+    return inverse & kMask62;
+  }
+
+  constexpr static Limbs ToLimbs(const BigInt<N>& x) {
+    Limbs ret{};
+    for (size_t i = 0; i < kLimbNums; ++i) {
+      size_t word = 62 * i / 64;
+      size_t shift = 62 * i % 64;
+      uint64_t limb = word < N ? x[word] >> shift : 0;
+      if (shift != 0 && word + 1 < N) {
+        limb |= x[word + 1] << (64 - shift);
+      }
+      ret[i] = static_cast<int64_t>(limb & kMask62);
+    }
+    return ret;
+  }
+
+  // |x| should be in [0, 2ᴺ*⁶⁴) with every limb in [0, 2⁶²).
+  static BigInt<N> FromLimbs(const Limbs& x) {
+    BigInt<N> ret;
+    for (size_t i = 0; i < kLimbNums; ++i) {
+      uint64_t limb = static_cast<uint64_t>(x[i]);
+      size_t word = 62 * i / 64;
+      size_t shift = 62 * i % 64;
+      if (word < N) ret[word] |= limb << shift;
+      if (shift > 2 && word + 1 < N) ret[word + 1] |= limb >> (64 - shift);
+    }
+    return ret;
+  }
+
+  // Runs 62 divsteps on the lowest 62 bits of |f| and |g| in constant time,
+  // and returns the updated η. The divstep is
+  //   (δ, f, g) -> (1 - δ, g, (g - f) / 2)  if δ > 0 and g is odd,
+  //                (1 + δ, f, (g + f) / 2)  if g is odd,
+  //                (1 + δ, f, g / 2)        otherwise.
+  static int64_t DivSteps62(int64_t eta, uint64_t f, uint64_t g, Matrix* t) {
+    uint64_t u = 1, v = 0, q = 0, r = 1;
+    for (size_t i = 0; i < 62; ++i) {
+      // All ones if η < 0, that is, δ > 0.
+      uint64_t c1 = static_cast<uint64_t>(eta >> 63);
+      // All ones if g is odd.
+      uint64_t c2 = -(g & 1);
+      // Subtracts f from g if δ > 0 and adds it otherwise, when g is odd.
+      g += ((f ^ c1) - c1) & c2;
+      q += ((u ^ c1) - c1) & c2;
+      r += ((v ^ c1) - c1) & c2;
+      // All ones if swapping, where f + (g - f) = g.
+      uint64_t c = c1 & c2;
+      f += g & c;
+      u += q & c;
+      v += r & c;
+      // η -> -η - 1 if swapping, and η - 1 otherwise.
+      eta = (eta ^ static_cast<int64_t>(c)) + static_cast<int64_t>(~c);
+      g >>= 1;
+      u <<= 1;
+      v <<= 1;
+    }
+    *t = {static_cast<int64_t>(u), static_cast<int64_t>(v),
+          static_cast<int64_t>(q), static_cast<int64_t>(r)};
+    return eta;
+  }
+
+  // Runs 62 posdivsteps on the lowest 64 bits of |f| and |g| in variable
+  // time, flipping the lowest bit of |jacobi| whenever (g / f) changes its
+  // sign. Unlike the divsteps, f and g remain nonnegative, since a multiple of
+  // f is only added to g, so that the Jacobi symbol is tracked from the lowest
+  // 3 bits of them:
+  //   (g / f) = (2 / f) * ((g / 2) / f), where (2 / f) = -1 iff f = ±3 mod 8.
+  //   (g / f) = (f / g), unless f = g = 3 mod 4.
+  //   (g / f) = ((g + w * f) / f).
+  // This is the variant of libsecp256k1 that counts the trailing zeros of g
+  // and cancels up to 6 bits of g at once.
+  static int64_t PosDivSteps62(int64_t eta, uint64_t f, uint64_t g, Matrix* t,
+                               uint64_t* jacobi) {
+    uint64_t u = 1, v = 0, q = 0, r = 1;
+    int i = 62;
+    while (true) {
+      // The sentinel bit stops counting the zeros at i.
+      int zeros = base::bits::CountTrailingZeroBits(g | (~uint64_t{0} << i));
+      g >>= zeros;
+      u <<= zeros;
+      v <<= zeros;
+      eta -= zeros;
+      i -= zeros;
+      *jacobi ^= static_cast<uint64_t>(zeros) & ((f >> 1) ^ (f >> 2));
+      if (i == 0) break;
+      uint64_t w;
+      if (eta < 0) {
+        eta = -eta;
+        std::swap(f, g);
+        std::swap(u, q);
+        std::swap(v, r);
+        *jacobi ^= (f & g) >> 1;
+        // Cancels up to 6 bits of g with w = -g / f mod 2⁶, but no more than
+        // η + 1 bits, since the sign of η flips after that.
+        int limit = std::min(static_cast<int>(eta) + 1, i);
+        uint64_t mask = (~uint64_t{0} >> (64 - limit)) & 63;
+        w = (f * g * (f * f - 2)) & mask;
+      } else {
+        // Cancels up to 4 bits of g with w = -g / f mod 2⁴.
+        int limit = std::min(static_cast<int>(eta) + 1, i);
+        uint64_t mask = (~uint64_t{0} >> (64 - limit)) & 15;
+        w = f + (((f + 1) & 4) << 1);
+        w = (-w * g) & mask;
+      }
+      g += f * w;
+      q += u * w;
+      r += v * w;
+    }
+    *t = {static_cast<int64_t>(u), static_cast<int64_t>(v),
+          static_cast<int64_t>(q), static_cast<int64_t>(r)};
+    return eta;
+  }
+
+  // [f, g] = t * [f, g] / 2⁶², where the division is exact.
+  static void UpdateFG(const Matrix& t, Limbs* f_ptr, Limbs* g_ptr) {
+    Limbs& f = *f_ptr;
+    Limbs& g = *g_ptr;
+    absl::int128 cf = absl::int128(t.u) * f[0] + absl::int128(t.v) * g[0];
+    absl::int128 cg = absl::int128(t.q) * f[0] + absl::int128(t.r) * g[0];
+    cf >>= 62;
+    cg >>= 62;
+    for (size_t i = 1; i < kLimbNums; ++i) {
+      cf += absl::int128(t.u) * f[i] + absl::int128(t.v) * g[i];
+      cg += absl::int128(t.q) * f[i] + absl::int128(t.r) * g[i];
+      f[i - 1] = static_cast<int64_t>(absl::Int128Low64(cf) & kMask62);
+      g[i - 1] = static_cast<int64_t>(absl::Int128Low64(cg) & kMask62);
+      cf >>= 62;
+      cg >>= 62;
+    }
+    f[kLimbNums - 1] = static_cast<int64_t>(absl::Int128Low64(cf));
+    g[kLimbNums - 1] = static_cast<int64_t>(absl::Int128Low64(cg));
+  }
+
+  // [d, e] = t * [d, e] / 2⁶² mod modulus, where |d| and |e| are kept in
+  // (-2 * modulus, modulus). The division is made exact by adding the
+  // multiples of the modulus that cancel the lowest 62 bits.
+  void UpdateDE(const Matrix& t, Limbs* d_ptr, Limbs* e_ptr) const {
+    Limbs& d = *d_ptr;
+    Limbs& e = *e_ptr;
+    constexpr size_t L = kLimbNums;
+    int64_t sd = d[L - 1] >> 63;
+    int64_t se = e[L - 1] >> 63;
+    // Adds the modulus times [u, q] if d is negative and [v, r] if e is
+    // negative, which keeps the results in range.
+    int64_t md = (t.u & sd) + (t.v & se);
+    int64_t me = (t.q & sd) + (t.r & se);
+    absl::int128 cd = absl::int128(t.u) * d[0] + absl::int128(t.v) * e[0];
+    absl::int128 ce = absl::int128(t.q) * d[0] + absl::int128(t.r) * e[0];
+    md -= static_cast<int64_t>(
+        (modulus_inverse62_ * absl::Int128Low64(cd) + md) & kMask62);
+    me -= static_cast<int64_t>(
+        (modulus_inverse62_ * absl::Int128Low64(ce) + me) & kMask62);
+    cd += absl::int128(modulus_[0]) * md;
+    ce += absl::int128(modulus_[0]) * me;
+    cd >>= 62;
+    ce >>= 62;
+    for (size_t i = 1; i < L; ++i) {
+      cd += absl::int128(t.u) * d[i] + absl::int128(t.v) * e[i] +
+            absl::int128(modulus_[i]) * md;
+      ce += absl::int128(t.q) * d[i] + absl::int128(t.r) * e[i] +
+            absl::int128(modulus_[i]) * me;
+      d[i - 1] = static_cast<int64_t>(absl::Int128Low64(cd) & kMask62);
+      e[i - 1] = static_cast<int64_t>(absl::Int128Low64(ce) & kMask62);
+      cd >>= 62;
+      ce >>= 62;
+    }
+    d[L - 1] = static_cast<int64_t>(absl::Int128Low64(cd));
+    e[L - 1] = static_cast<int64_t>(absl::Int128Low64(ce));
+  }
+
+  // Brings |r| in (-2 * modulus, modulus) into [0, modulus), negating it if
+  // |sign| is negative.
+  BigInt<N> Normalize(Limbs r, int64_t sign) const {
+    constexpr size_t L = kLimbNums;
+    // (-2 * modulus, modulus) -> (-modulus, modulus)
+    int64_t cond_add = r[L - 1] >> 63;
+    for (size_t i = 0; i < L; ++i) {
+      r[i] += modulus_[i] & cond_add;
+    }
+    int64_t cond_negate = sign >> 63;
+    for (size_t i = 0; i < L; ++i) {
+      r[i] = (r[i] ^ cond_negate) - cond_negate;
+    }
+    PropagateCarries(&r);
+    // (-modulus, modulus) -> [0, modulus)
+    cond_add = r[L - 1] >> 63;
+    for (size_t i = 0; i < L; ++i) {
+      r[i] += modulus_[i] & cond_add;
+    }
+    PropagateCarries(&r);
+    return FromLimbs(r);
+  }
+
+  // Brings the limbs except for the top one into [0, 2⁶²).
+  static void PropagateCarries(Limbs* r) {
+    for (size_t i = 0; i < kLimbNums - 1; ++i) {
+      (*r)[i + 1] += (*r)[i] >> 62;
+      (*r)[i] &= static_cast<int64_t>(kMask62);
+    }
+  }
+
+  Limbs modulus_;
+  // modulus⁻¹ mod 2⁶²
+  uint64_t modulus_inverse62_;
+  size_t iterations_;
+};
+
+}  // namespace tachyon::math
+
+#endif  // TACHYON_MATH_BASE_SAFEGCD_H_
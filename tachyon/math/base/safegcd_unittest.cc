@@ -0,0 +1,89 @@
+#include "tachyon/math/base/safegcd.h"
+
+#include "gtest/gtest.h"
+
+#include "tachyon/math/base/gmp/gmp_util.h"
+
+namespace tachyon::math {
+
+namespace {
+
+template <size_t N>
+struct LimbNums {
+  constexpr static size_t value = N;
+};
+
+template <typename T>
+class SafeGcdTest : public testing::Test {
+ public:
+  constexpr static size_t N = T::value;
+
+  // The moduli of GF(7), BN254 Fq and BLS12-381 Fq.
+  static BigInt<N> GetModulus() {
+    if constexpr (N == 1) {
+      return BigInt<1>(7);
+    } else if constexpr (N == 4) {
+      return BigInt<4>::FromDecString(
+          "21888242871839275222246405745257275088696311157297823662689037894645"
+          "226208583");
+    } else {
+      static_assert(N == 6);
+      return BigInt<6>::FromHexString(
+          "1a0111ea397fe69a4b1ba7b6434bacd764774b84f38512bf6730d2a0f6b0f6241eab"
+          "fffeb153ffffb9feffffffffaaab");
+    }
+  }
+
+  static mpz_class ToMpzClass(const BigInt<N>& value) {
+    mpz_class ret;
+    gmp::WriteLimbs(value.limbs, N, &ret);
+    return ret;
+  }
+};
+
+}  // namespace
+
+using LimbNumsTypes = testing::Types<LimbNums<1>, LimbNums<4>, LimbNums<6>>;
+TYPED_TEST_SUITE(SafeGcdTest, LimbNumsTypes);
+
+TYPED_TEST(SafeGcdTest, Inverse) {
+  constexpr size_t N = TypeParam::value;
+  BigInt<N> modulus = this->GetModulus();
+  SafeGcd<N> safegcd(modulus);
+  mpz_class modulus_mpz = this->ToMpzClass(modulus);
+
+  EXPECT_TRUE(safegcd.Inverse(BigInt<N>::Zero()).IsZero());
+  EXPECT_TRUE(safegcd.Inverse(BigInt<N>::One()).IsOne());
+  EXPECT_EQ(safegcd.Inverse(modulus - BigInt<N>::One()),
+            modulus - BigInt<N>::One());
+
+  for (size_t i = 0; i < 100; ++i) {
+    BigInt<N> x = BigInt<N>::Random(modulus);
+    if (x.IsZero()) continue;
+    mpz_class expected;
+    mpz_invert(expected.get_mpz_t(), this->ToMpzClass(x).get_mpz_t(),
+               modulus_mpz.get_mpz_t());
+    EXPECT_EQ(this->ToMpzClass(safegcd.Inverse(x)), expected);
+  }
+}
+
+TYPED_TEST(SafeGcdTest, Jacobi) {
+  constexpr size_t N = TypeParam::value;
+  BigInt<N> modulus = this->GetModulus();
+  SafeGcd<N> safegcd(modulus);
+  mpz_class modulus_mpz = this->ToMpzClass(modulus);
+
+  int jacobi;
+  ASSERT_TRUE(safegcd.Jacobi(BigInt<N>::One(), &jacobi));
+  EXPECT_EQ(jacobi, 1);
+
+  for (size_t i = 0; i < 100; ++i) {
+    BigInt<N> x = BigInt<N>::Random(modulus);
+    if (x.IsZero()) continue;
+    ASSERT_TRUE(safegcd.Jacobi(x, &jacobi));
+    EXPECT_EQ(jacobi, mpz_jacobi(this->ToMpzClass(x).get_mpz_t(),
+                                 modulus_mpz.get_mpz_t()));
+  }
+}
+
+}  // namespace tachyon::math
@@ -0,0 +1,36 @@
+#ifndef TACHYON_MATH_BASE_TEST_SCOPED_PARALLEL_BATCH_INVERSE_H_
+#define TACHYON_MATH_BASE_TEST_SCOPED_PARALLEL_BATCH_INVERSE_H_
+
+#include <stddef.h>
+
+#include <optional>
+
+#include "tachyon/math/base/groups.h"
+
+namespace tachyon::math::test {
+
+// The number of elements of the tests of the batch inversion and what is
+// built on it. It is split into a chunk per thread in parallel, and every
+// chunk is still longer than MultiplicativeGroup::kBatchInverseChainNums.
+constexpr size_t kBatchInverseTestSize = 4096;
+
+// Makes F::ShouldParallelizeBatchInverse() return true while it is alive, so
+// that the parallel path is tested regardless of the number of cores and the
+// measured costs. It has no effect without OpenMP.
+template <typename F>
+class ScopedParallelBatchInverse {
+ public:
+  ScopedParallelBatchInverse() {
+    F::SetParallelizeBatchInverseForTesting(true);
+  }
+  ScopedParallelBatchInverse(const ScopedParallelBatchInverse& other) = delete;
+  ScopedParallelBatchInverse& operator=(
+      const ScopedParallelBatchInverse& other) = delete;
+  ~ScopedParallelBatchInverse() {
+    F::SetParallelizeBatchInverseForTesting(std::nullopt);
+  }
+};
+
+}  // namespace tachyon::math::test
+
+#endif  // TACHYON_MATH_BASE_TEST_SCOPED_PARALLEL_BATCH_INVERSE_H_
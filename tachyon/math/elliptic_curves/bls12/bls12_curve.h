@@ -6,10 +6,8 @@
 #ifndef TACHYON_MATH_ELLIPTIC_CURVES_BLS12_BLS12_CURVE_H_
 #define TACHYON_MATH_ELLIPTIC_CURVES_BLS12_BLS12_CURVE_H_
 
-#include <functional>
 #include <vector>
 
-#include "tachyon/base/parallelize.h"
 #include "tachyon/math/elliptic_curves/bls12/g2_prepared.h"
 #include "tachyon/math/elliptic_curves/pairing/pairing_friendly_curve.h"
 
@@ -55,10 +53,7 @@ class BLS12Curve : public PairingFriendlyCurve<Config> {
       return f;
     };
 
-    std::vector<Fp12> results =
-        base::ParallelizeMapByChunkSize(pairs, 4, callback);
-    Fp12 f = std::accumulate(results.begin(), results.end(), Fp12::One(),
-                             std::multiplies<>());
+    Fp12 f = Base::ParallelizeMillerLoop(pairs, callback);
 
     if constexpr (Config::kXIsNegative) {
       f.CyclotomicInverseInPlace();
@@ -0,0 +1,241 @@
+#ifndef TACHYON_MATH_ELLIPTIC_CURVES_MSM_ALGORITHMS_PIPPENGER_BATCH_AFFINE_BUCKETS_H_
+#define TACHYON_MATH_ELLIPTIC_CURVES_MSM_ALGORITHMS_PIPPENGER_BATCH_AFFINE_BUCKETS_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include "tachyon/base/logging.h"
+#include "tachyon/math/elliptic_curves/affine_point.h"
+#include "tachyon/math/elliptic_curves/curve_type.h"
+#include "tachyon/math/elliptic_curves/point_xyzz.h"
+
+namespace tachyon::math {
+
+template <typename Point>
+inline constexpr bool kSupportsBatchAffineBuckets = false;
+
+template <typename Curve>
+inline constexpr bool kSupportsBatchAffineBuckets<AffinePoint<Curve>> =
+    Curve::kType == CurveType::kShortWeierstrass;
+
+// BatchAffineBuckets keeps Pippenger buckets in affine coordinates.
+//
+// Instead of adding every base into an XYZZ bucket with a mixed addition
+// (8M + 2S), additions that target distinct buckets are collected into a
+// batch and performed in affine coordinates. The inversions of a batch are
+// shared using Montgomery's trick, so an addition costs about 5M + 1S plus an
+// amortized share of a single inversion.
+//
+// A point that targets a bucket which is already scheduled in the current
+// batch is postponed to a conflict queue and retried after the batch is
+// applied. If the conflict queue overflows, e.g., when most of the scalars
+// land on a few buckets, the point is added into a lazily allocated XYZZ
+// bucket instead. NOTE: This bounds the conflicts, but it is not always
+// faster than the plain XYZZ path. With few points per bucket, the batches
+// stay small and the shared inversion is not amortized well.
+//
+// See https://eprint.iacr.org/2022/1396.
+template <typename Curve>
+class BatchAffineBuckets {
+ public:
+  using Point = AffinePoint<Curve>;
+  using Bucket = PointXYZZ<Curve>;
+  using BaseField = typename Point::BaseField;
+
+  constexpr static size_t kMaxBatchSize = 512;
+
+  explicit BatchAffineBuckets(size_t bucket_size)
+      : BatchAffineBuckets(bucket_size, ComputeBatchSize(bucket_size)) {}
+  BatchAffineBuckets(size_t bucket_size, size_t batch_size)
+      : buckets_(bucket_size),
+        scheduled_(bucket_size, false),
+        batch_size_(std::max(batch_size, size_t{1})) {
+    pending_.reserve(batch_size_);
+    denominators_.reserve(batch_size_);
+  }
+  BatchAffineBuckets(const BatchAffineBuckets& other) = delete;
+  BatchAffineBuckets& operator=(const BatchAffineBuckets& other) = delete;
+
+  // Keeps the number of in-flight additions well below the number of
+  // buckets, so that uniformly distributed digits rarely conflict.
+  constexpr static size_t ComputeBatchSize(size_t bucket_size) {
+    return std::min(kMaxBatchSize, std::max(bucket_size / 4, size_t{1}));
+  }
+
+  size_t batch_size() const { return batch_size_; }
+
+  // Schedules |buckets_[bucket_idx]| += |point|.
+  void Add(size_t bucket_idx, const Point& point) {
+    if (point.IsZero()) return;
+    Schedule(bucket_idx, point);
+    if (pending_.size() == batch_size_) {
+      ApplyPending();
+      RetryConflicts();
+    }
+  }
+
+  // Schedules |buckets_[bucket_idx]| -= |point|.
+  void Sub(size_t bucket_idx, const Point& point) { Add(bucket_idx, -point); }
+
+  // Applies every scheduled addition including the postponed ones.
+  void Flush() {
+    while (!pending_.empty() || !conflicts_.empty()) {
+      ApplyPending();
+      RetryConflicts();
+    }
+  }
+
+  // Returns Σᵢ (i + 1) * bucketᵢ + |initial_value|. This is equivalent to
+  // PippengerBase::AccumulateBuckets(), but the running sum is updated with
+  // mixed additions since the buckets are already affine.
+  Bucket Accumulate(const Bucket& initial_value = Bucket::Zero()) {
+    Flush();
+    Bucket running_sum = Bucket::Zero();
+    Bucket window_sum = initial_value;
+    for (size_t i = buckets_.size() - 1;
+         i != std::numeric_limits<size_t>::max(); --i) {
+      running_sum += buckets_[i];
+      if (!overflow_buckets_.empty()) running_sum += overflow_buckets_[i];
+      window_sum += running_sum;
+    }
+    return window_sum;
+  }
+
+ private:
+  enum class Operation : uint8_t {
+    // bucket = point
+    kAssign,
+    // bucket = bucket + point
+    kAdd,
+    // bucket = 2 * bucket
+    kDouble,
+    // bucket = 0
+    kClear,
+  };
+
+  struct Addition {
+    size_t bucket_idx;
+    Point point;
+    Operation operation;
+  };
+
+  void Schedule(size_t bucket_idx, const Point& point) {
+    if (!scheduled_[bucket_idx]) {
+      scheduled_[bucket_idx] = true;
+      pending_.push_back({bucket_idx, point, Operation::kAdd});
+    } else if (conflicts_.size() < batch_size_) {
+      conflicts_.push_back({bucket_idx, point, Operation::kAdd});
+    } else {
+      if (overflow_buckets_.empty()) overflow_buckets_.resize(buckets_.size());
+      overflow_buckets_[bucket_idx] += point;
+    }
+  }
+
+  void RetryConflicts() {
+    std::vector<Addition> conflicts;
+    std::swap(conflicts, conflicts_);
+    for (const Addition& conflict : conflicts) {
+      Schedule(conflict.bucket_idx, conflict.point);
+      if (pending_.size() == batch_size_) ApplyPending();
+    }
+  }
+
+  void ApplyPending() {
+    if (pending_.empty()) return;
+
+    // First pass: collect the denominators of λ.
+    denominators_.clear();
+    for (Addition& addition : pending_) {
+      const Point& bucket = buckets_[addition.bucket_idx];
+      const Point& point = addition.point;
+      if (bucket.IsZero()) {
+        addition.operation = Operation::kAssign;
+        denominators_.push_back(BaseField::Zero());
+        continue;
+      }
+      // NOTE: Equalities are checked with IsZero() on differences, which
+      // avoids converting out of montgomery form.
+      BaseField dx = point.x() - bucket.x();
+      if (!dx.IsZero()) {
+        // λ = (y₂ - y₁) / (x₂ - x₁)
+        addition.operation = Operation::kAdd;
+        denominators_.push_back(std::move(dx));
+      } else if ((point.y() - bucket.y()).IsZero() && !bucket.y().IsZero()) {
+        // λ = (3 * x₁² + a) / (2 * y₁)
+        addition.operation = Operation::kDouble;
+        denominators_.push_back(bucket.y().Double());
+      } else {
+        // P + (-P) = 0
+        addition.operation = Operation::kClear;
+        denominators_.push_back(BaseField::Zero());
+      }
+    }
+
+    // Zeros are skipped by the batch inversion.
+    CHECK(BaseField::BatchInverseInPlaceSerial(denominators_));
+
+    // Second pass: apply the additions.
+    for (size_t i = 0; i < pending_.size(); ++i) {
+      Addition& addition = pending_[i];
+      Point& bucket = buckets_[addition.bucket_idx];
+      scheduled_[addition.bucket_idx] = false;
+      switch (addition.operation) {
+        case Operation::kAssign:
+          bucket = std::move(addition.point);
+          break;
+        case Operation::kAdd: {
+          BaseField lambda = addition.point.y() - bucket.y();
+          lambda *= denominators_[i];
+          bucket = ComputeSum(bucket, addition.point.x(), lambda);
+          break;
+        }
+        case Operation::kDouble: {
+          BaseField lambda = bucket.x().Square();
+          lambda += lambda.Double();
+          if constexpr (!Curve::Config::kAIsZero) {
+            lambda += Curve::Config::kA;
+          }
+          lambda *= denominators_[i];
+          bucket = ComputeSum(bucket, bucket.x(), lambda);
+          break;
+        }
+        case Operation::kClear:
+          bucket = Point::Zero();
+          break;
+      }
+    }
+    pending_.clear();
+  }
+
+  // x₃ = λ² - x₁ - x₂
+  // y₃ = λ * (x₁ - x₃) - y₁
+  static Point ComputeSum(const Point& p, const BaseField& x2,
+                          const BaseField& lambda) {
+    BaseField x3 = lambda.Square();
+    x3 -= p.x();
+    x3 -= x2;
+    BaseField y3 = p.x() - x3;
+    y3 *= lambda;
+    y3 -= p.y();
+    return {std::move(x3), std::move(y3)};
+  }
+
+  std::vector<Point> buckets_;
+  // |scheduled_[i]| is true if |buckets_[i]| is already in |pending_|.
+  std::vector<bool> scheduled_;
+  std::vector<Addition> pending_;
+  std::vector<Addition> conflicts_;
+  std::vector<BaseField> denominators_;
+  // Allocated only when |conflicts_| overflows.
+  std::vector<Bucket> overflow_buckets_;
+  size_t batch_size_;
+};
+
+}  // namespace tachyon::math
+
+#endif  // TACHYON_MATH_ELLIPTIC_CURVES_MSM_ALGORITHMS_PIPPENGER_BATCH_AFFINE_BUCKETS_H_
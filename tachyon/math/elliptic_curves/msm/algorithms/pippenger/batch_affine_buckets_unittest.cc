@@ -0,0 +1,105 @@
+#include "tachyon/math/elliptic_curves/msm/algorithms/pippenger/batch_affine_buckets.h"
+
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "tachyon/base/random.h"
+#include "tachyon/math/elliptic_curves/bn/bn254/g1.h"
+#include "tachyon/math/elliptic_curves/test/random.h"
+
+namespace tachyon::math {
+
+namespace {
+
+class BatchAffineBucketsTest : public testing::Test {
+ public:
+  static void SetUpTestSuite() { bn254::G1Curve::Init(); }
+};
+
+// Computes Σᵢ (i + 1) * bucketᵢ.
+bn254::G1PointXYZZ AccumulateNaive(
+    const std::vector<bn254::G1PointXYZZ>& buckets) {
+  bn254::G1PointXYZZ ret = bn254::G1PointXYZZ::Zero();
+  for (size_t i = 0; i < buckets.size(); ++i) {
+    ret += buckets[i] * bn254::Fr(i + 1);
+  }
+  return ret;
+}
+
+}  // namespace
+
+TEST_F(BatchAffineBucketsTest, Accumulate) {
+  constexpr size_t kBucketSize = 64;
+  constexpr size_t kNumPoints = 1000;
+
+  std::vector<bn254::G1AffinePoint> points =
+      CreatePseudoRandomPoints<bn254::G1AffinePoint>(kNumPoints);
+  std::vector<bn254::G1PointXYZZ> expected(kBucketSize);
+  BatchAffineBuckets<bn254::G1Curve> buckets(kBucketSize);
+  for (const bn254::G1AffinePoint& point : points) {
+    size_t idx = base::Uniform(base::Range<size_t>::Until(kBucketSize));
+    if (base::Bernoulli(0.5)) {
+      buckets.Add(idx, point);
+      expected[idx] += point;
+    } else {
+      buckets.Sub(idx, point);
+      expected[idx] -= point;
+    }
+  }
+  bn254::G1PointXYZZ initial_value = bn254::G1PointXYZZ::Random();
+  EXPECT_EQ(buckets.Accumulate(initial_value),
+            AccumulateNaive(expected) + initial_value);
+}
+
+TEST_F(BatchAffineBucketsTest, EdgeCases) {
+  bn254::G1AffinePoint p = bn254::G1AffinePoint::Random();
+  bn254::G1AffinePoint q = bn254::G1AffinePoint::Random();
+
+  // With a batch size of 1, each addition is applied right away. Otherwise,
+  // the additions to the same bucket go through the conflict queue.
+  for (size_t batch_size : {size_t{1}, size_t{4}}) {
+    BatchAffineBuckets<bn254::G1Curve> buckets(4, batch_size);
+    // bucket₀ = P + P
+    buckets.Add(0, p);
+    buckets.Add(0, p);
+    // bucket₁ = P - P
+    buckets.Add(1, p);
+    buckets.Sub(1, p);
+    // bucket₂ = 0 + Q
+    buckets.Add(2, bn254::G1AffinePoint::Zero());
+    buckets.Add(2, q);
+    // bucket₃ = P + Q - Q + P
+    buckets.Add(3, p);
+    buckets.Add(3, q);
+    buckets.Sub(3, q);
+    buckets.Add(3, p);
+
+    std::vector<bn254::G1PointXYZZ> expected = {
+        p.DoubleXYZZ(),
+        bn254::G1PointXYZZ::Zero(),
+        q.ToXYZZ(),
+        p.DoubleXYZZ(),
+    };
+    EXPECT_EQ(buckets.Accumulate(), AccumulateNaive(expected));
+  }
+}
+
+TEST_F(BatchAffineBucketsTest, Conflicts) {
+  constexpr size_t kBucketSize = 8;
+  constexpr size_t kNumPoints = 2000;
+
+  // All the points fall into a single bucket, which overflows the conflict
+  // queue.
+  std::vector<bn254::G1AffinePoint> points =
+      CreatePseudoRandomPoints<bn254::G1AffinePoint>(kNumPoints);
+  std::vector<bn254::G1PointXYZZ> expected(kBucketSize);
+  BatchAffineBuckets<bn254::G1Curve> buckets(kBucketSize, 4);
+  for (const bn254::G1AffinePoint& point : points) {
+    buckets.Add(5, point);
+    expected[5] += point;
+  }
+  EXPECT_EQ(buckets.Accumulate(), AccumulateNaive(expected));
+}
+
+}  // namespace tachyon::math
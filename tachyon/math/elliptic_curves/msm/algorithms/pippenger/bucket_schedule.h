@@ -0,0 +1,110 @@
+#ifndef TACHYON_MATH_ELLIPTIC_CURVES_MSM_ALGORITHMS_PIPPENGER_BUCKET_SCHEDULE_H_
+#define TACHYON_MATH_ELLIPTIC_CURVES_MSM_ALGORITHMS_PIPPENGER_BUCKET_SCHEDULE_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+#include "absl/types/span.h"
+
+#include "tachyon/base/logging.h"
+
+namespace tachyon::math {
+
+// BucketSchedule groups the points of a single Pippenger window by the bucket
+// they are added to.
+//
+// The signed digits of a window are sorted by bucket with a counting sort, so
+// that the entries of a bucket are contiguous. Each entry packs the index of
+// the point with its sign. Accumulating the buckets then becomes a sequential
+// sweep over the entries instead of scattering the points across all the
+// buckets, and the buckets can be split into disjoint ranges with about the
+// same number of points.
+class BucketSchedule {
+ public:
+  // The largest number of points that can be scheduled, since the lowest bit
+  // of an entry is used for its sign.
+  constexpr static size_t kMaxSize = size_t{1} << 31;
+
+  BucketSchedule() = default;
+
+  // Schedules the j-th point into bucket |digits[j]| - 1 if the digit is
+  // positive, or negated into bucket -|digits[j]| - 1 if it is negative.
+  // Points with a zero digit are skipped. Every digit should be in
+  // [-|bucket_size|, |bucket_size|].
+  template <typename Digit>
+  void Build(absl::Span<const Digit> digits, size_t bucket_size) {
+    CHECK_LT(digits.size(), kMaxSize);
+    offsets_.assign(bucket_size + 1, 0);
+    for (Digit digit : digits) {
+      if (digit != 0) ++offsets_[GetBucketIndex(digit) + 1];
+    }
+    for (size_t i = 0; i < bucket_size; ++i) {
+      offsets_[i + 1] += offsets_[i];
+    }
+
+    entries_.resize(offsets_.back());
+    std::vector<uint32_t> cursors(offsets_.begin(), offsets_.end() - 1);
+    for (size_t j = 0; j < digits.size(); ++j) {
+      Digit digit = digits[j];
+      if (digit == 0) continue;
+      entries_[cursors[GetBucketIndex(digit)]++] =
+          static_cast<uint32_t>(j << 1) | static_cast<uint32_t>(digit < 0);
+    }
+  }
+
+  size_t bucket_size() const {
+    return offsets_.empty() ? 0 : offsets_.size() - 1;
+  }
+
+  // Returns the number of scheduled points.
+  size_t size() const { return entries_.size(); }
+
+  // Returns the entries of the |bucket_idx|-th bucket.
+  absl::Span<const uint32_t> GetEntries(size_t bucket_idx) const {
+    return absl::MakeConstSpan(entries_).subspan(
+        offsets_[bucket_idx], offsets_[bucket_idx + 1] - offsets_[bucket_idx]);
+  }
+
+  static size_t GetPointIndex(uint32_t entry) { return entry >> 1; }
+  static bool IsNegative(uint32_t entry) { return entry & 1; }
+
+  // Splits the buckets into at most |num_ranges| consecutive ranges that hold
+  // about the same number of points. The i-th range is [ret[i], ret[i + 1]).
+  std::vector<size_t> Partition(size_t num_ranges) const {
+    size_t bucket_size = this->bucket_size();
+    num_ranges = std::max(std::min(num_ranges, bucket_size), size_t{1});
+    std::vector<size_t> boundaries;
+    boundaries.reserve(num_ranges + 1);
+    boundaries.push_back(0);
+    for (size_t i = 1; i < num_ranges; ++i) {
+      uint32_t target =
+          static_cast<uint32_t>(uint64_t{size()} * i / num_ranges);
+      size_t boundary = std::lower_bound(offsets_.begin(), offsets_.end() - 1,
+                                         target) -
+                        offsets_.begin();
+      if (boundary > boundaries.back()) boundaries.push_back(boundary);
+    }
+    if (bucket_size > boundaries.back()) boundaries.push_back(bucket_size);
+    return boundaries;
+  }
+
+ private:
+  template <typename Digit>
+  static size_t GetBucketIndex(Digit digit) {
+    return 0 < digit ? static_cast<size_t>(digit - 1)
+                     : static_cast<size_t>(-(digit + 1));
+  }
+
+  // |offsets_[i]| is the position of the first entry of the i-th bucket.
+  std::vector<uint32_t> offsets_;
+  // Each entry is (point index << 1) | (1 if negated else 0).
+  std::vector<uint32_t> entries_;
+};
+
+}  // namespace tachyon::math
+
+#endif  // TACHYON_MATH_ELLIPTIC_CURVES_MSM_ALGORITHMS_PIPPENGER_BUCKET_SCHEDULE_H_
@@ -0,0 +1,51 @@
+#include "tachyon/math/elliptic_curves/msm/algorithms/pippenger/bucket_schedule.h"
+
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace tachyon::math {
+
+TEST(BucketScheduleTest, Build) {
+  std::vector<int16_t> digits = {3, 0, -1, 3, 4, -3, 1, -4};
+  BucketSchedule schedule;
+  schedule.Build(absl::MakeConstSpan(digits), 4);
+  EXPECT_EQ(schedule.bucket_size(), size_t{4});
+  EXPECT_EQ(schedule.size(), size_t{7});
+
+  struct {
+    size_t index;
+    bool negative;
+  } expected[4][3] = {
+      {{2, true}, {6, false}},
+      {},
+      {{0, false}, {3, false}, {5, true}},
+      {{4, false}, {7, true}},
+  };
+  size_t expected_sizes[] = {2, 0, 3, 2};
+  for (size_t k = 0; k < 4; ++k) {
+    absl::Span<const uint32_t> entries = schedule.GetEntries(k);
+    ASSERT_EQ(entries.size(), expected_sizes[k]);
+    for (size_t i = 0; i < entries.size(); ++i) {
+      EXPECT_EQ(BucketSchedule::GetPointIndex(entries[i]),
+                expected[k][i].index);
+      EXPECT_EQ(BucketSchedule::IsNegative(entries[i]),
+                expected[k][i].negative);
+    }
+  }
+}
+
+TEST(BucketScheduleTest, Partition) {
+  // Bucket 0 holds 6 points and the others hold 1 point each.
+  std::vector<int32_t> digits = {1, 1, 1, 1, 1, 1, 2, 3, 4, 5, 6, 7};
+  BucketSchedule schedule;
+  schedule.Build(absl::MakeConstSpan(digits), 8);
+
+  EXPECT_EQ(schedule.Partition(1), (std::vector<size_t>{0, 8}));
+  EXPECT_EQ(schedule.Partition(2), (std::vector<size_t>{0, 1, 8}));
+  // Ranges are never empty.
+  EXPECT_EQ(schedule.Partition(4), (std::vector<size_t>{0, 1, 4, 8}));
+  EXPECT_EQ(schedule.Partition(100).back(), size_t{8});
+}
+
+}  // namespace tachyon::math
@@ -6,15 +6,24 @@
 #ifndef TACHYON_MATH_ELLIPTIC_CURVES_MSM_ALGORITHMS_PIPPENGER_PIPPENGER_H_
 #define TACHYON_MATH_ELLIPTIC_CURVES_MSM_ALGORITHMS_PIPPENGER_PIPPENGER_H_
 
+#include <stddef.h>
+#include <stdint.h>
+
 #include <algorithm>
 #include <numeric>
 #include <type_traits>
 #include <utility>
 #include <vector>
 
+#include "absl/types/span.h"
+
+#include "tachyon/base/logging.h"
 #include "tachyon/base/openmp_util.h"
 #include "tachyon/math/base/big_int.h"
+#include "tachyon/math/elliptic_curves/msm/algorithms/pippenger/batch_affine_buckets.h"
+#include "tachyon/math/elliptic_curves/msm/algorithms/pippenger/bucket_schedule.h"
 #include "tachyon/math/elliptic_curves/msm/algorithms/pippenger/pippenger_base.h"
+#include "tachyon/math/elliptic_curves/msm/glv.h"
 #include "tachyon/math/elliptic_curves/msm/msm_ctx.h"
 #include "tachyon/math/elliptic_curves/msm/msm_util.h"
 #include "tachyon/math/elliptic_curves/semigroups.h"
@@ -23,14 +32,18 @@ namespace tachyon::math {
 
 // From:
 // https://github.com/arkworks-rs/gemini/blob/main/src/kzg/msm/variable_base.rs#L20
-template <size_t N>
+//
+// Writes |digits_size| signed digits of |scalar| to |digits|, |stride| apart.
+// Each digit is in [-2^(|window_bits| - 1), 2^(|window_bits| - 1)] except for
+// the last one, which absorbs the final carry and is at most 2^|window_bits|.
+template <size_t N, typename Digit>
 void FillDigits(const BigInt<N>& scalar, size_t window_bits,
-                std::vector<int64_t>* digits) {
+                size_t digits_size, Digit* digits, size_t stride = 1) {
   uint64_t radix = 1 << window_bits;
 
   uint64_t carry = 0;
   size_t bit_offset = 0;
-  for (size_t i = 0; i < digits->size(); ++i) {
+  for (size_t i = 0; i < digits_size; ++i) {
     // Construct a buffer of bits of the |scalar|, starting at
     // `bit_offset`.
     uint64_t bits = scalar.ExtractBits64(bit_offset, window_bits);
@@ -41,12 +54,20 @@ void FillDigits(const BigInt<N>& scalar, size_t window_bits,
     // Recenter coefficients from [0,2^|window_bits|) to
     // [-2^|window_bits|/2, 2^|window_bits|/2)
     carry = (coeff + radix / 2) >> window_bits;
-    (*digits)[i] = static_cast<int64_t>(coeff) -
-                   static_cast<int64_t>(carry << window_bits);
+    digits[i * stride] = static_cast<Digit>(
+        static_cast<int64_t>(coeff) -
+        static_cast<int64_t>(carry << window_bits));
     bit_offset += window_bits;
   }
 
-  digits->back() += static_cast<int64_t>(carry << window_bits);
+  digits[(digits_size - 1) * stride] +=
+      static_cast<Digit>(carry << window_bits);
+}
+
+template <size_t N>
+void FillDigits(const BigInt<N>& scalar, size_t window_bits,
+                std::vector<int64_t>* digits) {
+  FillDigits(scalar, window_bits, digits->size(), digits->data());
 }
 
 template <typename Point>
@@ -56,6 +77,9 @@ class Pippenger : public PippengerBase<Point> {
   using Bucket = typename PippengerBase<Point>::Bucket;
 
   constexpr static size_t N = ScalarField::N;
+  constexpr static bool kSupportsBatchAffine =
+      kSupportsBatchAffineBuckets<Point>;
+  constexpr static bool kSupportsGLV = math::kSupportsGLV<Point>;
 
   Pippenger() : use_msm_window_naf_(Point::kNegationIsCheap) {
 #if defined(TACHYON_HAS_OPENMP)
@@ -71,6 +95,44 @@ class Pippenger : public PippengerBase<Point> {
     use_msm_window_naf_ = use_msm_window_naf;
   }
 
+  // If true, buckets are accumulated in affine coordinates with batched
+  // inversions. See batch_affine_buckets.h for details. This is ignored
+  // unless |Point| is an affine short weierstrass point.
+  void SetUseBatchAffine(bool use_batch_affine) {
+    use_batch_affine_ = use_batch_affine;
+  }
+
+  // If true, each sᵢ * Pᵢ is split into k₁ * Pᵢ + k₂ * φ(Pᵢ) using the GLV
+  // endomorphism φ, where k₁ and k₂ are about half the length of sᵢ. This
+  // doubles the number of bases, but halves the number of windows. This is
+  // ignored unless the curve of |Point| has GLV parameters.
+  void SetUseGLV(bool use_glv) { use_glv_ = use_glv; }
+
+  // If true, the points of each window are sorted by bucket before they are
+  // accumulated. See bucket_schedule.h for details. The windows are then
+  // processed one by one, while the buckets of a window are split into
+  // disjoint ranges across threads. This takes precedence over
+  // SetParallelWindows() and SetUseBatchAffine().
+  void SetUseBucketSorting(bool use_bucket_sorting) {
+    use_bucket_sorting_ = use_bucket_sorting;
+  }
+
+  // If true, which is the default, zero, ±1 and 64-bit scalars are split off
+  // before running the MSM. See RunWithScalarClassification() for details.
+  void SetUseScalarClassification(bool use_scalar_classification) {
+    use_scalar_classification_ = use_scalar_classification;
+  }
+
+  // Overrides the window bits of MSMCtx::ComputeWindowsBits() for the full
+  // width scalars, which dominate the cost of Run(), and for RunBatch(). 0
+  // restores the default. The MSM of the 64-bit scalars split off by the
+  // scalar classification still picks its own window bits, since it has
+  // fewer points and shorter scalars than what |window_bits| is chosen for.
+  void SetWindowBits(unsigned int window_bits) {
+    CHECK_LT(window_bits, 31u);
+    window_bits_ = window_bits;
+  }
+
   template <typename BaseInputIterator, typename ScalarInputIterator,
             std::enable_if_t<IsAbleToMSM<BaseInputIterator, ScalarInputIterator,
                                          Point, ScalarField>>* = nullptr>
@@ -84,7 +146,6 @@ class Pippenger : public PippengerBase<Point> {
       LOG(ERROR) << "bases_size and scalars_size don't match";
       return false;
     }
-    ctx_ = MSMCtx::CreateDefault<ScalarField>(scalars_size);
 
     std::vector<BigInt<N>> scalars;
     scalars.resize(scalars_size);
@@ -93,9 +154,358 @@ class Pippenger : public PippengerBase<Point> {
       scalars[i] = scalars_it->ToBigInt();
     }
 
+    if (use_scalar_classification_) {
+      RunWithScalarClassification(std::move(bases_first),
+                                  absl::MakeSpan(scalars), ret);
+    } else {
+      RunFullWidth(std::move(bases_first), scalars, ret);
+    }
+    return true;
+  }
+
+  // Computes Σⱼ sᵢ,ⱼ * Pⱼ for every scalar vector sᵢ in |scalars_list| and
+  // populates |rets| with them. A scalar vector shorter than the bases is
+  // treated as zero-padded.
+  //
+  // Unlike calling Run() for each of them, the buckets of a group of scalar
+  // vectors are filled together, so that each base is loaded once per window
+  // for the whole group. The threads are split across the groups and the
+  // windows. Batch-affine buckets, GLV, bucket sorting and scalar
+  // classification are not applied.
+  template <typename BaseInputIterator>
+  [[nodiscard]] bool RunBatch(
+      BaseInputIterator bases_first, BaseInputIterator bases_last,
+      absl::Span<const absl::Span<const ScalarField>> scalars_list,
+      std::vector<Bucket>* rets) {
+    size_t bases_size = std::distance(bases_first, bases_last);
+    size_t size = 0;
+    for (absl::Span<const ScalarField> scalars : scalars_list) {
+      if (scalars.size() > bases_size) {
+        LOG(ERROR) << "Too many scalars: " << scalars.size() << " vs "
+                   << bases_size;
+        return false;
+      }
+      size = std::max(size, scalars.size());
+    }
+    rets->resize(scalars_list.size());
+
+    ctx_ = CreateCtx(size);
+    if (ctx_.window_bits < 15) {
+      RunBatch<int16_t>(std::move(bases_first), size, scalars_list, rets);
+    } else {
+      CHECK_LT(ctx_.window_bits, 31u);
+      RunBatch<int32_t>(std::move(bases_first), size, scalars_list, rets);
+    }
+    return true;
+  }
+
+ private:
+  // The upper bound of the number of buckets that a single task of
+  // RunBatch() keeps at once.
+  constexpr static size_t kMaxBatchBuckets = size_t{1} << 16;
+
+  template <typename Digit, typename BaseInputIterator>
+  void RunBatch(BaseInputIterator bases_first, size_t size,
+                absl::Span<const absl::Span<const ScalarField>> scalars_list,
+                std::vector<Bucket>* rets) {
+    size_t batch_size = scalars_list.size();
+    size_t window_count = ctx_.window_count;
+#if defined(TACHYON_HAS_OPENMP)
+    size_t thread_nums = static_cast<size_t>(omp_get_max_threads());
+#else
+    size_t thread_nums = 1;
+#endif  // defined(TACHYON_HAS_OPENMP)
+
+    // Scalar vectors in a group share a pass over the bases. Groups are
+    // processed |groups_in_flight| at a time, so that there are enough tasks
+    // to keep the threads busy while the digits of only a few groups are
+    // alive.
+    size_t group_size = std::min(
+        batch_size, std::max(kMaxBatchBuckets / GetBucketSize(window_count - 1),
+                             size_t{1}));
+    size_t groups_in_flight =
+        std::max((thread_nums + window_count - 1) / window_count, size_t{1});
+
+    std::vector<std::vector<Bucket>> window_sums(
+        batch_size, std::vector<Bucket>(window_count));
+    for (size_t first = 0; first < batch_size;
+         first += group_size * groups_in_flight) {
+      size_t last = std::min(first + group_size * groups_in_flight, batch_size);
+
+      std::vector<std::vector<Digit>> digits(last - first);
+      for (size_t k = first; k < last; ++k) {
+        std::vector<BigInt<N>> scalars(size);
+        absl::Span<const ScalarField> field_scalars = scalars_list[k];
+        OPENMP_PARALLEL_FOR(size_t j = 0; j < field_scalars.size(); ++j) {
+          scalars[j] = field_scalars[j].ToBigInt();
+        }
+        digits[k - first] = ComputeWindowDigits<Digit>(scalars);
+      }
+
+      size_t num_groups = (last - first + group_size - 1) / group_size;
+      OPENMP_PARALLEL_FOR(size_t t = 0; t < num_groups * window_count; ++t) {
+        size_t group_first = first + (t / window_count) * group_size;
+        size_t group_last = std::min(group_first + group_size, last);
+        size_t i = t % window_count;
+        AccumulateBatchWindowSums(bases_first, size,
+                                  absl::MakeConstSpan(digits),
+                                  group_first - first, group_last - first, i,
+                                  &window_sums[group_first]);
+      }
+    }
+
+    for (size_t k = 0; k < batch_size; ++k) {
+      (*rets)[k] = PippengerBase<Point>::AccumulateWindowSums(
+          absl::MakeConstSpan(window_sums[k]), ctx_.window_bits);
+    }
+  }
+
+  // Accumulates the |window_idx|-th window of |digits[first]|, ...,
+  // |digits[last - 1]| and stores the results to |window_sums[k][window_idx]|
+  // for k in [0, last - first).
+  template <typename Digit, typename BaseInputIterator>
+  void AccumulateBatchWindowSums(
+      BaseInputIterator bases_first, size_t size,
+      absl::Span<const std::vector<Digit>> digits, size_t first, size_t last,
+      size_t window_idx, std::vector<Bucket>* window_sums) const {
+    size_t bucket_size = GetBucketSize(window_idx);
+    size_t group_size = last - first;
+    std::vector<Bucket> buckets(group_size * bucket_size);
+    auto bases_it = bases_first;
+    for (size_t j = 0; j < size; ++j, ++bases_it) {
+      const Point& base = *bases_it;
+      for (size_t k = 0; k < group_size; ++k) {
+        int64_t digit = digits[first + k][window_idx * size + j];
+        Bucket* group_buckets = &buckets[k * bucket_size];
+        if (0 < digit) {
+          group_buckets[static_cast<uint64_t>(digit - 1)] += base;
+        } else if (0 > digit) {
+          group_buckets[static_cast<uint64_t>(-digit - 1)] -= base;
+        }
+      }
+    }
+    for (size_t k = 0; k < group_size; ++k) {
+      window_sums[k][window_idx] = PippengerBase<Point>::AccumulateBuckets(
+          absl::MakeConstSpan(buckets).subspan(k * bucket_size, bucket_size));
+    }
+  }
+
+  // IndexedBasesIterator reads |bases_first[indices[i]]| as the i-th base, so
+  // that a subset of the terms goes through the MSM without copying the bases.
+  // If |Negatable| is true, the base is negated if |negated[i]| is set.
+  template <typename BaseInputIterator, bool Negatable>
+  class IndexedBasesIterator {
+   public:
+    using Ret = std::conditional_t<Negatable, Point, const Point&>;
+
+    IndexedBasesIterator(BaseInputIterator bases_first, const size_t* indices,
+                         const uint8_t* negated = nullptr)
+        : bases_first_(std::move(bases_first)),
+          indices_(indices),
+          negated_(negated) {}
+
+    Ret operator*() const { return (*this)[0]; }
+
+    Ret operator[](size_t i) const {
+      const Point& base = bases_first_[indices_[i]];
+      if constexpr (Negatable) {
+        if (negated_[i]) return -base;
+      }
+      return base;
+    }
+
+    IndexedBasesIterator& operator++() {
+      ++indices_;
+      if constexpr (Negatable) ++negated_;
+      return *this;
+    }
+
+   private:
+    BaseInputIterator bases_first_;
+    const size_t* indices_;
+    const uint8_t* negated_;
+  };
+
+  enum class ScalarKind : uint8_t {
+    kZero,
+    kOne,
+    kMinusOne,
+    // s < 2⁶⁴
+    kSmall,
+    // -s < 2⁶⁴
+    kNegativeSmall,
+    kFull,
+  };
+
+  static bool IsSmall(const BigInt<N>& scalar) {
+    for (size_t i = 1; i < N; ++i) {
+      if (scalar[i] != 0) return false;
+    }
+    return true;
+  }
+
+  static ScalarKind ClassifyScalar(const BigInt<N>& scalar) {
+    if (scalar.IsZero()) return ScalarKind::kZero;
+    if (IsSmall(scalar)) {
+      return scalar.IsOne() ? ScalarKind::kOne : ScalarKind::kSmall;
+    }
+    BigInt<N> negated = ScalarField::Config::kModulus - scalar;
+    if (IsSmall(negated)) {
+      return negated.IsOne() ? ScalarKind::kMinusOne
+                             : ScalarKind::kNegativeSmall;
+    }
+    return ScalarKind::kFull;
+  }
+
+  // Splits the terms by their scalars. Terms with a zero scalar are dropped,
+  // bases with a scalar of ±1 are summed directly, and terms with a scalar
+  // that fits in 64 bits up to sign go through an MSM with fewer windows. The
+  // rest go through RunFullWidth(). This speeds up commitments to columns that
+  // are mostly booleans or range-checked values, while random scalars only pay
+  // for a pass over the scalars.
+  template <typename BaseInputIterator>
+  void RunWithScalarClassification(BaseInputIterator bases_first,
+                                   absl::Span<BigInt<N>> scalars,
+                                   Bucket* ret) {
+    size_t size = scalars.size();
+    std::vector<ScalarKind> kinds(size);
+    OPENMP_PARALLEL_FOR(size_t i = 0; i < size; ++i) {
+      kinds[i] = ClassifyScalar(scalars[i]);
+    }
+    size_t full_size =
+        std::count(kinds.begin(), kinds.end(), ScalarKind::kFull);
+    if (full_size == size) {
+      RunFullWidth(std::move(bases_first), scalars, ret);
+      return;
+    }
+
+    // NOTE: The bases are never copied. The terms of each kind read them
+    // through their indices, and the full width scalars are moved to the front
+    // of |scalars| in place.
+    Bucket unit_sum = Bucket::Zero();
+    std::vector<size_t> small_indices;
+    std::vector<uint8_t> small_negated;
+    std::vector<BigInt<N>> small_scalars;
+    size_t small_bit_length = 0;
+    std::vector<size_t> full_indices;
+    full_indices.reserve(full_size);
+    for (size_t i = 0; i < size; ++i) {
+      switch (kinds[i]) {
+        case ScalarKind::kZero:
+          break;
+        case ScalarKind::kOne:
+          unit_sum += bases_first[i];
+          break;
+        case ScalarKind::kMinusOne:
+          unit_sum -= bases_first[i];
+          break;
+        case ScalarKind::kSmall:
+        case ScalarKind::kNegativeSmall: {
+          bool negative = kinds[i] == ScalarKind::kNegativeSmall;
+          small_indices.push_back(i);
+          small_negated.push_back(negative);
+          small_scalars.push_back(
+              negative ? ScalarField::Config::kModulus - scalars[i]
+                       : scalars[i]);
+          small_bit_length =
+              std::max(small_bit_length, small_scalars.back().GetBitLength());
+          break;
+        }
+        case ScalarKind::kFull:
+          // NOTE: |full_indices.size()| is at most i, so this never
+          // overwrites a scalar that is yet to be read.
+          scalars[full_indices.size()] = scalars[i];
+          full_indices.push_back(i);
+          break;
+      }
+    }
+
+    *ret = std::move(unit_sum);
+    if (!small_indices.empty()) {
+      // NOTE: |window_bits_| is not applied here. See SetWindowBits().
+      ctx_ = MSMCtx::CreateDefault<ScalarField>(small_indices.size());
+      ctx_.window_count =
+          MSMCtx::ComputeWindowsCount(ctx_.window_bits, small_bit_length);
+      Bucket small_sum;
+      Accumulate(IndexedBasesIterator<BaseInputIterator, true>(
+                     bases_first, small_indices.data(), small_negated.data()),
+                 small_scalars, &small_sum);
+      *ret += small_sum;
+    }
+    if (!full_indices.empty()) {
+      Bucket full_sum;
+      RunFullWidth(IndexedBasesIterator<BaseInputIterator, false>(
+                       bases_first, full_indices.data()),
+                   scalars.subspan(0, full_size), &full_sum);
+      *ret += full_sum;
+    }
+  }
+
+  MSMCtx CreateCtx(size_t size) const {
+    MSMCtx ctx = MSMCtx::CreateDefault<ScalarField>(size);
+    if (window_bits_ != 0) {
+      ctx.window_bits = window_bits_;
+      ctx.window_count = MSMCtx::ComputeWindowsCount<ScalarField>(window_bits_);
+    }
+    return ctx;
+  }
+
+  template <typename BaseInputIterator>
+  void RunFullWidth(BaseInputIterator bases_first,
+                    absl::Span<const BigInt<N>> scalars, Bucket* ret) {
+    if constexpr (kSupportsGLV) {
+      if (use_glv_) {
+        RunWithGLV(std::move(bases_first), scalars, ret);
+        return;
+      }
+    }
+    ctx_ = CreateCtx(scalars.size());
+    Accumulate(std::move(bases_first), scalars, ret);
+  }
+
+  template <typename BaseInputIterator>
+  void RunWithGLV(BaseInputIterator bases_first,
+                  absl::Span<const BigInt<N>> scalars, Bucket* ret) {
+    size_t size = scalars.size();
+    std::vector<Point> bases(2 * size);
+    std::vector<BigInt<N>> glv_scalars(2 * size);
+    // NOTE: The bit lengths are kept per scalar, so that the decomposition
+    // runs in parallel and only their maximum is taken serially.
+    std::vector<size_t> bit_lengths(size);
+    OPENMP_PARALLEL_FOR(size_t i = 0; i < size; ++i) {
+      typename GLV<Point>::CoefficientDecompositionResult result =
+          GLV<Point>::Decompose(scalars[i]);
+      const Point& base = bases_first[i];
+      Point endomorphism = Point::Endomorphism(base);
+      bases[2 * i] = result.k1.sign == Sign::kNegative ? -base : base;
+      bases[2 * i + 1] = result.k2.sign == Sign::kNegative
+                             ? -endomorphism
+                             : std::move(endomorphism);
+      bit_lengths[i] = std::max(result.k1.abs_value.GetBitLength(),
+                                result.k2.abs_value.GetBitLength());
+      glv_scalars[2 * i] = std::move(result.k1.abs_value);
+      glv_scalars[2 * i + 1] = std::move(result.k2.abs_value);
+    }
+    size_t bit_length = 0;
+    for (size_t value : bit_lengths) {
+      bit_length = std::max(bit_length, value);
+    }
+
+    ctx_ = CreateCtx(2 * size);
+    ctx_.window_count = MSMCtx::ComputeWindowsCount(
+        ctx_.window_bits, std::max(bit_length, size_t{1}));
+    Accumulate(bases.begin(), glv_scalars, ret);
+  }
+
+  template <typename BaseInputIterator>
+  void Accumulate(BaseInputIterator bases_first,
+                  absl::Span<const BigInt<N>> scalars, Bucket* ret) {
     std::vector<Bucket> window_sums(ctx_.window_count);
 
-    if (use_msm_window_naf_) {
+    if (use_bucket_sorting_) {
+      AccumulateWindowSumsWithBucketSorting(std::move(bases_first), scalars,
+                                            &window_sums);
+    } else if (use_msm_window_naf_) {
       AccumulateWindowNAFSums(std::move(bases_first), scalars, &window_sums);
     } else {
       AccumulateWindowSums(std::move(bases_first), scalars, &window_sums);
@@ -103,25 +513,37 @@ class Pippenger : public PippengerBase<Point> {
 
     *ret = PippengerBase<Point>::AccumulateWindowSums(
         absl::MakeConstSpan(window_sums), ctx_.window_bits);
-    return true;
   }
 
- private:
-  template <typename BaseInputIterator>
-  void AccumulateSingleWindowNAFSum(
-      BaseInputIterator bases_it,
-      const std::vector<std::vector<int64_t>>& scalar_digits, size_t i,
-      Bucket* window_sum, bool is_last_window) {
+  template <typename BaseInputIterator, typename Digit>
+  void AccumulateSingleWindowNAFSum(BaseInputIterator bases_it,
+                                    absl::Span<const Digit> window_digits,
+                                    Bucket* window_sum, bool is_last_window) {
     size_t bucket_size;
     if (is_last_window) {
       bucket_size = 1 << ctx_.window_bits;
     } else {
       bucket_size = 1 << (ctx_.window_bits - 1);
     }
+    if constexpr (kSupportsBatchAffine) {
+      if (use_batch_affine_) {
+        BatchAffineBuckets<typename Point::Curve> buckets(bucket_size);
+        for (size_t j = 0; j < window_digits.size(); ++j, ++bases_it) {
+          int64_t scalar = window_digits[j];
+          if (0 < scalar) {
+            buckets.Add(static_cast<uint64_t>(scalar - 1), *bases_it);
+          } else if (0 > scalar) {
+            buckets.Sub(static_cast<uint64_t>(-scalar - 1), *bases_it);
+          }
+        }
+        *window_sum = buckets.Accumulate();
+        return;
+      }
+    }
     std::vector<Bucket> buckets(bucket_size);
-    for (size_t j = 0; j < scalar_digits.size(); ++j, ++bases_it) {
+    for (size_t j = 0; j < window_digits.size(); ++j, ++bases_it) {
       const Point& base = *bases_it;
-      int64_t scalar = scalar_digits[j][i];
+      int64_t scalar = window_digits[j];
       if (0 < scalar) {
         buckets[static_cast<uint64_t>(scalar - 1)] += base;
       } else if (0 > scalar) {
@@ -136,33 +558,164 @@ class Pippenger : public PippengerBase<Point> {
   void AccumulateWindowNAFSums(BaseInputIterator bases_first,
                                absl::Span<const BigInt<N>> scalars,
                                std::vector<Bucket>* window_sums) {
-    std::vector<std::vector<int64_t>> scalar_digits;
-    scalar_digits.resize(scalars.size());
-    for (std::vector<int64_t>& scalar_digit : scalar_digits) {
-      scalar_digit.resize(ctx_.window_count);
+    // A digit is at most 2^|window_bits| in absolute value.
+    if (ctx_.window_bits < 15) {
+      AccumulateWindowNAFSums<int16_t>(std::move(bases_first), scalars,
+                                       window_sums);
+    } else {
+      CHECK_LT(ctx_.window_bits, 31u);
+      AccumulateWindowNAFSums<int32_t>(std::move(bases_first), scalars,
+                                       window_sums);
     }
-    for (size_t i = 0; i < scalars.size(); ++i) {
-      FillDigits(scalars[i], ctx_.window_bits, &scalar_digits[i]);
+  }
+
+  // Returns the window-major digits of |scalars|: |digits[i * scalars.size() +
+  // j]| is the i-th digit of the j-th scalar, so that each window reads a
+  // contiguous slice. The digits are signed if |use_msm_window_naf_| is true.
+  template <typename Digit>
+  std::vector<Digit> ComputeWindowDigits(
+      absl::Span<const BigInt<N>> scalars) const {
+    size_t size = scalars.size();
+    std::vector<Digit> digits(ctx_.window_count * size);
+    OPENMP_PARALLEL_FOR(size_t j = 0; j < size; ++j) {
+      if (use_msm_window_naf_) {
+        FillDigits(scalars[j], ctx_.window_bits, ctx_.window_count, &digits[j],
+                   size);
+      } else {
+        for (size_t i = 0; i < ctx_.window_count; ++i) {
+          digits[i * size + j] = static_cast<Digit>(scalars[j].ExtractBits64(
+              i * ctx_.window_bits, ctx_.window_bits));
+        }
+      }
     }
+    return digits;
+  }
+
+  template <typename Digit, typename BaseInputIterator>
+  void AccumulateWindowNAFSums(BaseInputIterator bases_first,
+                               absl::Span<const BigInt<N>> scalars,
+                               std::vector<Bucket>* window_sums) {
+    size_t size = scalars.size();
+    std::vector<Digit> digits = ComputeWindowDigits<Digit>(scalars);
+    absl::Span<const Digit> digits_span = absl::MakeConstSpan(digits);
     if (parallel_windows_) {
       OPENMP_PARALLEL_FOR(size_t i = 0; i < ctx_.window_count; ++i) {
-        AccumulateSingleWindowNAFSum(bases_first, scalar_digits, i,
+        AccumulateSingleWindowNAFSum(bases_first,
+                                     digits_span.subspan(i * size, size),
                                      &(*window_sums)[i],
                                      i == ctx_.window_count - 1);
       }
     } else {
       for (size_t i = 0; i < ctx_.window_count; ++i) {
-        AccumulateSingleWindowNAFSum(bases_first, scalar_digits, i,
+        AccumulateSingleWindowNAFSum(bases_first,
+                                     digits_span.subspan(i * size, size),
                                      &(*window_sums)[i],
                                      i == ctx_.window_count - 1);
       }
     }
   }
 
+  template <typename BaseInputIterator>
+  void AccumulateWindowSumsWithBucketSorting(
+      BaseInputIterator bases_first, absl::Span<const BigInt<N>> scalars,
+      std::vector<Bucket>* window_sums) {
+    if (ctx_.window_bits < 15) {
+      AccumulateWindowSumsWithBucketSorting<int16_t>(std::move(bases_first),
+                                                     scalars, window_sums);
+    } else {
+      CHECK_LT(ctx_.window_bits, 31u);
+      AccumulateWindowSumsWithBucketSorting<int32_t>(std::move(bases_first),
+                                                     scalars, window_sums);
+    }
+  }
+
+  template <typename Digit, typename BaseInputIterator>
+  void AccumulateWindowSumsWithBucketSorting(
+      BaseInputIterator bases_first, absl::Span<const BigInt<N>> scalars,
+      std::vector<Bucket>* window_sums) {
+    size_t size = scalars.size();
+    std::vector<Digit> digits = ComputeWindowDigits<Digit>(scalars);
+    absl::Span<const Digit> digits_span = absl::MakeConstSpan(digits);
+
+    std::vector<BucketSchedule> schedules(ctx_.window_count);
+    OPENMP_PARALLEL_FOR(size_t i = 0; i < ctx_.window_count; ++i) {
+      schedules[i].Build(digits_span.subspan(i * size, size),
+                         GetBucketSize(i));
+    }
+    std::vector<Digit>().swap(digits);
+
+#if defined(TACHYON_HAS_OPENMP)
+    size_t thread_nums = static_cast<size_t>(omp_get_max_threads());
+#else
+    size_t thread_nums = 1;
+#endif  // defined(TACHYON_HAS_OPENMP)
+    for (size_t i = 0; i < ctx_.window_count; ++i) {
+      const BucketSchedule& schedule = schedules[i];
+      std::vector<size_t> boundaries = schedule.Partition(thread_nums);
+      size_t num_ranges = boundaries.size() - 1;
+      std::vector<Bucket> range_sums(num_ranges);
+      OPENMP_PARALLEL_FOR(size_t r = 0; r < num_ranges; ++r) {
+        range_sums[r] = AccumulateBucketRange(bases_first, schedule,
+                                              boundaries[r], boundaries[r + 1]);
+      }
+      Bucket window_sum = Bucket::Zero();
+      for (const Bucket& range_sum : range_sums) {
+        window_sum += range_sum;
+      }
+      (*window_sums)[i] = std::move(window_sum);
+    }
+  }
+
+  // Returns Σₖ (k + 1) * bucketₖ for k in [|first|, |last|). Since the points
+  // are sorted by bucket, they are added into the running sum directly, and
+  // no bucket needs to be stored.
+  template <typename BaseInputIterator>
+  static Bucket AccumulateBucketRange(BaseInputIterator bases_first,
+                                      const BucketSchedule& schedule,
+                                      size_t first, size_t last) {
+    Bucket running_sum = Bucket::Zero();
+    Bucket range_sum = Bucket::Zero();
+    for (size_t k = last - 1; k != first - 1; --k) {
+      for (uint32_t entry : schedule.GetEntries(k)) {
+        const Point& base = bases_first[BucketSchedule::GetPointIndex(entry)];
+        if (BucketSchedule::IsNegative(entry)) {
+          running_sum -= base;
+        } else {
+          running_sum += base;
+        }
+      }
+      range_sum += running_sum;
+    }
+    // So far, bucketₖ is weighted by (k - |first| + 1).
+    if (first != 0) {
+      range_sum += running_sum.ScalarMul(first);
+    }
+    return range_sum;
+  }
+
+  size_t GetBucketSize(size_t window_idx) const {
+    if (use_msm_window_naf_) {
+      // The last window absorbs the final carry of FillDigits().
+      return window_idx == ctx_.window_count - 1
+                 ? size_t{1} << ctx_.window_bits
+                 : size_t{1} << (ctx_.window_bits - 1);
+    } else {
+      // We don't need the "zero" bucket.
+      return (size_t{1} << ctx_.window_bits) - 1;
+    }
+  }
+
   template <typename BaseInputIterator>
   void AccumulateSingleWindowSum(BaseInputIterator bases_first,
                                  absl::Span<const BigInt<N>> scalars,
                                  size_t window_offset, Bucket* out) {
+    if constexpr (kSupportsBatchAffine) {
+      if (use_batch_affine_) {
+        AccumulateSingleWindowSumWithBatchAffine(std::move(bases_first),
+                                                 scalars, window_offset, out);
+        return;
+      }
+    }
     Bucket window_sum = Bucket::Zero();
     // We don't need the "zero" bucket, so we only have 2^{window_bits} - 1
     // buckets.
@@ -200,6 +753,36 @@ class Pippenger : public PippengerBase<Point> {
                                                    window_sum);
   }
 
+  // Same as AccumulateSingleWindowSum() above, but buckets are kept in affine
+  // coordinates.
+  template <typename BaseInputIterator>
+  void AccumulateSingleWindowSumWithBatchAffine(
+      BaseInputIterator bases_first, absl::Span<const BigInt<N>> scalars,
+      size_t window_offset, Bucket* out) {
+    Bucket window_sum = Bucket::Zero();
+    BatchAffineBuckets<typename Point::Curve> buckets(
+        (1 << ctx_.window_bits) - 1);
+    auto bases_it = bases_first;
+    for (size_t j = 0; j < scalars.size(); ++j, ++bases_it) {
+      const BigInt<N>& scalar = scalars[j];
+      if (scalar.IsZero()) continue;
+
+      if (scalar.IsOne()) {
+        if (window_offset == 0) {
+          window_sum += *bases_it;
+        }
+      } else {
+        BigInt<N> scalar_tmp = scalar;
+        scalar_tmp.DivBy2ExpInPlace(window_offset);
+        uint64_t idx = scalar_tmp[0] % (1 << ctx_.window_bits);
+        if (idx != 0) {
+          buckets.Add(idx - 1, *bases_it);
+        }
+      }
+    }
+    *out = buckets.Accumulate(window_sum);
+  }
+
   template <typename BaseInputIterator>
   void AccumulateWindowSums(BaseInputIterator bases_first,
                             absl::Span<const BigInt<N>> scalars,
@@ -218,7 +801,12 @@ class Pippenger : public PippengerBase<Point> {
   }
 
   bool use_msm_window_naf_ = false;
+  bool use_batch_affine_ = false;
+  bool use_glv_ = false;
+  bool use_bucket_sorting_ = false;
+  bool use_scalar_classification_ = true;
   bool parallel_windows_ = false;
+  unsigned int window_bits_ = 0;
   MSMCtx ctx_;
 };
 
@@ -6,22 +6,33 @@
 #include <vector>
 
 #include "tachyon/math/elliptic_curves/msm/algorithms/pippenger/pippenger.h"
+#include "tachyon/math/elliptic_curves/msm/algorithms/pippenger/pippenger_parallel_strategy.h"
 
 namespace tachyon::math {
 
-enum class PippengerParallelStrategy {
-  kNone,
-  kParallelWindow,
-  kParallelTerm,
-  kParallelWindowAndTerm,
-};
-
 template <typename Point>
 class PippengerAdapter {
  public:
   using ScalarField = typename Point::ScalarField;
   using Bucket = typename Pippenger<Point>::Bucket;
 
+  // See Pippenger::SetUseBatchAffine().
+  void SetUseBatchAffine(bool use_batch_affine) {
+    use_batch_affine_ = use_batch_affine;
+  }
+
+  // See Pippenger::SetUseGLV().
+  void SetUseGLV(bool use_glv) { use_glv_ = use_glv; }
+
+  // See Pippenger::SetUseScalarClassification().
+  void SetUseScalarClassification(bool use_scalar_classification) {
+    use_scalar_classification_ = use_scalar_classification;
+  }
+
+  // See Pippenger::SetWindowBits(). With |kParallelTerm| and
+  // |kParallelWindowAndTerm|, it applies to the MSM of each chunk.
+  void SetWindowBits(unsigned int window_bits) { window_bits_ = window_bits; }
+
   template <typename BaseInputIterator, typename ScalarInputIterator>
   [[nodiscard]] bool Run(BaseInputIterator bases_first,
                          BaseInputIterator bases_last,
@@ -40,10 +51,17 @@ class PippengerAdapter {
                                      PippengerParallelStrategy strategy,
                                      Bucket* ret) {
     if (strategy == PippengerParallelStrategy::kNone ||
-        strategy == PippengerParallelStrategy::kParallelWindow) {
+        strategy == PippengerParallelStrategy::kParallelWindow ||
+        strategy == PippengerParallelStrategy::kParallelBucket) {
       Pippenger<Point> pippenger;
       pippenger.SetParallelWindows(strategy ==
                                    PippengerParallelStrategy::kParallelWindow);
+      pippenger.SetUseBucketSorting(strategy ==
+                                    PippengerParallelStrategy::kParallelBucket);
+      pippenger.SetUseBatchAffine(use_batch_affine_);
+      pippenger.SetUseGLV(use_glv_);
+      pippenger.SetUseScalarClassification(use_scalar_classification_);
+      pippenger.SetWindowBits(window_bits_);
       return pippenger.Run(std::move(bases_first), std::move(bases_last),
                            std::move(scalars_first), std::move(scalars_last),
                            ret);
@@ -62,7 +80,9 @@ class PippengerAdapter {
 #if defined(TACHYON_HAS_OPENMP)
       int thread_nums = omp_get_max_threads();
       if (strategy == PippengerParallelStrategy::kParallelWindowAndTerm) {
-        size_t window_bits = MSMCtx::ComputeWindowsBits(scalars_size);
+        size_t window_bits = window_bits_ != 0
+                                 ? window_bits_
+                                 : MSMCtx::ComputeWindowsBits(scalars_size);
         size_t window_size =
             MSMCtx::ComputeWindowsCount<ScalarField>(window_bits);
         thread_nums = std::max(thread_nums / static_cast<int>(window_size), 2);
@@ -75,19 +95,25 @@ class PippengerAdapter {
         bool valid;
       };
 
-#if defined(TACHYON_HAS_OPENMP)
-      omp_set_num_threads(thread_nums);
-#endif
       size_t chunk_size = (scalars_size + thread_nums - 1) / thread_nums;
       size_t num_chunks = (scalars_size + chunk_size - 1) / chunk_size;
       std::vector<Result> results;
       results.resize(num_chunks);
-      OPENMP_PARALLEL_FOR(size_t i = 0; i < num_chunks; ++i) {
+      // NOTE: The thread count is given to this loop only, since
+      // omp_set_num_threads() would limit every later region of the process.
+#if defined(TACHYON_HAS_OPENMP)
+#pragma omp parallel for num_threads(thread_nums)
+#endif
+      for (size_t i = 0; i < num_chunks; ++i) {
         size_t start = i * chunk_size;
         size_t len = i == num_chunks - 1 ? scalars_size - start : chunk_size;
         Pippenger<Point> pippenger;
         pippenger.SetParallelWindows(
             strategy == PippengerParallelStrategy::kParallelWindowAndTerm);
+        pippenger.SetUseBatchAffine(use_batch_affine_);
+        pippenger.SetUseGLV(use_glv_);
+        pippenger.SetUseScalarClassification(use_scalar_classification_);
+        pippenger.SetWindowBits(window_bits_);
         auto bases_start = bases_first + start;
         auto bases_end = bases_start + len;
         auto scalars_start = scalars_first + start;
@@ -108,6 +134,59 @@ class PippengerAdapter {
       return true;
     }
   }
+
+  // Runs an MSM whose bases are read from |bases| |chunk_size| points at a
+  // time, so that only a chunk of them is held in memory. |bases| should
+  // provide size(), Read(), Prefetch() and Release() like MemoryMappedBases.
+  // While a chunk is computed with RunWithStrategy(), the next one is read
+  // ahead by the OS, and the partial sums of the chunks are added up at the
+  // end. |bases| may hold more points than the scalars.
+  template <typename BaseSource, typename ScalarInputIterator>
+  [[nodiscard]] bool RunStreaming(const BaseSource& bases,
+                                  ScalarInputIterator scalars_first,
+                                  ScalarInputIterator scalars_last,
+                                  size_t chunk_size,
+                                  PippengerParallelStrategy strategy,
+                                  Bucket* ret) {
+    CHECK_GT(chunk_size, size_t{0});
+    size_t scalars_size = std::distance(scalars_first, scalars_last);
+    if (scalars_size > bases.size()) {
+      LOG(ERROR) << "Too many scalars: " << scalars_size << " vs "
+                 << bases.size();
+      return false;
+    }
+
+    Bucket sum = Bucket::Zero();
+    std::vector<Point> chunk;
+    if (scalars_size > 0) {
+      bases.Prefetch(0, std::min(chunk_size, scalars_size));
+    }
+    for (size_t start = 0; start < scalars_size; start += chunk_size) {
+      size_t len = std::min(chunk_size, scalars_size - start);
+      if (!bases.Read(start, len, &chunk)) return false;
+      bases.Release(start, len);
+      size_t next = start + len;
+      if (next < scalars_size) {
+        bases.Prefetch(next, std::min(chunk_size, scalars_size - next));
+      }
+
+      Bucket partial;
+      auto scalars_start = scalars_first + start;
+      if (!RunWithStrategy(chunk.begin(), chunk.end(), scalars_start,
+                           scalars_start + len, strategy, &partial)) {
+        return false;
+      }
+      sum += partial;
+    }
+    *ret = std::move(sum);
+    return true;
+  }
+
+ private:
+  bool use_batch_affine_ = false;
+  bool use_glv_ = false;
+  bool use_scalar_classification_ = true;
+  unsigned int window_bits_ = 0;
 };
 
 }  // namespace tachyon::math
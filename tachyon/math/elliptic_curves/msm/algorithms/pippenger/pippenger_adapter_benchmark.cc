@@ -7,7 +7,7 @@
 namespace tachyon::math {
 
 template <typename Point, bool IsRandom,
-          enum PippengerParallelStrategy Strategy>
+          enum PippengerParallelStrategy Strategy, bool UseBatchAffine = false>
 void BM_PippengerAdapter(benchmark::State& state) {
   Point::Curve::Init();
   VariableBaseMSMTestSet<Point> test_set;
@@ -19,6 +19,7 @@ void BM_PippengerAdapter(benchmark::State& state) {
         state.range(0), 10, VariableBaseMSMMethod::kNone);
   }
   PippengerAdapter<Point> pippenger;
+  pippenger.SetUseBatchAffine(UseBatchAffine);
   using Bucket = typename PippengerAdapter<Point>::Bucket;
   Bucket ret;
   for (auto _ : state) {
@@ -53,6 +54,20 @@ void BM_PippengerAdapterNonUniformWithParallelTerm(benchmark::State& state) {
       state);
 }
 
+template <typename Point>
+void BM_PippengerAdapterRandomWithParallelTermAndBatchAffine(
+    benchmark::State& state) {
+  BM_PippengerAdapter<Point, true, PippengerParallelStrategy::kParallelTerm,
+                      true>(state);
+}
+
+template <typename Point>
+void BM_PippengerAdapterNonUniformWithParallelTermAndBatchAffine(
+    benchmark::State& state) {
+  BM_PippengerAdapter<Point, false, PippengerParallelStrategy::kParallelTerm,
+                      true>(state);
+}
+
 template <typename Point>
 void BM_PippengerAdapterRandomWithParallelWindowAndTerm(
     benchmark::State& state) {
@@ -67,6 +82,18 @@ void BM_PippengerAdapterNonUniformWithParallelWindowAndTerm(
                       PippengerParallelStrategy::kParallelWindowAndTerm>(state);
 }
 
+template <typename Point>
+void BM_PippengerAdapterRandomWithParallelBucket(benchmark::State& state) {
+  BM_PippengerAdapter<Point, true, PippengerParallelStrategy::kParallelBucket>(
+      state);
+}
+
+template <typename Point>
+void BM_PippengerAdapterNonUniformWithParallelBucket(benchmark::State& state) {
+  BM_PippengerAdapter<Point, false, PippengerParallelStrategy::kParallelBucket>(
+      state);
+}
+
 BENCHMARK_TEMPLATE(BM_PippengerAdapterRandomWithParallelWindow,
                    bn254::G1AffinePoint)
     ->RangeMultiplier(2)
@@ -83,6 +110,14 @@ BENCHMARK_TEMPLATE(BM_PippengerAdapterNonUniformWithParallelTerm,
                    bn254::G1AffinePoint)
     ->RangeMultiplier(2)
     ->Range(1 << 15, 1 << 20);
+BENCHMARK_TEMPLATE(BM_PippengerAdapterRandomWithParallelTermAndBatchAffine,
+                   bn254::G1AffinePoint)
+    ->RangeMultiplier(2)
+    ->Range(1 << 15, 1 << 20);
+BENCHMARK_TEMPLATE(BM_PippengerAdapterNonUniformWithParallelTermAndBatchAffine,
+                   bn254::G1AffinePoint)
+    ->RangeMultiplier(2)
+    ->Range(1 << 15, 1 << 20);
 BENCHMARK_TEMPLATE(BM_PippengerAdapterRandomWithParallelWindowAndTerm,
                    bn254::G1AffinePoint)
     ->RangeMultiplier(2)
@@ -91,6 +126,14 @@ BENCHMARK_TEMPLATE(BM_PippengerAdapterNonUniformWithParallelWindowAndTerm,
                    bn254::G1AffinePoint)
     ->RangeMultiplier(2)
     ->Range(1 << 15, 1 << 20);
+BENCHMARK_TEMPLATE(BM_PippengerAdapterRandomWithParallelBucket,
+                   bn254::G1AffinePoint)
+    ->RangeMultiplier(2)
+    ->Range(1 << 15, 1 << 20);
+BENCHMARK_TEMPLATE(BM_PippengerAdapterNonUniformWithParallelBucket,
+                   bn254::G1AffinePoint)
+    ->RangeMultiplier(2)
+    ->Range(1 << 15, 1 << 20);
 
 }  // namespace tachyon::math
 
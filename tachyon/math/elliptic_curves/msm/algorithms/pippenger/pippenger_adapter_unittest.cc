@@ -32,18 +32,27 @@ TEST_F(PippengerAdapterTest, RunWithStrategy) {
   const VariableBaseMSMTestSet<bn254::G1AffinePoint>& test_set =
       this->test_set_;
 
-  for (PippengerParallelStrategy strategy :
-       {PippengerParallelStrategy::kNone,
-        PippengerParallelStrategy::kParallelWindow,
-        PippengerParallelStrategy::kParallelTerm,
-        PippengerParallelStrategy::kParallelWindowAndTerm}) {
-    PippengerAdapter<bn254::G1AffinePoint> pippenger;
-    SCOPED_TRACE(absl::Substitute("strategy: $0", static_cast<int>(strategy)));
-    bn254::G1PointXYZZ ret;
-    EXPECT_TRUE(pippenger.RunWithStrategy(
-        test_set.bases.begin(), test_set.bases.end(), test_set.scalars.begin(),
-        test_set.scalars.end(), strategy, &ret));
-    EXPECT_EQ(ret, test_set.answer);
+  for (bool use_glv : {false, true}) {
+    for (bool use_batch_affine : {false, true}) {
+      for (PippengerParallelStrategy strategy :
+           {PippengerParallelStrategy::kNone,
+            PippengerParallelStrategy::kParallelWindow,
+            PippengerParallelStrategy::kParallelTerm,
+            PippengerParallelStrategy::kParallelWindowAndTerm,
+            PippengerParallelStrategy::kParallelBucket}) {
+        PippengerAdapter<bn254::G1AffinePoint> pippenger;
+        SCOPED_TRACE(absl::Substitute(
+            "strategy: $0 use_batch_affine: $1 use_glv: $2",
+            static_cast<int>(strategy), use_batch_affine, use_glv));
+        pippenger.SetUseBatchAffine(use_batch_affine);
+        pippenger.SetUseGLV(use_glv);
+        bn254::G1PointXYZZ ret;
+        EXPECT_TRUE(pippenger.RunWithStrategy(
+            test_set.bases.begin(), test_set.bases.end(),
+            test_set.scalars.begin(), test_set.scalars.end(), strategy, &ret));
+        EXPECT_EQ(ret, test_set.answer);
+      }
+    }
   }
 }
 
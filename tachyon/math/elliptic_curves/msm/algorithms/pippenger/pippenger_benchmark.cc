@@ -2,11 +2,13 @@
 
 #include "tachyon/base/logging.h"
 #include "tachyon/math/elliptic_curves/bn/bn254/g1.h"
+#include "tachyon/math/elliptic_curves/msm/algorithms/pippenger/pippenger_with_precomputation.h"
 #include "tachyon/math/elliptic_curves/msm/test/variable_base_msm_test_set.h"
 
 namespace tachyon::math {
 
-template <typename Point, bool IsRandom>
+template <typename Point, bool IsRandom, bool UseBatchAffine = false,
+          bool UseGLV = false>
 void BM_Pippenger(benchmark::State& state) {
   Point::Curve::Init();
   VariableBaseMSMTestSet<Point> test_set;
@@ -18,6 +20,8 @@ void BM_Pippenger(benchmark::State& state) {
         state.range(0), 10, VariableBaseMSMMethod::kNone);
   }
   Pippenger<Point> pippenger;
+  pippenger.SetUseBatchAffine(UseBatchAffine);
+  pippenger.SetUseGLV(UseGLV);
   using Bucket = typename Pippenger<Point>::Bucket;
   Bucket ret;
   for (auto _ : state) {
@@ -38,12 +42,93 @@ void BM_PippengerNonUniform(benchmark::State& state) {
   BM_Pippenger<Point, false>(state);
 }
 
+template <typename Point>
+void BM_PippengerRandomWithBatchAffine(benchmark::State& state) {
+  BM_Pippenger<Point, true, true>(state);
+}
+
+template <typename Point>
+void BM_PippengerNonUniformWithBatchAffine(benchmark::State& state) {
+  BM_Pippenger<Point, false, true>(state);
+}
+
+template <typename Point>
+void BM_PippengerRandomWithGLV(benchmark::State& state) {
+  BM_Pippenger<Point, true, false, true>(state);
+}
+
+template <typename Point>
+void BM_PippengerRandomWithBatchAffineAndGLV(benchmark::State& state) {
+  BM_Pippenger<Point, true, true, true>(state);
+}
+
+template <typename Point, bool UseScalarClassification>
+void BM_PippengerSparse(benchmark::State& state) {
+  Point::Curve::Init();
+  VariableBaseMSMTestSet<Point> test_set =
+      VariableBaseMSMTestSet<Point>::Sparse(state.range(0),
+                                            VariableBaseMSMMethod::kNone);
+  Pippenger<Point> pippenger;
+  pippenger.SetUseScalarClassification(UseScalarClassification);
+  using Bucket = typename Pippenger<Point>::Bucket;
+  Bucket ret;
+  for (auto _ : state) {
+    CHECK(pippenger.Run(test_set.bases.begin(), test_set.bases.end(),
+                        test_set.scalars.begin(), test_set.scalars.end(),
+                        &ret));
+  }
+  benchmark::DoNotOptimize(ret);
+}
+
+template <typename Point, size_t TableSize>
+void BM_PippengerRandomWithPrecomputation(benchmark::State& state) {
+  Point::Curve::Init();
+  VariableBaseMSMTestSet<Point> test_set =
+      VariableBaseMSMTestSet<Point>::Random(state.range(0),
+                                            VariableBaseMSMMethod::kNone);
+  PippengerWithPrecomputation<Point> pippenger;
+  CHECK(pippenger.Precompute(test_set.bases, TableSize));
+  using Bucket = typename Pippenger<Point>::Bucket;
+  Bucket ret;
+  for (auto _ : state) {
+    CHECK(pippenger.Run(test_set.bases, test_set.scalars, &ret));
+  }
+  benchmark::DoNotOptimize(ret);
+}
+
 BENCHMARK_TEMPLATE(BM_PippengerRandom, bn254::G1AffinePoint)
     ->RangeMultiplier(2)
     ->Range(1 << 15, 1 << 20);
 BENCHMARK_TEMPLATE(BM_PippengerNonUniform, bn254::G1AffinePoint)
     ->RangeMultiplier(2)
     ->Range(1 << 15, 1 << 20);
+BENCHMARK_TEMPLATE(BM_PippengerRandomWithBatchAffine, bn254::G1AffinePoint)
+    ->RangeMultiplier(2)
+    ->Range(1 << 15, 1 << 20);
+BENCHMARK_TEMPLATE(BM_PippengerNonUniformWithBatchAffine, bn254::G1AffinePoint)
+    ->RangeMultiplier(2)
+    ->Range(1 << 15, 1 << 20);
+BENCHMARK_TEMPLATE(BM_PippengerRandomWithGLV, bn254::G1AffinePoint)
+    ->RangeMultiplier(2)
+    ->Range(1 << 15, 1 << 20);
+BENCHMARK_TEMPLATE(BM_PippengerRandomWithBatchAffineAndGLV,
+                   bn254::G1AffinePoint)
+    ->RangeMultiplier(2)
+    ->Range(1 << 15, 1 << 20);
+BENCHMARK_TEMPLATE(BM_PippengerSparse, bn254::G1AffinePoint, false)
+    ->RangeMultiplier(2)
+    ->Range(1 << 15, 1 << 20);
+BENCHMARK_TEMPLATE(BM_PippengerSparse, bn254::G1AffinePoint, true)
+    ->RangeMultiplier(2)
+    ->Range(1 << 15, 1 << 20);
+BENCHMARK_TEMPLATE(BM_PippengerRandomWithPrecomputation, bn254::G1AffinePoint,
+                   4)
+    ->RangeMultiplier(2)
+    ->Range(1 << 15, 1 << 20);
+BENCHMARK_TEMPLATE(BM_PippengerRandomWithPrecomputation, bn254::G1AffinePoint,
+                   16)
+    ->RangeMultiplier(2)
+    ->Range(1 << 15, 1 << 20);
 
 }  // namespace tachyon::math
 
@@ -0,0 +1,45 @@
+#include "tachyon/math/elliptic_curves/msm/algorithms/pippenger/pippenger_parallel_strategy.h"
+
+#include "absl/strings/substitute.h"
+
+#include "tachyon/base/logging.h"
+
+namespace tachyon::math {
+
+std::string_view PippengerParallelStrategyToString(
+    PippengerParallelStrategy strategy) {
+  switch (strategy) {
+    case PippengerParallelStrategy::kNone:
+      return "none";
+    case PippengerParallelStrategy::kParallelWindow:
+      return "parallel_window";
+    case PippengerParallelStrategy::kParallelTerm:
+      return "parallel_term";
+    case PippengerParallelStrategy::kParallelWindowAndTerm:
+      return "parallel_window_and_term";
+    case PippengerParallelStrategy::kParallelBucket:
+      return "parallel_bucket";
+  }
+  NOTREACHED();
+  return "";
+}
+
+bool ParsePippengerParallelStrategy(std::string_view input,
+                                    PippengerParallelStrategy* strategy,
+                                    std::string* reason) {
+  for (PippengerParallelStrategy candidate :
+       {PippengerParallelStrategy::kNone,
+        PippengerParallelStrategy::kParallelWindow,
+        PippengerParallelStrategy::kParallelTerm,
+        PippengerParallelStrategy::kParallelWindowAndTerm,
+        PippengerParallelStrategy::kParallelBucket}) {
+    if (input == PippengerParallelStrategyToString(candidate)) {
+      *strategy = candidate;
+      return true;
+    }
+  }
+  *reason = absl::Substitute("Unknown parallel strategy: $0", input);
+  return false;
+}
+
+}  // namespace tachyon::math
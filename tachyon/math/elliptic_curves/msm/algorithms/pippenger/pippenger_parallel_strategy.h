@@ -0,0 +1,32 @@
+#ifndef TACHYON_MATH_ELLIPTIC_CURVES_MSM_ALGORITHMS_PIPPENGER_PIPPENGER_PARALLEL_STRATEGY_H_
+#define TACHYON_MATH_ELLIPTIC_CURVES_MSM_ALGORITHMS_PIPPENGER_PIPPENGER_PARALLEL_STRATEGY_H_
+
+#include <string>
+#include <string_view>
+
+#include "tachyon/export.h"
+
+namespace tachyon::math {
+
+enum class PippengerParallelStrategy {
+  kNone,
+  kParallelWindow,
+  kParallelTerm,
+  kParallelWindowAndTerm,
+  // The points of each window are sorted by bucket and threads accumulate
+  // disjoint ranges of buckets. See Pippenger::SetUseBucketSorting().
+  kParallelBucket,
+};
+
+TACHYON_EXPORT std::string_view PippengerParallelStrategyToString(
+    PippengerParallelStrategy strategy);
+
+// Parses |input| written by PippengerParallelStrategyToString(). Returns false
+// and populates |reason| if |input| is unknown.
+TACHYON_EXPORT bool ParsePippengerParallelStrategy(
+    std::string_view input, PippengerParallelStrategy* strategy,
+    std::string* reason);
+
+}  // namespace tachyon::math
+
+#endif  // TACHYON_MATH_ELLIPTIC_CURVES_MSM_ALGORITHMS_PIPPENGER_PIPPENGER_PARALLEL_STRATEGY_H_
@@ -37,6 +37,24 @@ using PointTypes =
                    bls12_381::G1AffinePoint>;
 TYPED_TEST_SUITE(PippengerTest, PointTypes);
 
+TEST(FillDigitsTest, Strided) {
+  constexpr size_t kWindowBits = 13;
+  constexpr size_t kWindowCount = 20;
+  constexpr size_t kStride = 3;
+
+  for (size_t i = 0; i < 10; ++i) {
+    BigInt<4> scalar = bn254::Fr::Random().ToBigInt();
+    std::vector<int64_t> expected(kWindowCount);
+    FillDigits(scalar, kWindowBits, &expected);
+
+    std::vector<int16_t> digits(kWindowCount * kStride);
+    FillDigits(scalar, kWindowBits, kWindowCount, &digits[1], kStride);
+    for (size_t j = 0; j < kWindowCount; ++j) {
+      EXPECT_EQ(digits[1 + j * kStride], expected[j]);
+    }
+  }
+}
+
 TYPED_TEST(PippengerTest, Run) {
   using Point = TypeParam;
   using Bucket = typename Pippenger<Point>::Bucket;
@@ -46,21 +64,121 @@ TYPED_TEST(PippengerTest, Run) {
   struct {
     bool use_window_naf;
     bool parallel_windows;
+    bool use_batch_affine;
   } tests[] = {
-    {false, false},
-    {true, false},
+    {false, false, false},
+    {true, false, false},
+    {false, false, true},
+    {true, false, true},
 #if defined(TACHYON_HAS_OPENMP)
-    {false, true},
-    {true, true},
+    {false, true, false},
+    {true, true, false},
+    {false, true, true},
+    {true, true, true},
 #endif  // defined(TACHYON_HAS_OPENMP)
   };
 
   for (const auto& test : tests) {
     Pippenger<Point> pippenger;
-    SCOPED_TRACE(absl::Substitute("use_window_naf: $0 parallel_windows: $1",
-                                  test.use_window_naf, test.parallel_windows));
+    SCOPED_TRACE(absl::Substitute(
+        "use_window_naf: $0 parallel_windows: $1 use_batch_affine: $2",
+        test.use_window_naf, test.parallel_windows, test.use_batch_affine));
     pippenger.SetUseMSMWindowNAForTesting(test.use_window_naf);
     pippenger.SetParallelWindows(test.parallel_windows);
+    pippenger.SetUseBatchAffine(test.use_batch_affine);
+    Bucket ret;
+    EXPECT_TRUE(pippenger.Run(test_set.bases.begin(), test_set.bases.end(),
+                              test_set.scalars.begin(), test_set.scalars.end(),
+                              &ret));
+    EXPECT_EQ(ret, test_set.answer);
+  }
+}
+
+TYPED_TEST(PippengerTest, RunWithSparseScalars) {
+  using Point = TypeParam;
+  using Bucket = typename Pippenger<Point>::Bucket;
+
+  VariableBaseMSMTestSet<Point> test_set =
+      VariableBaseMSMTestSet<Point>::Sparse(kSize,
+                                            VariableBaseMSMMethod::kNaive);
+
+  for (bool use_scalar_classification : {false, true}) {
+    for (bool use_glv : {false, true}) {
+      for (bool use_bucket_sorting : {false, true}) {
+        Pippenger<Point> pippenger;
+        SCOPED_TRACE(absl::Substitute(
+            "use_scalar_classification: $0 use_glv: $1 use_bucket_sorting: $2",
+            use_scalar_classification, use_glv, use_bucket_sorting));
+        pippenger.SetUseScalarClassification(use_scalar_classification);
+        pippenger.SetUseGLV(use_glv);
+        pippenger.SetUseBucketSorting(use_bucket_sorting);
+        Bucket ret;
+        EXPECT_TRUE(pippenger.Run(test_set.bases.begin(), test_set.bases.end(),
+                                  test_set.scalars.begin(),
+                                  test_set.scalars.end(), &ret));
+        EXPECT_EQ(ret, test_set.answer);
+      }
+    }
+  }
+}
+
+TYPED_TEST(PippengerTest, RunWithWindowBits) {
+  using Point = TypeParam;
+  using Bucket = typename Pippenger<Point>::Bucket;
+
+  VariableBaseMSMTestSet<Point> test_set =
+      VariableBaseMSMTestSet<Point>::Random(kSize,
+                                            VariableBaseMSMMethod::kNaive);
+
+  for (unsigned int window_bits : {1, 2, 7, 16}) {
+    for (bool use_glv : {false, true}) {
+      Pippenger<Point> pippenger;
+      SCOPED_TRACE(absl::Substitute("window_bits: $0 use_glv: $1",
+                                    window_bits, use_glv));
+      pippenger.SetWindowBits(window_bits);
+      pippenger.SetUseGLV(use_glv);
+      Bucket ret;
+      EXPECT_TRUE(pippenger.Run(test_set.bases.begin(), test_set.bases.end(),
+                                test_set.scalars.begin(),
+                                test_set.scalars.end(), &ret));
+      EXPECT_EQ(ret, test_set.answer);
+    }
+  }
+}
+
+TYPED_TEST(PippengerTest, RunBatchWithWindowBits) {
+  using Point = TypeParam;
+  using Bucket = typename Pippenger<Point>::Bucket;
+  using ScalarField = typename Point::ScalarField;
+
+  const VariableBaseMSMTestSet<Point>& test_set = this->test_set_;
+  std::vector<absl::Span<const ScalarField>> scalars_list = {
+      absl::MakeConstSpan(test_set.scalars)};
+
+  // 16 takes the int32_t digits.
+  for (unsigned int window_bits : {1, 2, 7, 16}) {
+    Pippenger<Point> pippenger;
+    SCOPED_TRACE(absl::Substitute("window_bits: $0", window_bits));
+    pippenger.SetWindowBits(window_bits);
+    std::vector<Bucket> rets;
+    ASSERT_TRUE(pippenger.RunBatch(test_set.bases.begin(), test_set.bases.end(),
+                                   scalars_list, &rets));
+    ASSERT_EQ(rets.size(), 1u);
+    EXPECT_EQ(rets[0], test_set.answer);
+  }
+}
+
+TYPED_TEST(PippengerTest, RunWithBucketSorting) {
+  using Point = TypeParam;
+  using Bucket = typename Pippenger<Point>::Bucket;
+
+  const VariableBaseMSMTestSet<Point>& test_set = this->test_set_;
+
+  for (bool use_window_naf : {false, true}) {
+    Pippenger<Point> pippenger;
+    SCOPED_TRACE(absl::Substitute("use_window_naf: $0", use_window_naf));
+    pippenger.SetUseMSMWindowNAForTesting(use_window_naf);
+    pippenger.SetUseBucketSorting(true);
     Bucket ret;
     EXPECT_TRUE(pippenger.Run(test_set.bases.begin(), test_set.bases.end(),
                               test_set.scalars.begin(), test_set.scalars.end(),
@@ -69,4 +187,27 @@ TYPED_TEST(PippengerTest, Run) {
   }
 }
 
+TYPED_TEST(PippengerTest, RunWithGLV) {
+  using Point = TypeParam;
+  using Bucket = typename Pippenger<Point>::Bucket;
+
+  const VariableBaseMSMTestSet<Point>& test_set = this->test_set_;
+
+  for (bool use_window_naf : {false, true}) {
+    for (bool use_batch_affine : {false, true}) {
+      Pippenger<Point> pippenger;
+      SCOPED_TRACE(absl::Substitute("use_window_naf: $0 use_batch_affine: $1",
+                                    use_window_naf, use_batch_affine));
+      pippenger.SetUseMSMWindowNAForTesting(use_window_naf);
+      pippenger.SetUseBatchAffine(use_batch_affine);
+      pippenger.SetUseGLV(true);
+      Bucket ret;
+      EXPECT_TRUE(pippenger.Run(test_set.bases.begin(), test_set.bases.end(),
+                                test_set.scalars.begin(),
+                                test_set.scalars.end(), &ret));
+      EXPECT_EQ(ret, test_set.answer);
+    }
+  }
+}
+
 }  // namespace tachyon::math
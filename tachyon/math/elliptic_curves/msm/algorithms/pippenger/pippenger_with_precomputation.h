@@ -0,0 +1,291 @@
+#ifndef TACHYON_MATH_ELLIPTIC_CURVES_MSM_ALGORITHMS_PIPPENGER_PIPPENGER_WITH_PRECOMPUTATION_H_
+#define TACHYON_MATH_ELLIPTIC_CURVES_MSM_ALGORITHMS_PIPPENGER_PIPPENGER_WITH_PRECOMPUTATION_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "absl/types/span.h"
+
+#include "tachyon/base/buffer/copyable.h"
+#include "tachyon/base/logging.h"
+#include "tachyon/base/openmp_util.h"
+#include "tachyon/math/base/big_int.h"
+#include "tachyon/math/elliptic_curves/msm/algorithms/pippenger/pippenger.h"
+#include "tachyon/math/elliptic_curves/msm/msm_ctx.h"
+#include "tachyon/math/elliptic_curves/point_conversions.h"
+
+namespace tachyon::math {
+
+// PippengerWithPrecomputation runs Pippenger's algorithm over a fixed set of
+// bases, for which multiples are precomputed once.
+//
+// Let c be |window_bits_|, w be the number of windows and t be
+// |table_size_|. The windows are split into t groups of g = ⌈w / t⌉ windows
+// and Gᵢ,ⱼ = 2^(j * g * c) * Gᵢ for j in [0, t). Gᵢ,₀ is the base itself,
+// which is passed to Run(), so only Gᵢ,ⱼ for j in [1, t) are stored. Then
+//
+//   Σᵢ sᵢ * Gᵢ = Σᵣ 2^(r * c) * (Σᵢ,ⱼ dᵢ,ⱼ₊ᵣ * Gᵢ,ⱼ),
+//
+// where dᵢ,ₖ is the k-th window digit of sᵢ and r is in [0, g). This reduces
+// the window sums to be merged from w to g, and the doublings from
+// (w - 1) * c to (g - 1) * c, at the cost of storing t - 1 points per base.
+// When t is 1, this is equivalent to the plain Pippenger.
+template <typename Point>
+class PippengerWithPrecomputation {
+ public:
+  using ScalarField = typename Point::ScalarField;
+  using Bucket = typename Pippenger<Point>::Bucket;
+
+  constexpr static size_t N = ScalarField::N;
+
+  PippengerWithPrecomputation() = default;
+
+  const std::vector<Point>& table() const { return table_; }
+  size_t window_bits() const { return window_bits_; }
+  size_t table_size() const { return table_size_; }
+
+  size_t bases_size() const { return bases_size_; }
+
+  bool IsEmpty() const { return bases_size_ == 0; }
+
+  // Builds the table of multiples of |bases|. |table_size| is the number of
+  // multiples per base, including the base itself, and is clamped to the
+  // number of windows.
+  [[nodiscard]] bool Precompute(absl::Span<const Point> bases,
+                                size_t table_size) {
+    if (table_size == 0) {
+      LOG(ERROR) << "table_size should be positive";
+      return false;
+    }
+    size_t window_bits =
+        MSMCtx::ComputeWindowsBits(std::max(bases.size() * table_size,
+                                            size_t{1}));
+    size_t window_count =
+        MSMCtx::ComputeWindowsCount<ScalarField>(window_bits);
+    size_t group_size = (window_count + table_size - 1) / table_size;
+    table_size = (window_count + group_size - 1) / group_size;
+
+    std::vector<Bucket> multiples(bases.size() * (table_size - 1));
+    OPENMP_PARALLEL_FOR(size_t i = 0; i < bases.size(); ++i) {
+      Bucket multiple = Bucket::Zero();
+      multiple += bases[i];
+      for (size_t j = 1; j < table_size; ++j) {
+        for (size_t k = 0; k < group_size * window_bits; ++k) {
+          multiple.DoubleInPlace();
+        }
+        multiples[i * (table_size - 1) + j - 1] = multiple;
+      }
+    }
+
+    std::vector<Point> table(multiples.size());
+    if constexpr (std::is_same_v<Point, Bucket>) {
+      table = std::move(multiples);
+    } else if constexpr (std::is_same_v<Point,
+                                        AffinePoint<typename Point::Curve>>) {
+      if (!Bucket::BatchNormalize(multiples, &table)) return false;
+    } else {
+      if (!ConvertPoints(multiples, &table)) return false;
+    }
+    return Load(window_bits, table_size, bases.size(), std::move(table));
+  }
+
+  // Sets the table precomputed with |window_bits| and |table_size| for
+  // |bases_size| bases. Returns false if they don't describe |table|.
+  [[nodiscard]] bool Load(size_t window_bits, size_t table_size,
+                          size_t bases_size, std::vector<Point>&& table) {
+    if (bases_size == 0) {
+      if (!table.empty()) {
+        LOG(ERROR) << "Table without bases";
+        return false;
+      }
+      *this = PippengerWithPrecomputation();
+      return true;
+    }
+    if (window_bits == 0 || window_bits > 30 || table_size == 0) {
+      LOG(ERROR) << "Invalid window_bits or table_size";
+      return false;
+    }
+    size_t window_count =
+        MSMCtx::ComputeWindowsCount<ScalarField>(window_bits);
+    size_t group_size = (window_count + table_size - 1) / table_size;
+    if ((window_count + group_size - 1) / group_size != table_size ||
+        table.size() != bases_size * (table_size - 1)) {
+      LOG(ERROR) << "Table doesn't match window_bits, table_size and "
+                    "bases_size";
+      return false;
+    }
+    window_bits_ = window_bits;
+    window_count_ = window_count;
+    group_size_ = group_size;
+    table_size_ = table_size;
+    bases_size_ = bases_size;
+    table_ = std::move(table);
+    return true;
+  }
+
+  // Keeps the multiples of the first |n| bases only.
+  [[nodiscard]] bool Downsize(size_t n) {
+    if (n > bases_size_) return false;
+    bases_size_ = n;
+    table_.resize(n * (table_size_ - 1));
+    return true;
+  }
+
+  // Computes Σᵢ sᵢ * Gᵢ over the first |std::size(scalars)| of |bases|, which
+  // should be the ones given to Precompute().
+  template <typename ScalarContainer>
+  [[nodiscard]] bool Run(absl::Span<const Point> bases,
+                         const ScalarContainer& scalars, Bucket* ret) const {
+    size_t scalars_size = std::size(scalars);
+    if (scalars_size > bases_size_ || scalars_size > bases.size()) {
+      LOG(ERROR) << "Too many scalars: " << scalars_size << " vs "
+                 << std::min(bases_size_, bases.size());
+      return false;
+    }
+    if (scalars_size == 0) {
+      *ret = Bucket::Zero();
+      return true;
+    }
+
+    // Window-major digits of the scalars.
+    std::vector<int32_t> digits(scalars_size * window_count_);
+    OPENMP_PARALLEL_FOR(size_t i = 0; i < scalars_size; ++i) {
+      FillScalarDigits(scalars[i].ToBigInt(), &digits[i * window_count_]);
+    }
+
+#if defined(TACHYON_HAS_OPENMP)
+    size_t thread_nums = static_cast<size_t>(omp_get_max_threads());
+#else
+    size_t thread_nums = 1;
+#endif  // defined(TACHYON_HAS_OPENMP)
+    size_t chunk_size = (scalars_size + thread_nums - 1) / thread_nums;
+    size_t num_chunks = (scalars_size + chunk_size - 1) / chunk_size;
+    std::vector<std::vector<Bucket>> group_sums(num_chunks);
+    OPENMP_PARALLEL_FOR(size_t i = 0; i < num_chunks; ++i) {
+      size_t start = i * chunk_size;
+      size_t len = i == num_chunks - 1 ? scalars_size - start : chunk_size;
+      group_sums[i] = AccumulateGroupSums(bases, digits, start, len);
+    }
+
+    std::vector<Bucket> window_sums = std::move(group_sums[0]);
+    for (size_t i = 1; i < num_chunks; ++i) {
+      for (size_t r = 0; r < group_size_; ++r) {
+        window_sums[r] += group_sums[i][r];
+      }
+    }
+    *ret = PippengerBase<Point>::AccumulateWindowSums(
+        absl::MakeConstSpan(window_sums), window_bits_);
+    return true;
+  }
+
+ private:
+  void FillScalarDigits(const BigInt<N>& scalar, int32_t* digits) const {
+    if constexpr (Point::kNegationIsCheap) {
+      FillDigits(scalar, window_bits_, window_count_, digits);
+    } else {
+      for (size_t k = 0; k < window_count_; ++k) {
+        digits[k] = static_cast<int32_t>(
+            scalar.ExtractBits64(k * window_bits_, window_bits_));
+      }
+    }
+  }
+
+  size_t GetBucketSize(size_t r) const {
+    if constexpr (Point::kNegationIsCheap) {
+      // The last window absorbs the final carry of FillDigits().
+      return (r == (window_count_ - 1) % group_size_)
+                 ? size_t{1} << window_bits_
+                 : size_t{1} << (window_bits_ - 1);
+    } else {
+      return (size_t{1} << window_bits_) - 1;
+    }
+  }
+
+  std::vector<Bucket> AccumulateGroupSums(absl::Span<const Point> bases,
+                                          const std::vector<int32_t>& digits,
+                                          size_t start, size_t len) const {
+    std::vector<Bucket> window_sums(group_size_);
+    for (size_t r = 0; r < group_size_; ++r) {
+      std::vector<Bucket> buckets(GetBucketSize(r));
+      for (size_t i = start; i < start + len; ++i) {
+        const int32_t* scalar_digits = &digits[i * window_count_];
+        const Point* multiples = table_.data() + i * (table_size_ - 1);
+        for (size_t j = 0; j < table_size_; ++j) {
+          size_t k = j * group_size_ + r;
+          if (k >= window_count_) break;
+          int32_t digit = scalar_digits[k];
+          if (digit == 0) continue;
+          const Point& multiple = j == 0 ? bases[i] : multiples[j - 1];
+          if (0 < digit) {
+            buckets[static_cast<uint64_t>(digit - 1)] += multiple;
+          } else {
+            buckets[static_cast<uint64_t>(-digit - 1)] -= multiple;
+          }
+        }
+      }
+      window_sums[r] =
+          PippengerBase<Point>::AccumulateBuckets(absl::MakeConstSpan(buckets));
+    }
+    return window_sums;
+  }
+
+  // Base-major table: |table_[i * (table_size_ - 1) + j - 1]| =
+  // 2^(j * g * c) * Gᵢ for j in [1, t).
+  std::vector<Point> table_;
+  size_t window_bits_ = 0;
+  size_t window_count_ = 0;
+  // The number of windows covered by each multiple, g.
+  size_t group_size_ = 0;
+  // The number of multiples per base including the base itself, t.
+  size_t table_size_ = 0;
+  size_t bases_size_ = 0;
+};
+
+}  // namespace tachyon::math
+
+namespace tachyon::base {
+
+template <typename Point>
+class Copyable<math::PippengerWithPrecomputation<Point>> {
+ public:
+  using Precomputation = math::PippengerWithPrecomputation<Point>;
+
+  static bool WriteTo(const Precomputation& precomputation, Buffer* buffer) {
+    return buffer->WriteMany(
+        precomputation.window_bits(), precomputation.table_size(),
+        precomputation.bases_size(), precomputation.table());
+  }
+
+  static bool ReadFrom(const ReadOnlyBuffer& buffer,
+                       Precomputation* precomputation) {
+    size_t window_bits;
+    size_t table_size;
+    size_t bases_size;
+    std::vector<Point> table;
+    if (!buffer.ReadMany(&window_bits, &table_size, &bases_size, &table)) {
+      return false;
+    }
+    Precomputation value;
+    if (!value.Load(window_bits, table_size, bases_size, std::move(table))) {
+      return false;
+    }
+    *precomputation = std::move(value);
+    return true;
+  }
+
+  static size_t EstimateSize(const Precomputation& precomputation) {
+    return base::EstimateSize(
+        precomputation.window_bits(), precomputation.table_size(),
+        precomputation.bases_size(), precomputation.table());
+  }
+};
+
+}  // namespace tachyon::base
+
+#endif  // TACHYON_MATH_ELLIPTIC_CURVES_MSM_ALGORITHMS_PIPPENGER_PIPPENGER_WITH_PRECOMPUTATION_H_
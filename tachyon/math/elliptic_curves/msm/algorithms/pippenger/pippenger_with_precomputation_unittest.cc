@@ -0,0 +1,118 @@
+#include "tachyon/math/elliptic_curves/msm/algorithms/pippenger/pippenger_with_precomputation.h"
+
+#include "absl/strings/substitute.h"
+#include "gtest/gtest.h"
+
+#include "tachyon/base/buffer/vector_buffer.h"
+#include "tachyon/math/elliptic_curves/bn/bn254/g1.h"
+#include "tachyon/math/elliptic_curves/msm/test/variable_base_msm_test_set.h"
+
+namespace tachyon::math {
+
+namespace {
+
+const size_t kSize = 40;
+
+template <typename Point>
+class PippengerWithPrecomputationTest : public testing::Test {
+ public:
+  static void SetUpTestSuite() { Point::Curve::Init(); }
+
+  PippengerWithPrecomputationTest()
+      : test_set_(VariableBaseMSMTestSet<Point>::Random(
+            kSize, VariableBaseMSMMethod::kNaive)) {}
+  PippengerWithPrecomputationTest(const PippengerWithPrecomputationTest&) =
+      delete;
+  PippengerWithPrecomputationTest& operator=(
+      const PippengerWithPrecomputationTest&) = delete;
+  ~PippengerWithPrecomputationTest() override = default;
+
+ protected:
+  VariableBaseMSMTestSet<Point> test_set_;
+};
+
+}  // namespace
+
+using PointTypes =
+    testing::Types<bn254::G1AffinePoint, bn254::G1JacobianPoint,
+                   bn254::G1PointXYZZ>;
+TYPED_TEST_SUITE(PippengerWithPrecomputationTest, PointTypes);
+
+TYPED_TEST(PippengerWithPrecomputationTest, Run) {
+  using Point = TypeParam;
+  using Bucket = typename Pippenger<Point>::Bucket;
+
+  const VariableBaseMSMTestSet<Point>& test_set = this->test_set_;
+
+  for (size_t table_size : {1, 2, 5, 100}) {
+    SCOPED_TRACE(absl::Substitute("table_size: $0", table_size));
+    PippengerWithPrecomputation<Point> pippenger;
+    ASSERT_TRUE(pippenger.Precompute(test_set.bases, table_size));
+    EXPECT_EQ(pippenger.bases_size(), kSize);
+    EXPECT_LE(pippenger.table_size(), table_size);
+    // The bases themselves are not stored.
+    EXPECT_EQ(pippenger.table().size(), kSize * (pippenger.table_size() - 1));
+
+    Bucket ret;
+    ASSERT_TRUE(pippenger.Run(test_set.bases, test_set.scalars, &ret));
+    EXPECT_EQ(ret, test_set.answer);
+  }
+}
+
+TYPED_TEST(PippengerWithPrecomputationTest, RunWithFewerScalars) {
+  using Point = TypeParam;
+  using Bucket = typename Pippenger<Point>::Bucket;
+  using ScalarField = typename Point::ScalarField;
+
+  const VariableBaseMSMTestSet<Point>& test_set = this->test_set_;
+
+  PippengerWithPrecomputation<Point> pippenger;
+  ASSERT_TRUE(pippenger.Precompute(test_set.bases, 4));
+
+  std::vector<ScalarField> scalars(test_set.scalars.begin(),
+                                   test_set.scalars.begin() + kSize / 2);
+  Bucket expected;
+  Pippenger<Point> plain_pippenger;
+  ASSERT_TRUE(plain_pippenger.Run(test_set.bases.begin(),
+                                  test_set.bases.begin() + kSize / 2,
+                                  scalars.begin(), scalars.end(), &expected));
+  Bucket ret;
+  ASSERT_TRUE(pippenger.Run(test_set.bases, scalars, &ret));
+  EXPECT_EQ(ret, expected);
+
+  ASSERT_TRUE(pippenger.Downsize(kSize / 2));
+  ASSERT_TRUE(pippenger.Run(test_set.bases, scalars, &ret));
+  EXPECT_EQ(ret, expected);
+  EXPECT_FALSE(pippenger.Run(test_set.bases, test_set.scalars, &ret));
+}
+
+TYPED_TEST(PippengerWithPrecomputationTest, Copyable) {
+  using Point = TypeParam;
+  using Bucket = typename Pippenger<Point>::Bucket;
+
+  const VariableBaseMSMTestSet<Point>& test_set = this->test_set_;
+
+  PippengerWithPrecomputation<Point> expected;
+  ASSERT_TRUE(expected.Precompute(test_set.bases, 3));
+
+  base::Uint8VectorBuffer write_buf;
+  ASSERT_TRUE(write_buf.Grow(base::EstimateSize(expected)));
+  ASSERT_TRUE(write_buf.Write(expected));
+  ASSERT_TRUE(write_buf.Done());
+
+  write_buf.set_buffer_offset(0);
+
+  PippengerWithPrecomputation<Point> value;
+  ASSERT_TRUE(write_buf.Read(&value));
+
+  EXPECT_EQ(value.window_bits(), expected.window_bits());
+  EXPECT_EQ(value.table_size(), expected.table_size());
+  EXPECT_EQ(value.bases_size(), expected.bases_size());
+  EXPECT_EQ(value.table(), expected.table());
+
+  Bucket ret;
+  ASSERT_TRUE(value.Run(test_set.bases, test_set.scalars, &ret));
+  EXPECT_EQ(ret, test_set.answer);
+}
+
+}  // namespace tachyon::math
@@ -0,0 +1,190 @@
+#ifndef TACHYON_MATH_ELLIPTIC_CURVES_MSM_COMB_FIXED_BASE_MSM_H_
+#define TACHYON_MATH_ELLIPTIC_CURVES_MSM_COMB_FIXED_BASE_MSM_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <array>
+#include <vector>
+
+#include "absl/types/span.h"
+
+#include "tachyon/base/bits.h"
+#include "tachyon/base/logging.h"
+#include "tachyon/base/no_destructor.h"
+#include "tachyon/base/parallelize.h"
+#include "tachyon/math/base/semigroups.h"
+
+namespace tachyon::math {
+
+// CombFixedBaseMSM multiplies a fixed affine base point by many scalars with
+// the Lim-Lee comb method, and outputs affine points. Unlike FixedBaseMSM,
+// |Point| should be an affine point.
+//
+// The bits of an n-bit scalar are laid out in |teeth| rows of
+// |span| = ⌈n / |teeth|⌉ bits, and the columns of the rows are split into
+// |tables| blocks of |block_size| = ⌈|span| / |tables|⌉ columns:
+//
+//   row k = bits [k * span, (k + 1) * span) of the scalar
+//
+// The u-th table holds, for every |teeth|-bit index i, the sum of
+// 2^(k * span + u * block_size) * G over the set bits k of i. The j-th
+// column of the u-th block then selects a single entry of the u-th table, so
+// that a scalar multiplication takes |block_size| doublings and
+// |tables| * |block_size| mixed additions:
+//
+//   SG = Σⱼ 2ʲ Σᵤ Tᵤ[column u * block_size + j of the rows]
+//
+// The tables are kept in affine coordinates, and the rows are extracted from
+// the scalar a word at a time rather than a bit at a time. The results are
+// normalized to affine with a single batched inversion per chunk of scalars.
+template <typename Point>
+class CombFixedBaseMSM {
+ public:
+  using AddResult = typename internal::AdditiveSemigroupTraits<Point>::ReturnTy;
+  using ScalarField = typename Point::ScalarField;
+
+  constexpr static size_t kModulusBits = ScalarField::Config::kModulusBits;
+  // A row should fit in a word.
+  constexpr static size_t kMaxSpan = 63;
+  constexpr static size_t kMaxTeeth = 16;
+  constexpr static size_t kDefaultTeeth = 8;
+  constexpr static size_t kDefaultTables = 4;
+  // The number of points normalized with a single batched inversion.
+  constexpr static size_t kNormalizationChunkSize = size_t{1} << 12;
+
+  static_assert((kModulusBits + kMaxTeeth - 1) / kMaxTeeth <= kMaxSpan,
+                "The scalar field is too large to be combed");
+
+  // Returns the tables of the generator of |Point| with the default
+  // parameters, e.g., for [y]₁ = y * G of a KZG verifier. They are built on
+  // the first call and shared for the lifetime of the process.
+  static const CombFixedBaseMSM& GetGeneratorInstance() {
+    static const base::NoDestructor<CombFixedBaseMSM> msm([]() {
+      CombFixedBaseMSM msm;
+      msm.Reset(Point::Generator());
+      return msm;
+    }());
+    return *msm;
+  }
+
+  size_t teeth() const { return teeth_; }
+  size_t tables() const { return tables_; }
+  size_t span() const { return span_; }
+  size_t block_size() const { return block_size_; }
+
+  // Builds the tables of |base| with |teeth| rows and |tables| tables. The
+  // tables hold |tables| * 2^|teeth| points. |teeth| is raised if a row
+  // doesn't fit in a word.
+  void Reset(const Point& base, size_t teeth = kDefaultTeeth,
+             size_t tables = kDefaultTables) {
+    teeth = std::max(teeth, (kModulusBits + kMaxSpan - 1) / kMaxSpan);
+    CHECK_LE(teeth, kMaxTeeth);
+    CHECK_GT(tables, size_t{0});
+    teeth_ = teeth;
+    span_ = (kModulusBits + teeth - 1) / teeth;
+    tables_ = std::min(tables, span_);
+    block_size_ = (span_ + tables_ - 1) / tables_;
+    UpdateTables(base);
+  }
+
+  AddResult ScalarMul(const ScalarField& scalar) const {
+    using BigInt = typename ScalarField::BigIntTy;
+
+    BigInt scalar_bigint = scalar.ToBigInt();
+    std::array<uint64_t, kMaxTeeth> rows;
+    for (size_t k = 0; k < teeth_; ++k) {
+      size_t bit_offset = k * span_;
+      rows[k] = bit_offset < kModulusBits
+                    ? scalar_bigint.ExtractBits64(bit_offset, span_)
+                    : 0;
+    }
+
+    size_t table_size = size_t{1} << teeth_;
+    AddResult ret = AddResult::Zero();
+    for (size_t j = block_size_; j-- > 0;) {
+      ret.DoubleInPlace();
+      for (size_t u = 0; u < tables_; ++u) {
+        size_t column = u * block_size_ + j;
+        if (column >= span_) continue;
+        size_t index = 0;
+        for (size_t k = 0; k < teeth_; ++k) {
+          index |= static_cast<size_t>((rows[k] >> column) & 1) << k;
+        }
+        if (index != 0) ret += table_[u * table_size + index];
+      }
+    }
+    return ret;
+  }
+
+  // Populates |outputs| with the product of the base and each of |scalars|.
+  template <typename ScalarContainer, typename OutputContainer>
+  [[nodiscard]] bool Run(const ScalarContainer& scalars,
+                         OutputContainer* outputs) const {
+    if (std::size(scalars) != std::size(*outputs)) {
+      LOG(ERROR) << "the size of scalars and outputs don't match";
+      return false;
+    }
+    absl::Span<Point> outputs_span(std::data(*outputs), std::size(*outputs));
+    base::ParallelizeByChunkSize(
+        outputs_span, kNormalizationChunkSize,
+        [this, &scalars](absl::Span<Point> chunk, size_t chunk_idx,
+                         size_t chunk_size) {
+          size_t start = chunk_idx * chunk_size;
+          std::vector<AddResult> results(chunk.size());
+          for (size_t i = 0; i < chunk.size(); ++i) {
+            results[i] = ScalarMul(scalars[start + i]);
+          }
+          CHECK(AddResult::BatchNormalizeSerial(results, &chunk));
+        });
+    return true;
+  }
+
+ private:
+  void UpdateTables(const Point& point) {
+    // |row_bases[k]| = 2^(k * span) * G
+    std::vector<AddResult> row_bases(teeth_);
+    row_bases[0] = point.ToJacobian();
+    for (size_t k = 1; k < teeth_; ++k) {
+      row_bases[k] = row_bases[k - 1];
+      for (size_t i = 0; i < span_; ++i) {
+        row_bases[k].DoubleInPlace();
+      }
+    }
+
+    size_t table_size = size_t{1} << teeth_;
+    std::vector<AddResult> table(tables_ * table_size);
+    OPENMP_PARALLEL_FOR(size_t u = 0; u < tables_; ++u) {
+      // |tooth_bases[k]| = 2^(k * span + u * block_size) * G
+      std::vector<AddResult> tooth_bases = row_bases;
+      for (AddResult& tooth_base : tooth_bases) {
+        for (size_t i = 0; i < u * block_size_; ++i) {
+          tooth_base.DoubleInPlace();
+        }
+      }
+      AddResult* cur_table = &table[u * table_size];
+      cur_table[0] = AddResult::Zero();
+      for (size_t index = 1; index < table_size; ++index) {
+        // Adds the base of the highest set bit to the entry without it.
+        size_t k = base::bits::Log2Floor(index);
+        cur_table[index] =
+            cur_table[index ^ (size_t{1} << k)] + tooth_bases[k];
+      }
+    }
+
+    table_.resize(table.size());
+    CHECK(AddResult::BatchNormalize(table, &table_));
+  }
+
+  size_t teeth_ = 0;
+  size_t tables_ = 0;
+  size_t span_ = 0;
+  size_t block_size_ = 0;
+  // The u-th table is at [u * 2^|teeth_|, (u + 1) * 2^|teeth_|).
+  std::vector<Point> table_;
+};
+
+}  // namespace tachyon::math
+
+#endif  // TACHYON_MATH_ELLIPTIC_CURVES_MSM_COMB_FIXED_BASE_MSM_H_
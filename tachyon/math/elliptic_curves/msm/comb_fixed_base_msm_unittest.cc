@@ -0,0 +1,93 @@
+#include "tachyon/math/elliptic_curves/msm/comb_fixed_base_msm.h"
+
+#include "absl/strings/substitute.h"
+#include "gtest/gtest.h"
+
+#include "tachyon/math/elliptic_curves/bn/bn254/g1.h"
+#include "tachyon/math/elliptic_curves/msm/test/fixed_base_msm_test_set.h"
+
+namespace tachyon::math {
+
+namespace {
+
+const size_t kSize = 40;
+
+class CombFixedBaseMSMTest : public testing::Test {
+ public:
+  static void SetUpTestSuite() { bn254::G1Curve::Init(); }
+
+  CombFixedBaseMSMTest()
+      : test_set_(FixedBaseMSMTestSet<bn254::G1AffinePoint>::Random(
+            kSize, FixedBaseMSMMethod::kNaive)) {}
+  CombFixedBaseMSMTest(const CombFixedBaseMSMTest&) = delete;
+  CombFixedBaseMSMTest& operator=(const CombFixedBaseMSMTest&) = delete;
+  ~CombFixedBaseMSMTest() override = default;
+
+ protected:
+  FixedBaseMSMTestSet<bn254::G1AffinePoint> test_set_;
+};
+
+}  // namespace
+
+TEST_F(CombFixedBaseMSMTest, Run) {
+  struct {
+    size_t teeth;
+    size_t tables;
+  } tests[] = {
+      // clang-format off
+      {1, 1},
+      {4, 1},
+      {5, 3},
+      {8, 4},
+      {11, 7},
+      // clang-format on
+  };
+
+  std::vector<bn254::G1AffinePoint> expected(kSize);
+  ASSERT_TRUE(bn254::G1JacobianPoint::BatchNormalize(test_set_.answer,
+                                                     &expected));
+  for (const auto& test : tests) {
+    SCOPED_TRACE(absl::Substitute("teeth: $0, tables: $1", test.teeth,
+                                  test.tables));
+    CombFixedBaseMSM<bn254::G1AffinePoint> msm;
+    msm.Reset(test_set_.base, test.teeth, test.tables);
+    // A row of a 254-bit scalar doesn't fit in a word with less than 5 teeth.
+    EXPECT_GE(msm.teeth(), size_t{5});
+    EXPECT_LE(msm.span(), size_t{63});
+
+    std::vector<bn254::G1AffinePoint> ret(kSize);
+    ASSERT_TRUE(msm.Run(test_set_.scalars, &ret));
+    EXPECT_EQ(ret, expected);
+  }
+}
+
+TEST_F(CombFixedBaseMSMTest, ScalarMulEdgeCases) {
+  CombFixedBaseMSM<bn254::G1AffinePoint> msm;
+  msm.Reset(test_set_.base);
+
+  EXPECT_TRUE(msm.ScalarMul(bn254::Fr::Zero()).IsZero());
+  EXPECT_EQ(msm.ScalarMul(bn254::Fr::One()), test_set_.base.ToJacobian());
+  EXPECT_EQ(msm.ScalarMul(-bn254::Fr::One()), -test_set_.base.ToJacobian());
+
+  std::vector<bn254::Fr> scalars = {bn254::Fr::Zero()};
+  std::vector<bn254::G1AffinePoint> ret(1);
+  ASSERT_TRUE(msm.Run(scalars, &ret));
+  EXPECT_TRUE(ret[0].IsZero());
+
+  std::vector<bn254::G1AffinePoint> wrong_size(2);
+  EXPECT_FALSE(msm.Run(scalars, &wrong_size));
+}
+
+TEST_F(CombFixedBaseMSMTest, GetGeneratorInstance) {
+  const CombFixedBaseMSM<bn254::G1AffinePoint>& msm =
+      CombFixedBaseMSM<bn254::G1AffinePoint>::GetGeneratorInstance();
+  EXPECT_EQ(&msm,
+            &CombFixedBaseMSM<bn254::G1AffinePoint>::GetGeneratorInstance());
+  for (size_t i = 0; i < kSize; ++i) {
+    bn254::Fr scalar = bn254::Fr::Random();
+    EXPECT_EQ(msm.ScalarMul(scalar),
+              bn254::G1AffinePoint::Generator() * scalar);
+  }
+}
+
+}  // namespace tachyon::math
@@ -6,18 +6,31 @@
 #ifndef TACHYON_MATH_ELLIPTIC_CURVES_MSM_GLV_H_
 #define TACHYON_MATH_ELLIPTIC_CURVES_MSM_GLV_H_
 
-#include "tachyon/math/base/bit_iterator.h"
-#include "tachyon/math/base/gmp/bit_traits.h"
-#include "tachyon/math/base/gmp/signed_value.h"
+#include <stddef.h>
+
+#include <algorithm>
+#include <limits>
+#include <type_traits>
+
+#include "tachyon/math/base/big_int.h"
+#include "tachyon/math/base/sign.h"
 #include "tachyon/math/elliptic_curves/affine_point.h"
 #include "tachyon/math/elliptic_curves/jacobian_point.h"
 #include "tachyon/math/elliptic_curves/point_xyzz.h"
 #include "tachyon/math/elliptic_curves/projective_point.h"
 #include "tachyon/math/elliptic_curves/semigroups.h"
-#include "tachyon/math/matrix/gmp_num_traits.h"
 
 namespace tachyon::math {
 
+// True if the curve of |Point| is generated with GLV parameters.
+template <typename Point, typename SFINAE = void>
+inline constexpr bool kSupportsGLV = false;
+
+template <typename Point>
+inline constexpr bool kSupportsGLV<
+    Point, std::void_t<decltype(Point::Curve::Config::kGLVRoundingFactors)>> =
+    true;
+
 template <typename Point>
 class GLV {
  public:
@@ -25,52 +38,49 @@ class GLV {
   using ScalarField = typename Point::ScalarField;
   using RetPoint = typename internal::AdditiveSemigroupTraits<Point>::ReturnTy;
 
+  constexpr static size_t N = ScalarField::N;
+
   struct CoefficientDecompositionResult {
-    SignedValue<mpz_class> k1;
-    SignedValue<mpz_class> k2;
+    SignedValue<BigInt<N>> k1;
+    SignedValue<BigInt<N>> k2;
   };
 
   static Point Endomorphism(const Point& point) {
     return Point::Endomorphism(point);
   }
-  // Decomposes a scalar |k| into k1, k2, s.t. k = k1 + lambda k2,
+
+  // Decomposes a scalar |k| into k1, k2, s.t. k = k1 + lambda k2. Both |k1|
+  // and |k2| are about half the bit length of the scalar field.
+  //
+  // With the lattice basis (n₁₁, n₁₂), (n₂₁, n₂₂),
+  //
+  //   β₁ = ⌊k * n₂₂ / r⌉, β₂ = ⌊-k * n₁₂ / r⌉
+  //   k1 = k - (β₁ * n₁₁ + β₂ * n₂₁)
+  //   k2 = -(β₁ * n₁₂ + β₂ * n₂₂)
+  //
+  // The divisions by r are replaced with multiplications by precomputed
+  // rounding factors followed by a shift. The rest is computed modulo 2⁶⁴ᴺ.
+  // Since k1 and k2 are small, they are read back in two's complement.
+  // See GenerateGLVDecompositionConstants() in
+  // tachyon/math/elliptic_curves/short_weierstrass/generator/generator.cc.
   static CoefficientDecompositionResult Decompose(const ScalarField& k) {
+    return Decompose(k.ToBigInt());
+  }
+
+  // Same as above, but |scalar| is already out of montgomery form.
+  static CoefficientDecompositionResult Decompose(const BigInt<N>& scalar) {
     using Config = typename Point::Curve::Config;
 
-    Eigen::Matrix<mpz_class, 2, 2> coefficients(
-        {{Config::kGLVCoeffs[0], Config::kGLVCoeffs[1]},
-         {Config::kGLVCoeffs[2], Config::kGLVCoeffs[3]}});
-
-    decltype(auto) scalar = k.ToMpzClass();
-    const mpz_class& n12 = coefficients(0, 1);
-    const mpz_class& n22 = coefficients(1, 1);
-    mpz_class r;
-    gmp::WriteLimbs(ScalarField::Config::kModulus.limbs, ScalarField::kLimbNums,
-                    &r);
-
-    // clang-format off
-    // NOTE(chokobole): We can't calculate using below directly.
-    //
-    // Eigen::Matrix<mpz_class, 1, 2>(scalar, mpz_class(0)) * coefficients.inverse()
-    //
-    // Eigen matrix emits an error like below:
-    //
-    // external/eigen_archive/Eigen/src/LU/InverseImpl.h:352:3: error: static assertion failed: THIS_FUNCTION_IS_NOT_FOR_INTEGER_NUMERIC_TYPES
-    // 352 |   EIGEN_STATIC_ASSERT(!NumTraits<Scalar>::IsInteger,THIS_FUNCTION_IS_NOT_FOR_INTEGER_NUMERIC_TYPES)
-    // clang-format on
-    mpz_class beta_1 = scalar * n22 / r;
-    mpz_class beta_2 = scalar * (-n12) / r;
-
-    Eigen::Matrix<mpz_class, 1, 2> b =
-        Eigen::Matrix<mpz_class, 1, 2>{beta_1, beta_2} * coefficients;
-
-    // k1
-    mpz_class k1 = scalar - b[0];
-
-    // k2
-    mpz_class k2 = -b[1];
-
-    return {SignedValue<mpz_class>(k1), SignedValue<mpz_class>(k2)};
+    BigInt<N> beta1 = MulHigh(scalar, Config::kGLVRoundingFactors[0]);
+    BigInt<N> beta2 = MulHigh(scalar, Config::kGLVRoundingFactors[1]);
+
+    BigInt<N> k1 = scalar - (beta1 * Config::kGLVDecompositionCoeffs[0] +
+                             beta2 * Config::kGLVDecompositionCoeffs[2]);
+    BigInt<N> k2 =
+        BigInt<N>::Zero() - (beta1 * Config::kGLVDecompositionCoeffs[1] +
+                             beta2 * Config::kGLVDecompositionCoeffs[3]);
+    return {SignedValue<BigInt<N>>::FromTwosComplement(k1),
+            SignedValue<BigInt<N>>::FromTwosComplement(k2)};
   }
 
   static RetPoint Mul(const Point& p, const ScalarField& k) {
@@ -88,39 +98,39 @@ class GLV {
 
     RetPoint b1b2 = b1 + b2;
 
-    auto k1_begin = BitIteratorBE<mpz_class>::begin(&result.k1.abs_value);
-    auto k1_end = BitIteratorBE<mpz_class>::end(&result.k1.abs_value);
-    auto k2_begin = BitIteratorBE<mpz_class>::begin(&result.k2.abs_value);
+    const BigInt<N>& k1 = result.k1.abs_value;
+    const BigInt<N>& k2 = result.k2.abs_value;
+    size_t bit_length = std::max(k1.GetBitLength(), k2.GetBitLength());
 
     RetPoint ret = RetPoint::Zero();
-    bool skip_zeros = true;
-    auto k1_it = k1_begin;
-    auto k2_it = k2_begin;
-    while (k1_it != k1_end) {
-      if (skip_zeros && !(*k1_it) && !(*k2_it)) {
-        skip_zeros = false;
-        ++k1_it;
-        ++k2_it;
-        continue;
-      }
-      skip_zeros = false;
+    for (size_t i = bit_length - 1; i != std::numeric_limits<size_t>::max();
+         --i) {
       ret.DoubleInPlace();
-      if ((*k1_it)) {
-        if (*(k2_it)) {
+      bool k1_bit = BitTraits<BigInt<N>>::TestBit(k1, i);
+      bool k2_bit = BitTraits<BigInt<N>>::TestBit(k2, i);
+      if (k1_bit) {
+        if (k2_bit) {
           ret += b1b2;
         } else {
           ret += b1;
         }
       } else {
-        if (*(k2_it)) {
+        if (k2_bit) {
           ret += b2;
         }
       }
-      ++k1_it;
-      ++k2_it;
     }
     return ret;
   }
+
+ private:
+  // Returns ⌊|a| * |b| / 2⁶⁴ᴺ⌋.
+  static BigInt<N> MulHigh(const BigInt<N>& a, const BigInt<N>& b) {
+    BigInt<N> lo = a;
+    BigInt<N> hi;
+    lo.MulInPlace(b, hi);
+    return hi;
+  }
 };
 
 }  // namespace tachyon::math
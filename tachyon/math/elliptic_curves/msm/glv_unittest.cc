@@ -7,6 +7,7 @@
 #include "tachyon/math/elliptic_curves/bn/bn254/g1.h"
 #include "tachyon/math/elliptic_curves/bn/bn254/g2.h"
 #include "tachyon/math/elliptic_curves/point_conversions.h"
+#include "tachyon/math/elliptic_curves/secp/secp256k1/curve.h"
 
 namespace tachyon::math {
 
@@ -26,7 +27,7 @@ using PointTypes =
     testing::Types<bls12_381::G1AffinePoint, bls12_381::G1ProjectivePoint,
                    bls12_381::G1JacobianPoint, bls12_381::G1PointXYZZ,
                    bls12_381::G2JacobianPoint, bn254::G1JacobianPoint,
-                   bn254::G2JacobianPoint>;
+                   bn254::G2JacobianPoint, secp256k1::JacobianPoint>;
 TYPED_TEST_SUITE(GLVTest, PointTypes);
 
 TYPED_TEST(GLVTest, Endomorphism) {
@@ -43,17 +44,28 @@ TYPED_TEST(GLVTest, Decompose) {
   using Point = TypeParam;
   using ScalarField = typename Point::ScalarField;
 
-  ScalarField scalar = ScalarField::Random();
-  auto result = GLV<Point>::Decompose(scalar);
-  ScalarField k1 = ScalarField::FromMpzClass(result.k1.abs_value);
-  ScalarField k2 = ScalarField::FromMpzClass(result.k2.abs_value);
-  if (result.k1.sign == Sign::kNegative) {
-    k1.NegInPlace();
-  }
-  if (result.k2.sign == Sign::kNegative) {
-    k2.NegInPlace();
+  for (size_t i = 0; i < 100; ++i) {
+    ScalarField scalar = ScalarField::Random();
+    auto result = GLV<Point>::Decompose(scalar);
+    ScalarField k1 = ScalarField::FromBigInt(result.k1.abs_value);
+    ScalarField k2 = ScalarField::FromBigInt(result.k2.abs_value);
+    if (result.k1.sign == Sign::kNegative) {
+      k1.NegInPlace();
+    }
+    if (result.k2.sign == Sign::kNegative) {
+      k2.NegInPlace();
+    }
+    EXPECT_EQ(scalar, k1 + Point::Curve::Config::kLambda * k2);
+
+    // Both halves should be about half the length of the scalar field.
+    size_t half_bits = (ScalarField::Config::kModulusBits + 1) / 2;
+    EXPECT_LE(result.k1.abs_value.GetBitLength(), half_bits + 2);
+    EXPECT_LE(result.k2.abs_value.GetBitLength(), half_bits + 2);
   }
-  EXPECT_EQ(scalar, k1 + Point::Curve::Config::kLambda * k2);
+
+  auto result = GLV<Point>::Decompose(ScalarField::Zero());
+  EXPECT_EQ(result.k1.sign, Sign::kZero);
+  EXPECT_EQ(result.k2.sign, Sign::kZero);
 }
 
 TYPED_TEST(GLVTest, Mul) {
@@ -0,0 +1,116 @@
+#ifndef TACHYON_MATH_ELLIPTIC_CURVES_MSM_MEMORY_MAPPED_BASES_H_
+#define TACHYON_MATH_ELLIPTIC_CURVES_MSM_MEMORY_MAPPED_BASES_H_
+
+#include <stddef.h>
+
+#include <algorithm>
+#include <atomic>
+#include <vector>
+
+#include "tachyon/base/buffer/copyable.h"
+#include "tachyon/base/buffer/read_only_buffer.h"
+#include "tachyon/base/files/memory_mapped_file.h"
+#include "tachyon/base/logging.h"
+#include "tachyon/base/openmp_util.h"
+
+namespace tachyon::math {
+
+// MemoryMappedBases is a view of the bases of an MSM that are serialized in a
+// memory-mapped file, e.g., the SRS of KZG written with Copyable<KZG>. The
+// bases are decoded in chunks with Read(), so that the whole of them never
+// needs to be held in memory. Each point should be serialized with the same
+// number of bytes, which holds for affine points.
+//
+// It is meant to be passed to PippengerAdapter::RunStreaming().
+template <typename Point>
+class MemoryMappedBases {
+ public:
+  MemoryMappedBases() = default;
+  // |file| should outlive this. The |size| points start at |offset| of |file|.
+  MemoryMappedBases(const base::MemoryMappedFile* file, size_t offset,
+                    size_t size)
+      : file_(file), offset_(offset), size_(size) {}
+
+  // Returns the number of bytes a point takes in the file.
+  static size_t GetPointSize() { return base::EstimateSize(Point()); }
+
+  // Points |bases| to a std::vector<Point> written with Copyable at |offset|
+  // of |file|. If |end_offset| is given, it is populated with the offset right
+  // after the vector. Returns false if |file| is too short to hold the vector.
+  [[nodiscard]] static bool FromVector(const base::MemoryMappedFile* file,
+                                       size_t offset, MemoryMappedBases* bases,
+                                       size_t* end_offset = nullptr) {
+    base::ReadOnlyBuffer buffer(file->data(), file->length());
+    buffer.set_buffer_offset(offset);
+    size_t size;
+    if (!buffer.Read(&size)) {
+      LOG(ERROR) << "Failed to read the number of bases";
+      return false;
+    }
+    size_t start = buffer.buffer_offset();
+    size_t point_size = GetPointSize();
+    if (size > (file->length() - start) / point_size) {
+      LOG(ERROR) << "The file is too short to hold " << size << " bases";
+      return false;
+    }
+    *bases = MemoryMappedBases(file, start, size);
+    if (end_offset) *end_offset = start + size * point_size;
+    return true;
+  }
+
+  size_t size() const { return size_; }
+
+  // Decodes the points in [|start|, |start| + |count|) into |points|.
+  [[nodiscard]] bool Read(size_t start, size_t count,
+                          std::vector<Point>* points) const {
+    if (start > size_ || count > size_ - start) {
+      LOG(ERROR) << "Out of range: [" << start << ", " << start + count
+                 << ") of " << size_ << " bases";
+      return false;
+    }
+    points->resize(count);
+    size_t point_size = GetPointSize();
+    const uint8_t* data = file_->data() + offset_ + start * point_size;
+    std::atomic<bool> all_good = true;
+    OPENMP_PARALLEL_FOR(size_t i = 0; i < count; ++i) {
+      base::ReadOnlyBuffer buffer(data + i * point_size, point_size);
+      if (!buffer.Read(&(*points)[i])) {
+        all_good.store(false, std::memory_order_relaxed);
+      }
+    }
+    if (!all_good.load(std::memory_order_relaxed)) {
+      LOG(ERROR) << "Failed to read bases";
+      return false;
+    }
+    return true;
+  }
+
+  // Asks the OS to read the points in [|start|, |start| + |count|) ahead, so
+  // that a following Read() doesn't wait for the disk.
+  void Prefetch(size_t start, size_t count) const {
+    Advise(start, count, base::MemoryMappedFile::Advice::kWillNeed);
+  }
+
+  // Tells the OS that the points in [|start|, |start| + |count|) are no longer
+  // needed, so that their pages don't stay in memory.
+  void Release(size_t start, size_t count) const {
+    Advise(start, count, base::MemoryMappedFile::Advice::kDontNeed);
+  }
+
+ private:
+  void Advise(size_t start, size_t count,
+              base::MemoryMappedFile::Advice advice) const {
+    size_t point_size = GetPointSize();
+    // NOTE: This is only a hint, so the result is ignored.
+    file_->Advise(offset_ + start * point_size, count * point_size, advice);
+  }
+
+  // not owned
+  const base::MemoryMappedFile* file_ = nullptr;
+  size_t offset_ = 0;
+  size_t size_ = 0;
+};
+
+}  // namespace tachyon::math
+
+#endif  // TACHYON_MATH_ELLIPTIC_CURVES_MSM_MEMORY_MAPPED_BASES_H_
@@ -42,7 +42,12 @@ struct TACHYON_EXPORT MSMCtx {
 
   template <typename ScalarField>
   constexpr static unsigned int ComputeWindowsCount(unsigned int window_bits) {
-    return (ScalarField::Config::kModulusBits + window_bits - 1) / window_bits;
+    return ComputeWindowsCount(window_bits, ScalarField::Config::kModulusBits);
+  }
+
+  constexpr static unsigned int ComputeWindowsCount(unsigned int window_bits,
+                                                    size_t scalar_bits) {
+    return (scalar_bits + window_bits - 1) / window_bits;
   }
 };
 
@@ -0,0 +1,98 @@
+#include "tachyon/math/elliptic_curves/msm/msm_profile.h"
+
+#include <algorithm>
+
+#include "tachyon/base/bits.h"
+#include "tachyon/base/environment.h"
+#include "tachyon/base/files/file_util.h"
+#include "tachyon/base/json/json.h"
+#include "tachyon/base/logging.h"
+#include "tachyon/base/no_destructor.h"
+
+namespace tachyon::math {
+
+namespace {
+
+uint32_t Distance(uint32_t a, uint32_t b) { return a < b ? b - a : a - b; }
+
+}  // namespace
+
+// static
+const MSMProfile& MSMProfile::Get() {
+  static const base::NoDestructor<MSMProfile> profile([]() {
+    MSMProfile profile;
+    std::string_view path;
+    if (base::Environment::Get(kPathEnvName, &path) && !path.empty()) {
+      if (!profile.Load(base::FilePath(path))) {
+        LOG(ERROR) << "Ignoring the msm profile: " << path;
+        profile = MSMProfile();
+      }
+    }
+    return profile;
+  }());
+  return *profile;
+}
+
+void MSMProfile::AddEntry(MSMProfileEntry entry) {
+  auto it = std::find_if(entries_.begin(), entries_.end(),
+                         [&entry](const MSMProfileEntry& other) {
+                           return other.curve == entry.curve &&
+                                  other.log_size == entry.log_size &&
+                                  other.thread_count == entry.thread_count;
+                         });
+  if (it == entries_.end()) {
+    entries_.push_back(std::move(entry));
+  } else {
+    *it = std::move(entry);
+  }
+}
+
+const MSMProfileEntry* MSMProfile::Find(std::string_view curve, size_t size,
+                                        uint32_t thread_count) const {
+  uint32_t log_size = base::bits::SafeLog2Ceiling(size);
+  const MSMProfileEntry* ret = nullptr;
+  for (const MSMProfileEntry& entry : entries_) {
+    if (entry.curve != curve) continue;
+    if (Distance(entry.log_size, log_size) > kMaxLogSizeDistance) continue;
+    if (ret == nullptr) {
+      ret = &entry;
+      continue;
+    }
+    uint32_t thread_distance = Distance(entry.thread_count, thread_count);
+    uint32_t ret_thread_distance = Distance(ret->thread_count, thread_count);
+    if (thread_distance < ret_thread_distance ||
+        (thread_distance == ret_thread_distance &&
+         Distance(entry.log_size, log_size) <
+             Distance(ret->log_size, log_size))) {
+      ret = &entry;
+    }
+  }
+  return ret;
+}
+
+bool MSMProfile::Load(const base::FilePath& path) {
+  MSMProfile profile;
+  std::string error;
+  if (!base::LoadAndParseJson(path, &profile, &error)) {
+    LOG(ERROR) << error;
+    return false;
+  }
+  for (const MSMProfileEntry& entry : profile.entries_) {
+    if (entry.window_bits == 0 || entry.window_bits > 30) {
+      LOG(ERROR) << "Invalid window bits: " << entry.window_bits;
+      return false;
+    }
+  }
+  *this = std::move(profile);
+  return true;
+}
+
+bool MSMProfile::Save(const base::FilePath& path) const {
+  if (!base::WriteFile(path, base::WriteToJson(*this))) {
+    LOG(ERROR) << "Failed to write the msm profile: " << path.value();
+    return false;
+  }
+  return true;
+}
+
+}  // namespace tachyon::math
@@ -0,0 +1,166 @@
+#ifndef TACHYON_MATH_ELLIPTIC_CURVES_MSM_MSM_PROFILE_H_
+#define TACHYON_MATH_ELLIPTIC_CURVES_MSM_MSM_PROFILE_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "absl/strings/str_cat.h"
+
+#include "tachyon/base/files/file_path.h"
+#include "tachyon/base/json/rapidjson_util.h"
+#include "tachyon/export.h"
+#include "tachyon/math/elliptic_curves/msm/algorithms/pippenger/pippenger_parallel_strategy.h"
+
+namespace tachyon {
+namespace math {
+
+// The window bits and the parallel strategy that ran an MSM of |2^log_size|
+// points of |curve| the fastest with |thread_count| threads.
+struct TACHYON_EXPORT MSMProfileEntry {
+  std::string curve;
+  uint32_t log_size = 0;
+  uint32_t thread_count = 0;
+  uint32_t window_bits = 0;
+  PippengerParallelStrategy strategy = PippengerParallelStrategy::kParallelTerm;
+
+  bool operator==(const MSMProfileEntry& other) const {
+    return curve == other.curve && log_size == other.log_size &&
+           thread_count == other.thread_count &&
+           window_bits == other.window_bits && strategy == other.strategy;
+  }
+  bool operator!=(const MSMProfileEntry& other) const {
+    return !operator==(other);
+  }
+};
+
+// MSMProfile is a table of the fastest MSM configurations measured on the
+// target machine by //benchmark/msm:msm_autotuner. VariableBaseMSM looks up
+// the profile of the path in |kPathEnvName| and falls back to the default
+// heuristics when there is no matching entry.
+class TACHYON_EXPORT MSMProfile {
+ public:
+  constexpr static std::string_view kPathEnvName = "TACHYON_MSM_PROFILE";
+
+  // An entry is only used for sizes within this distance in log₂ from the
+  // size it was measured with.
+  constexpr static uint32_t kMaxLogSizeDistance = 1;
+
+  MSMProfile() = default;
+  explicit MSMProfile(std::vector<MSMProfileEntry> entries)
+      : entries_(std::move(entries)) {}
+
+  // Returns the profile loaded from the path in |kPathEnvName| at the first
+  // call. It is empty if the variable is unset or the profile fails to load.
+  static const MSMProfile& Get();
+
+  // Returns the name that identifies the curve of |Point| in the profile.
+  // e.g, "tachyon::math::bn254::Fq" for bn254 G1 and
+  // "tachyon::math::bn254::Fq^2" for bn254 G2.
+  template <typename Point>
+  static std::string GetCurveName() {
+    using BaseField = typename Point::BaseField;
+    if constexpr (BaseField::ExtensionDegree() == 1) {
+      return BaseField::Config::kName;
+    } else {
+      using BasePrimeField = typename BaseField::Config::BasePrimeField;
+      return absl::StrCat(BasePrimeField::Config::kName, "^",
+                          BaseField::ExtensionDegree());
+    }
+  }
+
+  const std::vector<MSMProfileEntry>& entries() const { return entries_; }
+
+  bool empty() const { return entries_.empty(); }
+
+  // Adds |entry| or replaces the entry with the same curve, size and thread
+  // count.
+  void AddEntry(MSMProfileEntry entry);
+
+  // Returns the entry of |curve| measured with the thread count closest to
+  // |thread_count|, and among them the one with the size closest to |size|.
+  // Returns nullptr if there is no such entry within |kMaxLogSizeDistance|.
+  const MSMProfileEntry* Find(std::string_view curve, size_t size,
+                              uint32_t thread_count) const;
+
+  [[nodiscard]] bool Load(const base::FilePath& path);
+  [[nodiscard]] bool Save(const base::FilePath& path) const;
+
+ private:
+  std::vector<MSMProfileEntry> entries_;
+};
+
+}  // namespace math
+
+namespace base {
+
+template <>
+class RapidJsonValueConverter<math::MSMProfileEntry> {
+ public:
+  template <typename Allocator>
+  static rapidjson::Value From(const math::MSMProfileEntry& value,
+                               Allocator& allocator) {
+    rapidjson::Value object(rapidjson::kObjectType);
+    AddJsonElement(object, "curve", value.curve, allocator);
+    AddJsonElement(object, "log_size", value.log_size, allocator);
+    AddJsonElement(object, "thread_count", value.thread_count, allocator);
+    AddJsonElement(object, "window_bits", value.window_bits, allocator);
+    AddJsonElement(object, "strategy",
+                   math::PippengerParallelStrategyToString(value.strategy),
+                   allocator);
+    return object;
+  }
+
+  static bool To(const rapidjson::Value& json_value, std::string_view key,
+                 math::MSMProfileEntry* value, std::string* error) {
+    math::MSMProfileEntry entry;
+    std::string strategy;
+    if (!ParseJsonElement(json_value, "curve", &entry.curve, error))
+      return false;
+    if (!ParseJsonElement(json_value, "log_size", &entry.log_size, error))
+      return false;
+    if (!ParseJsonElement(json_value, "thread_count", &entry.thread_count,
+                          error))
+      return false;
+    if (!ParseJsonElement(json_value, "window_bits", &entry.window_bits,
+                          error))
+      return false;
+    if (!ParseJsonElement(json_value, "strategy", &strategy, error))
+      return false;
+    if (!math::ParsePippengerParallelStrategy(strategy, &entry.strategy,
+                                              error))
+      return false;
+    *value = std::move(entry);
+    return true;
+  }
+};
+
+template <>
+class RapidJsonValueConverter<math::MSMProfile> {
+ public:
+  template <typename Allocator>
+  static rapidjson::Value From(const math::MSMProfile& value,
+                               Allocator& allocator) {
+    rapidjson::Value object(rapidjson::kObjectType);
+    AddJsonElement(object, "entries", value.entries(), allocator);
+    return object;
+  }
+
+  static bool To(const rapidjson::Value& json_value, std::string_view key,
+                 math::MSMProfile* value, std::string* error) {
+    std::vector<math::MSMProfileEntry> entries;
+    if (!ParseJsonElement(json_value, "entries", &entries, error))
+      return false;
+    *value = math::MSMProfile(std::move(entries));
+    return true;
+  }
+};
+
+}  // namespace base
+}  // namespace tachyon
+
+#endif  // TACHYON_MATH_ELLIPTIC_CURVES_MSM_MSM_PROFILE_H_
@@ -0,0 +1,92 @@
+#include "tachyon/math/elliptic_curves/msm/msm_profile.h"
+
+#include "gtest/gtest.h"
+
+#include "tachyon/base/files/file_util.h"
+#include "tachyon/base/files/scoped_temp_dir.h"
+#include "tachyon/math/elliptic_curves/bn/bn254/g1.h"
+#include "tachyon/math/elliptic_curves/bn/bn254/g2.h"
+
+namespace tachyon::math {
+
+namespace {
+
+constexpr char kCurve[] = "tachyon::math::bn254::Fq";
+
+MSMProfileEntry CreateEntry(uint32_t log_size, uint32_t thread_count,
+                            uint32_t window_bits,
+                            PippengerParallelStrategy strategy =
+                                PippengerParallelStrategy::kParallelTerm) {
+  return {kCurve, log_size, thread_count, window_bits, strategy};
+}
+
+}  // namespace
+
+TEST(MSMProfileTest, GetCurveName) {
+  EXPECT_EQ(MSMProfile::GetCurveName<bn254::G1AffinePoint>(), kCurve);
+  EXPECT_EQ(MSMProfile::GetCurveName<bn254::G2AffinePoint>(),
+            "tachyon::math::bn254::Fq^2");
+}
+
+TEST(MSMProfileTest, AddEntry) {
+  MSMProfile profile;
+  profile.AddEntry(CreateEntry(16, 8, 12));
+  profile.AddEntry(CreateEntry(17, 8, 13));
+  profile.AddEntry(CreateEntry(16, 8, 14));
+  EXPECT_EQ(profile.entries(),
+            (std::vector<MSMProfileEntry>{CreateEntry(16, 8, 14),
+                                          CreateEntry(17, 8, 13)}));
+}
+
+TEST(MSMProfileTest, Find) {
+  MSMProfile profile;
+  profile.AddEntry(CreateEntry(16, 8, 12));
+  profile.AddEntry(CreateEntry(18, 8, 14));
+  profile.AddEntry(CreateEntry(16, 64, 11));
+
+  EXPECT_EQ(*profile.Find(kCurve, 1 << 16, 8), CreateEntry(16, 8, 12));
+  EXPECT_EQ(*profile.Find(kCurve, 1 << 18, 8), CreateEntry(18, 8, 14));
+  // The size is rounded up to the next power of 2.
+  EXPECT_EQ(*profile.Find(kCurve, (1 << 17) + 1, 8), CreateEntry(18, 8, 14));
+  EXPECT_EQ(*profile.Find(kCurve, 1 << 15, 8), CreateEntry(16, 8, 12));
+  // The closest thread count is preferred to the closest size.
+  EXPECT_EQ(*profile.Find(kCurve, 1 << 17, 48), CreateEntry(16, 64, 11));
+  EXPECT_EQ(*profile.Find(kCurve, 1 << 18, 4), CreateEntry(18, 8, 14));
+  // Too far from the measured sizes.
+  EXPECT_EQ(profile.Find(kCurve, 1 << 14, 8), nullptr);
+  EXPECT_EQ(profile.Find(kCurve, 1 << 20, 8), nullptr);
+  // Unknown curve.
+  EXPECT_EQ(profile.Find("tachyon::math::bn254::Fq^2", 1 << 16, 8), nullptr);
+}
+
+TEST(MSMProfileTest, SaveAndLoad) {
+  base::ScopedTempDir temp_dir;
+  ASSERT_TRUE(temp_dir.CreateUniqueTempDir());
+  base::FilePath path = temp_dir.GetPath().Append("msm_profile.json");
+
+  MSMProfile profile;
+  profile.AddEntry(
+      CreateEntry(16, 8, 12, PippengerParallelStrategy::kParallelBucket));
+  profile.AddEntry(
+      CreateEntry(20, 64, 15, PippengerParallelStrategy::kParallelWindow));
+  ASSERT_TRUE(profile.Save(path));
+
+  MSMProfile loaded;
+  ASSERT_TRUE(loaded.Load(path));
+  EXPECT_EQ(loaded.entries(), profile.entries());
+
+  ASSERT_TRUE(base::WriteFile(
+      path, std::string_view(R"({"entries": [{"curve": "a", "log_size": 16, )"
+                             R"("thread_count": 8, "window_bits": 31, )"
+                             R"("strategy": "parallel_term"}]})")));
+  EXPECT_FALSE(loaded.Load(path));
+  EXPECT_EQ(loaded.entries(), profile.entries());
+
+  ASSERT_TRUE(base::WriteFile(
+      path, std::string_view(R"({"entries": [{"curve": "a", "log_size": 16, )"
+                             R"("thread_count": 8, "window_bits": 12, )"
+                             R"("strategy": "unknown"}]})")));
+  EXPECT_FALSE(loaded.Load(path));
+}
+
+}  // namespace tachyon::math
@@ -6,6 +6,7 @@
 #include "tachyon/base/containers/container_util.h"
 #include "tachyon/base/files/file_util.h"
 #include "tachyon/base/logging.h"
+#include "tachyon/base/random.h"
 #include "tachyon/math/base/semigroups.h"
 #include "tachyon/math/elliptic_curves/msm/variable_base_msm.h"
 #include "tachyon/math/elliptic_curves/point_conversions.h"
@@ -52,6 +53,32 @@ struct VariableBaseMSMTestSet {
     return test_set;
   }
 
+  // Returns a test set whose scalars are drawn evenly from 0, ±1, ±(64-bit
+  // integers) and random elements, which resembles witness columns.
+  static VariableBaseMSMTestSet Sparse(size_t size,
+                                       VariableBaseMSMMethod method) {
+    VariableBaseMSMTestSet test_set;
+    test_set.bases = CreatePseudoRandomPoints<Point>(size);
+    test_set.scalars = base::CreateVector(size, []() {
+      switch (base::Uniform(base::Range<int>(0, 6))) {
+        case 0:
+          return ScalarField::Zero();
+        case 1:
+          return ScalarField::One();
+        case 2:
+          return -ScalarField::One();
+        case 3:
+          return ScalarField(base::Uniform(base::Range<uint64_t>::All()));
+        case 4:
+          return -ScalarField(base::Uniform(base::Range<uint64_t>::All()));
+        default:
+          return ScalarField::Random();
+      }
+    });
+    test_set.ComputeAnswer(method);
+    return test_set;
+  }
+
   static VariableBaseMSMTestSet Easy(size_t size,
                                      VariableBaseMSMMethod method) {
     VariableBaseMSMTestSet test_set;
@@ -1,9 +1,21 @@
 #ifndef TACHYON_MATH_ELLIPTIC_CURVES_MSM_VARIABLE_BASE_MSM_H_
 #define TACHYON_MATH_ELLIPTIC_CURVES_MSM_VARIABLE_BASE_MSM_H_
 
+#include <stddef.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <iterator>
+#include <string>
 #include <utility>
+#include <vector>
+
+#include "absl/types/span.h"
 
+#include "tachyon/base/no_destructor.h"
+#include "tachyon/base/openmp_util.h"
 #include "tachyon/math/elliptic_curves/msm/algorithms/pippenger/pippenger_adapter.h"
+#include "tachyon/math/elliptic_curves/msm/msm_profile.h"
 
 namespace tachyon::math {
 
@@ -11,19 +23,31 @@ namespace tachyon::math {
 // Variable-base MSM is an operation that multiplies different base points
 // with respective scalars, unlike the Fixed-base MSM, which uses the same
 // base point for all multiplications.
-// This implementation uses Pippenger's algorithm to compute the MSM.
+// This implementation uses Pippenger's algorithm to compute the MSM. The
+// window bits and the parallel strategy are taken from MSMProfile::Get() if it
+// has an entry for the curve and the size. See msm_profile.h.
 template <typename Point>
 class VariableBaseMSM {
  public:
   using ScalarField = typename Point::ScalarField;
   using Bucket = typename Pippenger<Point>::Bucket;
 
+  // The default number of bases held in memory at once by RunStreaming().
+  constexpr static size_t kDefaultChunkSize = size_t{1} << 20;
+
   template <typename BaseInputIterator, typename ScalarInputIterator>
   [[nodiscard]] bool Run(BaseInputIterator bases_first,
                          BaseInputIterator bases_last,
                          ScalarInputIterator scalars_first,
                          ScalarInputIterator scalars_last, Bucket* ret) {
     PippengerAdapter<Point> pippenger;
+    PippengerParallelStrategy strategy;
+    if (ConfigureFromProfile(std::distance(scalars_first, scalars_last),
+                             &pippenger, &strategy)) {
+      return pippenger.RunWithStrategy(
+          std::move(bases_first), std::move(bases_last),
+          std::move(scalars_first), std::move(scalars_last), strategy, ret);
+    }
     return pippenger.Run(std::move(bases_first), std::move(bases_last),
                          std::move(scalars_first), std::move(scalars_last),
                          ret);
@@ -35,6 +59,77 @@ class VariableBaseMSM {
     return Run(std::begin(bases), std::end(bases), std::begin(scalars),
                std::end(scalars), ret);
   }
+
+  // Runs an MSM whose bases are streamed from |bases| in chunks of
+  // |chunk_size| points, e.g., MemoryMappedBases over a params file that is
+  // too large to be loaded in memory. See PippengerAdapter::RunStreaming() for
+  // details.
+  template <typename BaseSource, typename ScalarContainer>
+  [[nodiscard]] bool RunStreaming(const BaseSource& bases,
+                                  const ScalarContainer& scalars, Bucket* ret,
+                                  size_t chunk_size = kDefaultChunkSize) {
+    PippengerAdapter<Point> pippenger;
+    PippengerParallelStrategy strategy;
+    if (!ConfigureFromProfile(std::min(chunk_size, std::size(scalars)),
+                              &pippenger, &strategy)) {
+      strategy = PippengerParallelStrategy::kParallelTerm;
+    }
+    return pippenger.RunStreaming(bases, std::begin(scalars),
+                                  std::end(scalars), chunk_size, strategy,
+                                  ret);
+  }
+
+  // Runs an MSM of each of |scalars_list| over the same |bases| and populates
+  // |rets| with the results. This is faster than calling Run() repeatedly,
+  // since each base is loaded once per window for many scalar vectors. See
+  // Pippenger::RunBatch() for details.
+  template <typename BaseContainer>
+  [[nodiscard]] bool RunBatch(
+      const BaseContainer& bases,
+      absl::Span<const absl::Span<const ScalarField>> scalars_list,
+      std::vector<Bucket>* rets) {
+    Pippenger<Point> pippenger;
+    size_t size = 0;
+    for (absl::Span<const ScalarField> scalars : scalars_list) {
+      size = std::max(size, scalars.size());
+    }
+    // Only the window bits of the profile are applied, since RunBatch() splits
+    // the threads across the groups and the windows by itself.
+    if (const MSMProfileEntry* entry = FindProfileEntry(size)) {
+      pippenger.SetWindowBits(entry->window_bits);
+    }
+    return pippenger.RunBatch(std::begin(bases), std::end(bases), scalars_list,
+                              rets);
+  }
+
+ private:
+  // Returns the entry of MSMProfile::Get() for an MSM of |size| or nullptr if
+  // the profile has no entry for it.
+  static const MSMProfileEntry* FindProfileEntry(size_t size) {
+    const MSMProfile& profile = MSMProfile::Get();
+    if (profile.empty()) return nullptr;
+    static const base::NoDestructor<std::string> curve(
+        MSMProfile::GetCurveName<Point>());
+#if defined(TACHYON_HAS_OPENMP)
+    uint32_t thread_count = static_cast<uint32_t>(omp_get_max_threads());
+#else
+    uint32_t thread_count = 1;
+#endif  // defined(TACHYON_HAS_OPENMP)
+    return profile.Find(*curve, size, thread_count);
+  }
+
+  // Sets the window bits of |pippenger| and populates |strategy| from
+  // MSMProfile::Get() for an MSM of |size|. Returns false if the profile has
+  // no entry for it.
+  static bool ConfigureFromProfile(size_t size,
+                                   PippengerAdapter<Point>* pippenger,
+                                   PippengerParallelStrategy* strategy) {
+    const MSMProfileEntry* entry = FindProfileEntry(size);
+    if (!entry) return false;
+    pippenger->SetWindowBits(entry->window_bits);
+    *strategy = entry->strategy;
+    return true;
+  }
 };
 
 }  // namespace tachyon::math
@@ -1,6 +1,11 @@
 #include "gtest/gtest.h"
 
+#include "tachyon/base/buffer/vector_buffer.h"
+#include "tachyon/base/files/file_util.h"
+#include "tachyon/base/files/memory_mapped_file.h"
+#include "tachyon/base/files/scoped_temp_dir.h"
 #include "tachyon/math/elliptic_curves/bn/bn254/g1.h"
+#include "tachyon/math/elliptic_curves/msm/memory_mapped_bases.h"
 #include "tachyon/math/elliptic_curves/msm/test/variable_base_msm_test_set.h"
 
 namespace tachyon::math {
@@ -44,4 +49,81 @@ TYPED_TEST(VariableBaseMSMTest, DoMSM) {
   EXPECT_EQ(ret, test_set.answer);
 }
 
+TYPED_TEST(VariableBaseMSMTest, RunBatch) {
+  using Point = TypeParam;
+  using Bucket = typename VariableBaseMSM<Point>::Bucket;
+  using ScalarField = typename Point::ScalarField;
+
+  const VariableBaseMSMTestSet<Point>& test_set = this->test_set_;
+
+  // Scalar vectors of different lengths, including an empty one.
+  std::vector<std::vector<ScalarField>> scalars_list;
+  for (size_t size : {kSize, kSize / 2, size_t{0}, kSize, size_t{1}}) {
+    scalars_list.push_back(base::CreateVector(
+        size, []() { return ScalarField::Random(); }));
+  }
+  scalars_list[0] = test_set.scalars;
+  std::vector<absl::Span<const ScalarField>> scalar_spans =
+      base::Map(scalars_list, [](const std::vector<ScalarField>& scalars) {
+        return absl::MakeConstSpan(scalars);
+      });
+
+  VariableBaseMSM<Point> msm;
+  std::vector<Bucket> rets;
+  ASSERT_TRUE(msm.RunBatch(test_set.bases, scalar_spans, &rets));
+  ASSERT_EQ(rets.size(), scalars_list.size());
+  EXPECT_EQ(rets[0], test_set.answer);
+  for (size_t i = 0; i < scalars_list.size(); ++i) {
+    const std::vector<ScalarField>& scalars = scalars_list[i];
+    Bucket expected;
+    ASSERT_TRUE(msm.Run(absl::MakeConstSpan(test_set.bases.data(),
+                                            scalars.size()),
+                        scalars, &expected));
+    EXPECT_EQ(rets[i], expected);
+  }
+
+  // Too many scalars.
+  std::vector<ScalarField> too_many_scalars(kSize + 1);
+  scalar_spans.push_back(absl::MakeConstSpan(too_many_scalars));
+  EXPECT_FALSE(msm.RunBatch(test_set.bases, scalar_spans, &rets));
+}
+
+TYPED_TEST(VariableBaseMSMTest, RunStreaming) {
+  using Point = TypeParam;
+  using Bucket = typename VariableBaseMSM<Point>::Bucket;
+
+  const VariableBaseMSMTestSet<Point>& test_set = this->test_set_;
+
+  base::Uint8VectorBuffer write_buf;
+  ASSERT_TRUE(write_buf.Grow(base::EstimateSize(test_set.bases)));
+  ASSERT_TRUE(write_buf.Write(test_set.bases));
+  ASSERT_TRUE(write_buf.Done());
+
+  base::ScopedTempDir temp_dir;
+  ASSERT_TRUE(temp_dir.CreateUniqueTempDir());
+  base::FilePath path = temp_dir.GetPath().Append("bases");
+  ASSERT_TRUE(base::WriteFile(path, write_buf.owned_buffer()));
+
+  base::MemoryMappedFile file;
+  ASSERT_TRUE(file.Initialize(path));
+  MemoryMappedBases<Point> bases;
+  size_t end_offset;
+  ASSERT_TRUE(
+      MemoryMappedBases<Point>::FromVector(&file, 0, &bases, &end_offset));
+  EXPECT_EQ(bases.size(), kSize);
+  EXPECT_EQ(end_offset, file.length());
+
+  VariableBaseMSM<Point> msm;
+  for (size_t chunk_size : {size_t{1}, size_t{7}, kSize, 2 * kSize}) {
+    Bucket ret;
+    ASSERT_TRUE(msm.RunStreaming(bases, test_set.scalars, &ret, chunk_size));
+    EXPECT_EQ(ret, test_set.answer);
+  }
+
+  std::vector<typename Point::ScalarField> scalars = test_set.scalars;
+  scalars.push_back(Point::ScalarField::One());
+  Bucket ret;
+  EXPECT_FALSE(msm.RunStreaming(bases, scalars, &ret, 7));
+}
+
 }  // namespace tachyon::math
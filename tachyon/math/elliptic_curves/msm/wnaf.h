@@ -0,0 +1,127 @@
+#ifndef TACHYON_MATH_ELLIPTIC_CURVES_MSM_WNAF_H_
+#define TACHYON_MATH_ELLIPTIC_CURVES_MSM_WNAF_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <vector>
+
+#include "tachyon/base/logging.h"
+#include "tachyon/math/base/sign.h"
+#include "tachyon/math/elliptic_curves/msm/glv.h"
+#include "tachyon/math/elliptic_curves/point_conversions.h"
+#include "tachyon/math/elliptic_curves/semigroups.h"
+
+namespace tachyon::math {
+
+// WNAF multiplies a single point by a scalar with the width-w NAF of the
+// scalar. See BigInt::ToWNAF(). Compared to the double-and-add of
+// AdditiveSemigroup::ScalarMul(), it adds about n / (w + 1) points instead of
+// n / 2 for an n-bit scalar, at the cost of precomputing P, 3P, ...,
+// (2ʷ⁻¹ - 1)P. If the curve of |Point| supports GLV, the scalar is split into
+// two halves whose NAFs share the doublings, which halves them.
+//
+// This is for a point used only a few times. For a point multiplied by many
+// scalars, e.g., the generator, see CombFixedBaseMSM.
+template <typename Point>
+class WNAF {
+ public:
+  using ScalarField = typename Point::ScalarField;
+  using RetPoint = typename internal::AdditiveSemigroupTraits<Point>::ReturnTy;
+  using AffinePointTy = AffinePoint<typename Point::Curve>;
+
+  constexpr static size_t N = ScalarField::N;
+  constexpr static uint32_t kDefaultWindowBits = 4;
+
+  // Returns |scalar| * |point|. |window_bits| should be in [2, 8].
+  static RetPoint Mul(const Point& point, const ScalarField& scalar,
+                      uint32_t window_bits = kDefaultWindowBits) {
+    CHECK_GE(window_bits, uint32_t{2});
+    CHECK_LE(window_bits, uint32_t{8});
+    if (point.IsZero() || scalar.IsZero()) return RetPoint::Zero();
+
+    std::vector<AffinePointTy> odd_multiples =
+        ComputeOddMultiples(point, window_bits);
+    if constexpr (kSupportsGLV<Point>) {
+      typename GLV<Point>::CoefficientDecompositionResult result =
+          GLV<Point>::Decompose(scalar);
+      std::vector<AffinePointTy> endomorphism_odd_multiples(
+          odd_multiples.size());
+      for (size_t i = 0; i < odd_multiples.size(); ++i) {
+        endomorphism_odd_multiples[i] =
+            AffinePointTy::Endomorphism(odd_multiples[i]);
+      }
+      return DoMul(
+          {
+              {result.k1.abs_value.ToWNAF(window_bits),
+               result.k1.sign == Sign::kNegative, &odd_multiples},
+              {result.k2.abs_value.ToWNAF(window_bits),
+               result.k2.sign == Sign::kNegative,
+               &endomorphism_odd_multiples},
+          });
+    } else {
+      return DoMul({{scalar.ToBigInt().ToWNAF(window_bits), false,
+                     &odd_multiples}});
+    }
+  }
+
+ private:
+  struct Term {
+    std::vector<int8_t> wnaf;
+    bool negative;
+    // |odd_multiples[i]| = (2i + 1) * P
+    const std::vector<AffinePointTy>* odd_multiples;
+  };
+
+  // Returns P, 3P, ..., (2ʷ⁻¹ - 1)P in affine, so that they are added with
+  // the mixed additions.
+  static std::vector<AffinePointTy> ComputeOddMultiples(const Point& point,
+                                                        uint32_t window_bits) {
+    std::vector<RetPoint> odd_multiples(size_t{1} << (window_bits - 2));
+    odd_multiples[0] = ConvertPoint<RetPoint>(point);
+    if (odd_multiples.size() > 1) {
+      RetPoint doubled = odd_multiples[0].Double();
+      for (size_t i = 1; i < odd_multiples.size(); ++i) {
+        odd_multiples[i] = odd_multiples[i - 1] + doubled;
+      }
+    }
+    std::vector<AffinePointTy> ret(odd_multiples.size());
+    CHECK(RetPoint::BatchNormalize(odd_multiples, &ret));
+    return ret;
+  }
+
+  static RetPoint DoMul(const std::vector<Term>& terms) {
+    size_t length = 0;
+    for (const Term& term : terms) {
+      length = std::max(length, term.wnaf.size());
+    }
+
+    RetPoint ret = RetPoint::Zero();
+    bool found_nonzero = false;
+    for (size_t i = length - 1; i != SIZE_MAX; --i) {
+      if (found_nonzero) {
+        ret.DoubleInPlace();
+      }
+      for (const Term& term : terms) {
+        if (i >= term.wnaf.size()) continue;
+        int8_t v = term.wnaf[i];
+        if (v == 0) continue;
+        found_nonzero = true;
+
+        const AffinePointTy& odd_multiple =
+            (*term.odd_multiples)[(v > 0 ? v : -v) / 2];
+        if ((v < 0) != term.negative) {
+          ret -= odd_multiple;
+        } else {
+          ret += odd_multiple;
+        }
+      }
+    }
+    return ret;
+  }
+};
+
+}  // namespace tachyon::math
+
+#endif  // TACHYON_MATH_ELLIPTIC_CURVES_MSM_WNAF_H_
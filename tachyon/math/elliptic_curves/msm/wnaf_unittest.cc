@@ -0,0 +1,57 @@
+#include "tachyon/math/elliptic_curves/msm/wnaf.h"
+
+#include "gtest/gtest.h"
+
+#include "tachyon/math/elliptic_curves/bls12/bls12_381/g1.h"
+#include "tachyon/math/elliptic_curves/bn/bn254/g1.h"
+#include "tachyon/math/elliptic_curves/bn/bn254/g2.h"
+#include "tachyon/math/elliptic_curves/secp/secp256k1/curve.h"
+#include "tachyon/math/elliptic_curves/short_weierstrass/test/sw_curve_config.h"
+
+namespace tachyon::math {
+
+namespace {
+
+template <typename Point>
+class WNAFTest : public testing::Test {
+ public:
+  static void SetUpTestSuite() { Point::Curve::Init(); }
+};
+
+}  // namespace
+
+using PointTypes =
+    testing::Types<bls12_381::G1AffinePoint, bn254::G1AffinePoint,
+                   bn254::G1JacobianPoint, bn254::G2AffinePoint,
+                   bn254::G1PointXYZZ, secp256k1::AffinePoint,
+                   test::AffinePoint>;
+TYPED_TEST_SUITE(WNAFTest, PointTypes);
+
+TYPED_TEST(WNAFTest, Mul) {
+  using Point = TypeParam;
+  using ScalarField = typename Point::ScalarField;
+
+  for (uint32_t window_bits = 2; window_bits <= 8; ++window_bits) {
+    SCOPED_TRACE(window_bits);
+    for (size_t i = 0; i < 10; ++i) {
+      Point point = Point::Random();
+      ScalarField scalar = ScalarField::Random();
+      EXPECT_EQ(WNAF<Point>::Mul(point, scalar, window_bits), point * scalar);
+      EXPECT_EQ(WNAF<Point>::Mul(point, -scalar, window_bits),
+                point * -scalar);
+    }
+  }
+}
+
+TYPED_TEST(WNAFTest, MulByZero) {
+  using Point = TypeParam;
+  using ScalarField = typename Point::ScalarField;
+  using RetPoint = typename WNAF<Point>::RetPoint;
+
+  EXPECT_TRUE(WNAF<Point>::Mul(Point::Random(), ScalarField::Zero()).IsZero());
+  EXPECT_TRUE(WNAF<Point>::Mul(Point::Zero(), ScalarField::Random()).IsZero());
+  EXPECT_EQ(WNAF<Point>::Mul(Point::Generator(), ScalarField::One()),
+            ConvertPoint<RetPoint>(Point::Generator()));
+}
+
+}  // namespace tachyon::math
@@ -12,7 +12,10 @@
 
 #include "absl/strings/substitute.h"
 
-namespace tachyon::math {
+#include "tachyon/base/buffer/copyable.h"
+
+namespace tachyon {
+namespace math {
 
 template <typename F>
 class EllCoeff {
@@ -26,6 +29,11 @@ class EllCoeff {
   const F& c1() const { return c1_; }
   const F& c2() const { return c2_; }
 
+  bool operator==(const EllCoeff& other) const {
+    return c0_ == other.c0_ && c1_ == other.c1_ && c2_ == other.c2_;
+  }
+  bool operator!=(const EllCoeff& other) const { return !operator==(other); }
+
   std::string ToString() const {
     return absl::Substitute("{c0: $0, c1: $1, c2: $2}", c0_.ToString(),
                             c1_.ToString(), c2_.ToString());
@@ -40,6 +48,32 @@ class EllCoeff {
 template <typename F>
 using EllCoeffs = std::vector<EllCoeff<F>>;
 
-}  // namespace tachyon::math
+}  // namespace math
+
+namespace base {
+
+template <typename F>
+class Copyable<math::EllCoeff<F>> {
+ public:
+  static bool WriteTo(const math::EllCoeff<F>& ell_coeff, Buffer* buffer) {
+    return buffer->WriteMany(ell_coeff.c0(), ell_coeff.c1(), ell_coeff.c2());
+  }
+
+  static bool ReadFrom(const ReadOnlyBuffer& buffer,
+                       math::EllCoeff<F>* ell_coeff) {
+    F c0, c1, c2;
+    if (!buffer.ReadMany(&c0, &c1, &c2)) return false;
+
+    *ell_coeff = math::EllCoeff<F>(std::move(c0), std::move(c1), std::move(c2));
+    return true;
+  }
+
+  static size_t EstimateSize(const math::EllCoeff<F>& ell_coeff) {
+    return base::EstimateSize(ell_coeff.c0(), ell_coeff.c1(), ell_coeff.c2());
+  }
+};
+
+}  // namespace base
+}  // namespace tachyon
 
 #endif  // TACHYON_MATH_ELLIPTIC_CURVES_PAIRING_ELL_COEFF_H_
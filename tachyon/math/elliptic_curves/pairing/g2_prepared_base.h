@@ -6,11 +6,14 @@
 #ifndef TACHYON_MATH_ELLIPTIC_CURVES_PAIRING_G2_PREPARED_BASE_H_
 #define TACHYON_MATH_ELLIPTIC_CURVES_PAIRING_G2_PREPARED_BASE_H_
 
+#include <type_traits>
 #include <utility>
 
+#include "tachyon/base/buffer/copyable.h"
 #include "tachyon/math/elliptic_curves/pairing/ell_coeff.h"
 
-namespace tachyon::math {
+namespace tachyon {
+namespace math {
 
 template <typename PairingFriendlyCurveConfig>
 class G2PreparedBase {
@@ -28,6 +31,13 @@ class G2PreparedBase {
   const EllCoeffs<Fp2>& ell_coeffs() const { return ell_coeffs_; }
   bool infinity() const { return infinity_; }
 
+  bool operator==(const G2PreparedBase& other) const {
+    return infinity_ == other.infinity_ && ell_coeffs_ == other.ell_coeffs_;
+  }
+  bool operator!=(const G2PreparedBase& other) const {
+    return !operator==(other);
+  }
+
  protected:
   // Stores the coefficients of the line evaluations as calculated in
   // https://eprint.iacr.org/2013/722.pdf
@@ -35,6 +45,39 @@ class G2PreparedBase {
   bool infinity_ = true;
 };
 
-}  // namespace tachyon::math
+}  // namespace math
+
+namespace base {
+
+// The line coefficients of a fixed G2 point, e.g., [𝜏]₂ of a KZG verifier, can
+// be stored along with the point, so that they are read instead of recomputed.
+template <typename Derived>
+class Copyable<
+    Derived, std::enable_if_t<std::is_base_of_v<
+                 math::G2PreparedBase<typename Derived::Config>, Derived>>> {
+ public:
+  using Fp2 = typename math::G2PreparedBase<typename Derived::Config>::Fp2;
+
+  static bool WriteTo(const Derived& g2_prepared, Buffer* buffer) {
+    return buffer->WriteMany(g2_prepared.infinity(), g2_prepared.ell_coeffs());
+  }
+
+  static bool ReadFrom(const ReadOnlyBuffer& buffer, Derived* g2_prepared) {
+    bool infinity;
+    math::EllCoeffs<Fp2> ell_coeffs;
+    if (!buffer.ReadMany(&infinity, &ell_coeffs)) return false;
+
+    *g2_prepared = infinity ? Derived() : Derived(std::move(ell_coeffs));
+    return true;
+  }
+
+  static size_t EstimateSize(const Derived& g2_prepared) {
+    return base::EstimateSize(g2_prepared.infinity(),
+                              g2_prepared.ell_coeffs());
+  }
+};
+
+}  // namespace base
+}  // namespace tachyon
 
 #endif  // TACHYON_MATH_ELLIPTIC_CURVES_PAIRING_G2_PREPARED_BASE_H_
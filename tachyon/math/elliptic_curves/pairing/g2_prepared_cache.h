@@ -0,0 +1,82 @@
+#ifndef TACHYON_MATH_ELLIPTIC_CURVES_PAIRING_G2_PREPARED_CACHE_H_
+#define TACHYON_MATH_ELLIPTIC_CURVES_PAIRING_G2_PREPARED_CACHE_H_
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "absl/synchronization/mutex.h"
+
+#include "tachyon/base/no_destructor.h"
+
+namespace tachyon::math {
+
+// G2PreparedCache keeps the G2Prepared of the G2 points which are fixed for
+// the lifetime of the process, e.g., the generator and [𝜏]₂ of a KZG
+// verifier. Preparing the 2 G2 points of a KZG verifier costs about a fifth of
+// its pairing on BN254, so the verifiers, which may be constructed per proof,
+// look them up here instead.
+//
+// The points are compared one by one, since only a few of them are expected.
+// Do not cache the points which vary per call, e.g., the ones from a proof.
+template <typename Curve>
+class G2PreparedCache {
+ public:
+  using G2Prepared = typename Curve::G2Prepared;
+  using G2AffinePoint = typename Curve::G2Curve::AffinePoint;
+
+  static G2PreparedCache& GetInstance() {
+    static base::NoDestructor<G2PreparedCache> cache;
+    return *cache;
+  }
+
+  G2PreparedCache(const G2PreparedCache& other) = delete;
+  G2PreparedCache& operator=(const G2PreparedCache& other) = delete;
+  ~G2PreparedCache() = default;
+
+  // Returns the G2Prepared of |point|. It is prepared on the first call.
+  const G2Prepared& Get(const G2AffinePoint& point) {
+    absl::MutexLock lock(&mu_);
+    if (const G2Prepared* prepared = Find(point)) return *prepared;
+    entries_.push_back(
+        {point, std::make_unique<G2Prepared>(G2Prepared::From(point))});
+    return *entries_.back().prepared;
+  }
+
+  // Stores |prepared| as the G2Prepared of |point|, e.g., the one read with
+  // base::Copyable<G2Prepared>, unless |point| is already cached. Note that
+  // |prepared| is not checked against |point|.
+  void Put(const G2AffinePoint& point, G2Prepared&& prepared) {
+    absl::MutexLock lock(&mu_);
+    if (Find(point)) return;
+    entries_.push_back(
+        {point, std::make_unique<G2Prepared>(std::move(prepared))});
+  }
+
+ private:
+  friend class base::NoDestructor<G2PreparedCache>;
+
+  struct Entry {
+    G2AffinePoint point;
+    // NOTE: This is a pointer so that the references returned by |Get()| are
+    // not invalidated when |entries_| grows.
+    std::unique_ptr<G2Prepared> prepared;
+  };
+
+  G2PreparedCache() = default;
+
+  const G2Prepared* Find(const G2AffinePoint& point) const
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_) {
+    for (const Entry& entry : entries_) {
+      if (entry.point == point) return entry.prepared.get();
+    }
+    return nullptr;
+  }
+
+  absl::Mutex mu_;
+  std::vector<Entry> entries_ ABSL_GUARDED_BY(mu_);
+};
+
+}  // namespace tachyon::math
+
+#endif  // TACHYON_MATH_ELLIPTIC_CURVES_PAIRING_G2_PREPARED_CACHE_H_
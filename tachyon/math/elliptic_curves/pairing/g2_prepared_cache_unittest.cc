@@ -0,0 +1,77 @@
+#include "tachyon/math/elliptic_curves/pairing/g2_prepared_cache.h"
+
+#include "gtest/gtest.h"
+
+#include "tachyon/base/buffer/vector_buffer.h"
+#include "tachyon/math/elliptic_curves/bls12/bls12_381/bls12_381.h"
+#include "tachyon/math/elliptic_curves/bn/bn254/bn254.h"
+
+namespace tachyon::math {
+
+template <typename Curve>
+class G2PreparedCacheTest : public testing::Test {
+ public:
+  static void SetUpTestSuite() {
+    using G1Curve = typename Curve::G1Curve;
+    using G2Curve = typename Curve::G2Curve;
+
+    G1Curve::Init();
+    G2Curve::Init();
+    Curve::Init();
+  }
+};
+
+using CurveTypes = testing::Types<bn254::BN254Curve, bls12_381::BLS12_381Curve>;
+TYPED_TEST_SUITE(G2PreparedCacheTest, CurveTypes);
+
+TYPED_TEST(G2PreparedCacheTest, Get) {
+  using Curve = TypeParam;
+  using G2AffinePoint = typename Curve::G2Curve::AffinePoint;
+  using G2Prepared = typename Curve::G2Prepared;
+
+  G2PreparedCache<Curve>& cache = G2PreparedCache<Curve>::GetInstance();
+  G2AffinePoint point = G2AffinePoint::Random();
+  const G2Prepared& prepared = cache.Get(point);
+  EXPECT_EQ(prepared, G2Prepared::From(point));
+  EXPECT_EQ(&cache.Get(point), &prepared);
+  EXPECT_NE(&cache.Get(-point), &prepared);
+}
+
+TYPED_TEST(G2PreparedCacheTest, Put) {
+  using Curve = TypeParam;
+  using G2AffinePoint = typename Curve::G2Curve::AffinePoint;
+  using G2Prepared = typename Curve::G2Prepared;
+
+  G2PreparedCache<Curve>& cache = G2PreparedCache<Curve>::GetInstance();
+  G2AffinePoint point = G2AffinePoint::Random();
+  G2Prepared expected = G2Prepared::From(point);
+  cache.Put(point, G2Prepared(expected));
+  EXPECT_EQ(cache.Get(point), expected);
+
+  // The cached one is kept.
+  cache.Put(point, G2Prepared());
+  EXPECT_EQ(cache.Get(point), expected);
+}
+
+TYPED_TEST(G2PreparedCacheTest, Copyable) {
+  using Curve = TypeParam;
+  using G2AffinePoint = typename Curve::G2Curve::AffinePoint;
+  using G2Prepared = typename Curve::G2Prepared;
+
+  G2Prepared expected_values[] = {G2Prepared::From(G2AffinePoint::Random()),
+                                  G2Prepared::From(G2AffinePoint::Zero())};
+  for (const G2Prepared& expected : expected_values) {
+    base::Uint8VectorBuffer write_buf;
+    ASSERT_TRUE(write_buf.Grow(base::EstimateSize(expected)));
+    ASSERT_TRUE(write_buf.Write(expected));
+    ASSERT_TRUE(write_buf.Done());
+
+    write_buf.set_buffer_offset(0);
+
+    G2Prepared value;
+    ASSERT_TRUE(write_buf.Read(&value));
+    EXPECT_EQ(value, expected);
+  }
+}
+
+}  // namespace tachyon::math
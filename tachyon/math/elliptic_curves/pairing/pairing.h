@@ -1,11 +1,21 @@
 #ifndef TACHYON_MATH_ELLIPTIC_CURVES_PAIRING_PAIRING_H_
 #define TACHYON_MATH_ELLIPTIC_CURVES_PAIRING_PAIRING_H_
 
-#include "tachyon/base/containers/container_util.h"
+#include <iterator>
+#include <type_traits>
+#include <vector>
+
+#include "tachyon/base/openmp_util.h"
 #include "tachyon/base/template_util.h"
 
 namespace tachyon::math {
 
+// Returns e(a₀, b₀) * e(a₁, b₁) * ... * e(aₙ₋₁, bₙ₋₁). The Miller loops over
+// the pairs are split across the threads and the final exponentiation is done
+// once for the product. If |b| holds the G2 affine points, they are prepared in
+// parallel, which needs random access to |b|. Prefer passing the G2Prepared of
+// the fixed G2 points, e.g., from G2PreparedCache, since preparing a G2 point
+// costs about a tenth of a 2-pair pairing on BN254.
 template <typename Curve, typename G1AffinePointContainer,
           typename G2AffineOrPreparedPointContainer>
 auto Pairing(const G1AffinePointContainer& a,
@@ -16,11 +26,11 @@ auto Pairing(const G1AffinePointContainer& a,
                     G2Prepared>) {
     return Curve::FinalExponentiation(Curve::MultiMillerLoop(a, b));
   } else {
-    using G2AffinePoint = typename Curve::G2Curve::AffinePoint;
-    return Curve::FinalExponentiation(
-        Curve::MultiMillerLoop(a, base::Map(b, [](const G2AffinePoint& point) {
-                                 return G2Prepared::From(point);
-                               })));
+    std::vector<G2Prepared> prepared(std::size(b));
+    OPENMP_PARALLEL_FOR(size_t i = 0; i < prepared.size(); ++i) {
+      prepared[i] = G2Prepared::From(std::begin(b)[i]);
+    }
+    return Curve::FinalExponentiation(Curve::MultiMillerLoop(a, prepared));
   }
 }
 
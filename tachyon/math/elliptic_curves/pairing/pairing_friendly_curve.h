@@ -1,8 +1,16 @@
 #ifndef TACHYON_MATH_ELLIPTIC_CURVES_PAIRING_PAIRING_FRIENDLY_CURVE_H_
 #define TACHYON_MATH_ELLIPTIC_CURVES_PAIRING_PAIRING_FRIENDLY_CURVE_H_
 
+#include <stddef.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <numeric>
 #include <vector>
 
+#include "tachyon/base/parallelize.h"
 #include "tachyon/math/elliptic_curves/pairing/ell_coeff.h"
 #include "tachyon/math/elliptic_curves/pairing/twist_type.h"
 
@@ -40,7 +48,7 @@ class PairingFriendlyCurve {
   };
 
   static Fp12 PowByX(const Fp12& f_in) {
-    Fp12 f = f_in.CyclotomicPow(Config::kX);
+    Fp12 f = PowByAbsX(f_in);
     if constexpr (Config::kXIsNegative) {
       f.CyclotomicInverseInPlace();
     }
@@ -48,13 +56,30 @@ class PairingFriendlyCurve {
   }
 
   static Fp12 PowByNegX(const Fp12& f_in) {
-    Fp12 f = f_in.CyclotomicPow(Config::kX);
+    Fp12 f = PowByAbsX(f_in);
     if constexpr (!Config::kXIsNegative) {
       f.CyclotomicInverseInPlace();
     }
     return f;
   }
 
+  // Returns f^|x| for f in the cyclotomic subgroup. BN254 and BLS12-381 run
+  // their addition chains of |x|. Otherwise, if the NAF of |x| is sparse, the
+  // squarings run in the compressed form, and if not, the width-4 NAF is used.
+  static Fp12 PowByAbsX(const Fp12& f) {
+    if constexpr (IsAbsX(kBN254AbsX)) {
+      return PowByBN254AbsX(f);
+    } else if constexpr (IsAbsX(kBLS12_381AbsX)) {
+      return PowByBLS12_381AbsX(f);
+    } else {
+      static const bool is_x_sparse = IsXSparse();
+      if (is_x_sparse) {
+        return f.CompressedCyclotomicPow(Config::kX);
+      }
+      return f.CyclotomicPowWithWindow(Config::kX, 4);
+    }
+  }
+
   // TODO(chokobole): Leave a comment to help understand readers.
   // Evaluates the line function at point |p|.
   static void Ell(Fp12& f, const EllCoeff<Fp2>& coeffs,
@@ -66,6 +91,20 @@ class PairingFriendlyCurve {
     }
   }
 
+  // Runs the Miller loop |callback| over the chunks of |pairs| in parallel and
+  // returns the product of the partial results. Since every chunk repeats the
+  // squarings of the loop, |pairs| is split into a chunk per thread rather than
+  // into the chunks of a fixed size. For example, the 2 pairs of a KZG
+  // verification run on 2 threads, and 64 pairs on 8 threads run 8 chunks
+  // instead of 16.
+  template <typename Callback>
+  static Fp12 ParallelizeMillerLoop(std::vector<Pair>& pairs,
+                                    Callback callback) {
+    std::vector<Fp12> results = base::ParallelizeMap(pairs, callback);
+    return std::accumulate(results.begin(), results.end(), Fp12::One(),
+                           std::multiplies<>());
+  }
+
   template <typename G1AffinePointContainer, typename G2PreparedContainer>
   static std::vector<Pair> CreatePairs(const G1AffinePointContainer& a,
                                        const G2PreparedContainer& b) {
@@ -80,6 +119,138 @@ class PairingFriendlyCurve {
     }
     return pairs;
   }
+
+ private:
+  constexpr static uint64_t kBN254AbsX = UINT64_C(0x44e992b44a6909f1);
+  constexpr static uint64_t kBLS12_381AbsX = UINT64_C(0xd201000000010000);
+
+  // A decompression costs about as much as 4 compressed squarings save, so the
+  // runs of at least this many squarings are compressed.
+  constexpr static size_t kMinCompressedSquaringNums = 6;
+
+  constexpr static bool IsAbsX(uint64_t value) {
+    if (Config::kX[0] != value) return false;
+    for (size_t i = 1; i < std::size(Config::kX.limbs); ++i) {
+      if (Config::kX[i] != 0) return false;
+    }
+    return true;
+  }
+
+  // f = f^(2ⁿ) for f in the cyclotomic subgroup.
+  static void CyclotomicSquareNTimesInPlace(Fp12& f, size_t n) {
+    if (n < kMinCompressedSquaringNums) {
+      for (size_t i = 0; i < n; ++i) {
+        f.CyclotomicSquareInPlace();
+      }
+      return;
+    }
+    for (size_t i = 0; i < n; ++i) {
+      f.CompressedCyclotomicSquareInPlace();
+    }
+    f.DecompressCyclotomicInPlace();
+  }
+
+  // Returns f^|x| for |x| = 0x44e992b44a6909f1 of BN254 with 62 squarings and
+  // 17 multiplications, where 57 of the squarings run in the compressed form.
+  // The width-4 NAF takes as many multiplications, but none of its squarings
+  // is compressed, since a nonzero digit comes every 4.5 bits on average. This
+  // is the addition chain of gnark-crypto.
+  static Fp12 PowByBN254AbsX(const Fp12& f) {
+    // t3 = f^0x2
+    Fp12 t3 = f.CyclotomicSquare();
+    // t5 = f^0x4
+    Fp12 t5 = t3.CyclotomicSquare();
+    // ret = f^0x8
+    Fp12 ret = t5.CyclotomicSquare();
+    // t0 = f^0x10
+    Fp12 t0 = ret.CyclotomicSquare();
+    // t2 = f^0x11
+    Fp12 t2 = t0 * f;
+    // t0 = f^0x13
+    t0 = t2 * t3;
+    // t1 = f^0x14
+    Fp12 t1 = t0 * f;
+    // t4 = f^0x19
+    Fp12 t4 = t2 * ret;
+    // t6 = f^0x22
+    Fp12 t6 = t2.CyclotomicSquare();
+    // t1 = f^0x27
+    t1 *= t0;
+    // t0 = f^0x29
+    t0 = t1 * t3;
+    // t6 = f^0x880
+    CyclotomicSquareNTimesInPlace(t6, 6);
+    // t5 = f^0x89d
+    t5 *= t6;
+    t5 *= t4;
+    // t5 = f^0x44e80
+    CyclotomicSquareNTimesInPlace(t5, 7);
+    // t4 = f^0x44e99
+    t4 *= t5;
+    // t4 = f^0x44e9900
+    CyclotomicSquareNTimesInPlace(t4, 8);
+    // t4 = f^0x44e9929
+    t4 *= t0;
+    // t3 = f^0x44e992b
+    t3 *= t4;
+    // t3 = f^0x113a64ac0
+    CyclotomicSquareNTimesInPlace(t3, 6);
+    // t2 = f^0x113a64ad1
+    t2 *= t3;
+    // t2 = f^0x113a64ad100
+    CyclotomicSquareNTimesInPlace(t2, 8);
+    // t2 = f^0x113a64ad129
+    t2 *= t0;
+    // t2 = f^0x44e992b44a40
+    CyclotomicSquareNTimesInPlace(t2, 6);
+    // t2 = f^0x44e992b44a69
+    t2 *= t0;
+    // t2 = f^0x113a64ad129a400
+    CyclotomicSquareNTimesInPlace(t2, 10);
+    // t1 = f^0x113a64ad129a427
+    t1 *= t2;
+    // t1 = f^0x44e992b44a6909c0
+    CyclotomicSquareNTimesInPlace(t1, 6);
+    // t0 = f^0x44e992b44a6909e9
+    t0 *= t1;
+    // ret = f^0x44e992b44a6909f1
+    ret *= t0;
+    return ret;
+  }
+
+  // Returns f^|x| for |x| = 0xd201000000010000 of BLS12-381 with 63 squarings
+  // and 5 multiplications, where 57 of the squarings run in the compressed
+  // form. Unlike CompressedCyclotomicPow(), which decompresses and multiplies
+  // a power for each of the 6 nonzero NAF digits, the leading 16 bits are
+  // built up before the long runs of squarings, so that only 3 values are
+  // decompressed.
+  static Fp12 PowByBLS12_381AbsX(const Fp12& f) {
+    // ret = f^0x3
+    Fp12 ret = f.CyclotomicSquare();
+    ret *= f;
+    // ret = f^0xd
+    CyclotomicSquareNTimesInPlace(ret, 2);
+    ret *= f;
+    // ret = f^0x69
+    CyclotomicSquareNTimesInPlace(ret, 3);
+    ret *= f;
+    // ret = f^0xd201
+    CyclotomicSquareNTimesInPlace(ret, 9);
+    ret *= f;
+    // ret = f^0xd20100000001
+    CyclotomicSquareNTimesInPlace(ret, 32);
+    ret *= f;
+    // ret = f^0xd201000000010000
+    CyclotomicSquareNTimesInPlace(ret, 16);
+    return ret;
+  }
+
+  static bool IsXSparse() {
+    std::vector<int8_t> naf = Config::kX.ToNAF();
+    size_t nonzeros = std::count_if(naf.begin(), naf.end(),
+                                    [](int8_t digit) { return digit != 0; });
+    return naf.size() >= 4 * nonzeros;
+  }
 };
 
 }  // namespace tachyon::math
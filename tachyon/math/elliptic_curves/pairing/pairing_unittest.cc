@@ -1,7 +1,10 @@
 #include "tachyon/math/elliptic_curves/pairing/pairing.h"
 
+#include <vector>
+
 #include "gtest/gtest.h"
 
+#include "tachyon/base/containers/container_util.h"
 #include "tachyon/math/elliptic_curves/bls12/bls12_381/bls12_381.h"
 #include "tachyon/math/elliptic_curves/bn/bn254/bn254.h"
 
@@ -20,6 +23,13 @@ class PairingTest : public testing::Test {
   }
 };
 
+// Exposes PairingFriendlyCurve::PowByAbsX().
+template <typename Curve>
+class PowByAbsXCurve : public Curve {
+ public:
+  using Curve::PowByAbsX;
+};
+
 using CurveTypes = testing::Types<bn254::BN254Curve, bls12_381::BLS12_381Curve>;
 TYPED_TEST_SUITE(PairingTest, CurveTypes);
 
@@ -72,4 +82,52 @@ TYPED_TEST(PairingTest, Bilinearity) {
   EXPECT_EQ(result, result4);
 }
 
+// BN254 and BLS12-381 run their addition chains of |x|.
+TYPED_TEST(PairingTest, PowByAbsX) {
+  using Curve = TypeParam;
+  using Fp12 = typename Curve::Fp12;
+
+  // f^((p⁶ - 1)(p² + 1)) is in the cyclotomic subgroup.
+  Fp12 f = Fp12::Random();
+  f = f.CyclotomicInverse() * f.Inverse();
+  Fp12 f_p2 = f;
+  f *= f_p2.FrobeniusMapInPlace(2);
+
+  EXPECT_EQ(PowByAbsXCurve<Curve>::PowByAbsX(f),
+            f.CyclotomicPow(Curve::Config::kX));
+}
+
+TYPED_TEST(PairingTest, MultiPairing) {
+  using Curve = TypeParam;
+  using G1AffinePoint = typename Curve::G1Curve::AffinePoint;
+  using G2AffinePoint = typename Curve::G2Curve::AffinePoint;
+  using G2Prepared = typename Curve::G2Prepared;
+  using Fp12 = typename Curve::Fp12;
+
+  // The pairs are split into more than one chunk when run on multiple
+  // threads. The points at infinity are skipped.
+  for (size_t size : {0, 1, 2, 7}) {
+    std::vector<G1AffinePoint> g1s =
+        base::CreateVector(size, []() { return G1AffinePoint::Random(); });
+    std::vector<G2AffinePoint> g2s =
+        base::CreateVector(size, []() { return G2AffinePoint::Random(); });
+    if (size == 7) {
+      g1s[3] = G1AffinePoint::Zero();
+      g2s[5] = G2AffinePoint::Zero();
+    }
+
+    Fp12 expected = Fp12::One();
+    for (size_t i = 0; i < size; ++i) {
+      G1AffinePoint g1[] = {g1s[i]};
+      G2AffinePoint g2[] = {g2s[i]};
+      expected *= Pairing<Curve>(g1, g2);
+    }
+
+    EXPECT_EQ(Pairing<Curve>(g1s, g2s), expected);
+    std::vector<G2Prepared> prepared = base::Map(
+        g2s, [](const G2AffinePoint& g2) { return G2Prepared::From(g2); });
+    EXPECT_EQ(Pairing<Curve>(g1s, prepared), expected);
+  }
+}
+
 }  // namespace tachyon::math
@@ -7,6 +7,8 @@
 #include <ostream>
 #include <string>
 
+#include "tachyon/base/cxx20_is_constant_evaluated.h"
+#include "tachyon/base/logging.h"
 #include "tachyon/math/base/big_int.h"
 #include "tachyon/math/base/gmp/gmp_util.h"
 #include "tachyon/math/finite_fields/prime_field_base.h"
@@ -205,6 +207,14 @@ class PrimeField<_Config, std::enable_if_t<_Config::kIsSecp256k1Fr>> final
   }
 
   constexpr PrimeField& InverseInPlace() {
+    if constexpr (Config::kUseSafeGcdInverse) {
+      if (!base::is_constant_evaluated()) {
+        CHECK(!IsZero());
+        // (aR)⁻¹ * R³ * R⁻¹ = a⁻¹R
+        value_ = this->GetSafeGcd().Inverse(value_);
+        return MulInPlace(FromMontgomery(Config::kMontgomeryR3));
+      }
+    }
     value_ = value_.template MontgomeryInverse<Config::kModulusHasSpareBit>(
         Config::kModulus, Config::kMontgomeryR2);
     return *this;
@@ -0,0 +1,124 @@
+#include "benchmark/benchmark.h"
+
+#include "tachyon/base/containers/container_util.h"
+#include "tachyon/base/logging.h"
+#include "tachyon/math/elliptic_curves/bn/bn254/g1.h"
+
+namespace tachyon::math {
+
+template <typename AffinePoint>
+std::vector<AffinePoint> CreateRandomPoints(size_t size) {
+  return base::CreateVector(size, []() { return AffinePoint::Random(); });
+}
+
+template <typename AffinePoint>
+void BM_BatchAdd(benchmark::State& state) {
+  AffinePoint::Curve::Init();
+  std::vector<AffinePoint> a = CreateRandomPoints<AffinePoint>(state.range(0));
+  std::vector<AffinePoint> b = CreateRandomPoints<AffinePoint>(state.range(0));
+  std::vector<AffinePoint> results(state.range(0));
+  for (auto _ : state) {
+    CHECK(AffinePoint::BatchAdd(a, b, &results));
+  }
+  benchmark::DoNotOptimize(results);
+}
+
+// Adds the same pairs with the mixed additions in XYZZ, which is what the
+// buckets of Pippenger do without the batch affine additions.
+template <typename AffinePoint>
+void BM_AddXYZZ(benchmark::State& state) {
+  using PointXYZZ = PointXYZZ<typename AffinePoint::Curve>;
+
+  AffinePoint::Curve::Init();
+  std::vector<AffinePoint> a = CreateRandomPoints<AffinePoint>(state.range(0));
+  std::vector<AffinePoint> b = CreateRandomPoints<AffinePoint>(state.range(0));
+  std::vector<PointXYZZ> results(state.range(0));
+  for (auto _ : state) {
+    for (size_t i = 0; i < a.size(); ++i) {
+      results[i] = a[i].ToXYZZ();
+      results[i] += b[i];
+    }
+  }
+  benchmark::DoNotOptimize(results);
+}
+
+template <typename AffinePoint>
+void BM_BatchDouble(benchmark::State& state) {
+  AffinePoint::Curve::Init();
+  std::vector<AffinePoint> points =
+      CreateRandomPoints<AffinePoint>(state.range(0));
+  std::vector<AffinePoint> results(state.range(0));
+  for (auto _ : state) {
+    CHECK(AffinePoint::BatchDouble(points, &results));
+  }
+  benchmark::DoNotOptimize(results);
+}
+
+template <typename AffinePoint>
+void BM_DoubleXYZZ(benchmark::State& state) {
+  using PointXYZZ = PointXYZZ<typename AffinePoint::Curve>;
+
+  AffinePoint::Curve::Init();
+  std::vector<AffinePoint> points =
+      CreateRandomPoints<AffinePoint>(state.range(0));
+  std::vector<PointXYZZ> results(state.range(0));
+  for (auto _ : state) {
+    for (size_t i = 0; i < points.size(); ++i) {
+      results[i] = points[i].DoubleXYZZ();
+    }
+  }
+  benchmark::DoNotOptimize(results);
+}
+
+BENCHMARK_TEMPLATE(BM_BatchAdd, bn254::G1AffinePoint)
+    ->RangeMultiplier(4)
+    ->Range(1 << 6, 1 << 16);
+BENCHMARK_TEMPLATE(BM_AddXYZZ, bn254::G1AffinePoint)
+    ->RangeMultiplier(4)
+    ->Range(1 << 6, 1 << 16);
+BENCHMARK_TEMPLATE(BM_BatchDouble, bn254::G1AffinePoint)
+    ->RangeMultiplier(4)
+    ->Range(1 << 6, 1 << 16);
+BENCHMARK_TEMPLATE(BM_DoubleXYZZ, bn254::G1AffinePoint)
+    ->RangeMultiplier(4)
+    ->Range(1 << 6, 1 << 16);
+
+}  // namespace tachyon::math
+
+// clang-format off
+// Executing tests from //tachyon/math/elliptic_curves/short_weierstrass:affine_point_benchmark
+// -----------------------------------------------------------------------------
+// Run on (1 X 2100 MHz CPU )
+// CPU Caches:
+//   L1 Data 48 KiB (x1)
+//   L1 Instruction 32 KiB (x1)
+//   L2 Unified 2048 KiB (x1)
+//   L3 Unified 307200 KiB (x1)
+// -------------------------------------------------------------------------------------
+// Benchmark                                           Time             CPU   Iterations
+// -------------------------------------------------------------------------------------
+// BM_BatchAdd<bn254::G1AffinePoint>/64            16906 ns        16796 ns        41504
+// BM_BatchAdd<bn254::G1AffinePoint>/256           58741 ns        57967 ns        12374
+// BM_BatchAdd<bn254::G1AffinePoint>/1024         219531 ns       218917 ns         3104
+// BM_BatchAdd<bn254::G1AffinePoint>/4096         883778 ns       877157 ns          750
+// BM_BatchAdd<bn254::G1AffinePoint>/16384       3671492 ns      3643139 ns          184
+// BM_BatchAdd<bn254::G1AffinePoint>/65536      15695446 ns     15577428 ns           47
+// BM_AddXYZZ<bn254::G1AffinePoint>/64             15462 ns        15162 ns        45774
+// BM_AddXYZZ<bn254::G1AffinePoint>/256            60107 ns        59730 ns        11850
+// BM_AddXYZZ<bn254::G1AffinePoint>/1024          247176 ns       245494 ns         2652
+// BM_AddXYZZ<bn254::G1AffinePoint>/4096         1092897 ns      1085318 ns          643
+// BM_AddXYZZ<bn254::G1AffinePoint>/16384        4451225 ns      4401171 ns          168
+// BM_AddXYZZ<bn254::G1AffinePoint>/65536       17604635 ns     17512603 ns           34
+// BM_BatchDouble<bn254::G1AffinePoint>/64         16375 ns        16330 ns        43131
+// BM_BatchDouble<bn254::G1AffinePoint>/256        56651 ns        56276 ns        12456
+// BM_BatchDouble<bn254::G1AffinePoint>/1024      245719 ns       226558 ns         3126
+// BM_BatchDouble<bn254::G1AffinePoint>/4096     1007949 ns       968606 ns          733
+// BM_BatchDouble<bn254::G1AffinePoint>/16384    3797539 ns      3764763 ns          178
+// BM_BatchDouble<bn254::G1AffinePoint>/65536   14290181 ns     14198872 ns           47
+// BM_DoubleXYZZ<bn254::G1AffinePoint>/64          12087 ns        12009 ns        59970
+// BM_DoubleXYZZ<bn254::G1AffinePoint>/256         50675 ns        50467 ns        14050
+// BM_DoubleXYZZ<bn254::G1AffinePoint>/1024       215129 ns       213399 ns         3341
+// BM_DoubleXYZZ<bn254::G1AffinePoint>/4096       907302 ns       899863 ns          795
+// BM_DoubleXYZZ<bn254::G1AffinePoint>/16384     3674173 ns      3639051 ns          184
+// BM_DoubleXYZZ<bn254::G1AffinePoint>/65536    15285064 ns     15162112 ns           46
+// clang-format on
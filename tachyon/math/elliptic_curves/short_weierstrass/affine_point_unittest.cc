@@ -3,6 +3,7 @@
 #include "gtest/gtest.h"
 
 #include "tachyon/base/buffer/vector_buffer.h"
+#include "tachyon/math/base/test/scoped_parallel_batch_inverse.h"
 #include "tachyon/math/elliptic_curves/short_weierstrass/jacobian_point.h"
 #include "tachyon/math/elliptic_curves/short_weierstrass/point_xyzz.h"
 #include "tachyon/math/elliptic_curves/short_weierstrass/projective_point.h"
@@ -114,12 +115,8 @@ TEST_F(AffinePointTest, ToPointXYZZ) {
 }
 
 TEST_F(AffinePointTest, BatchMapScalarFieldToPoint) {
-#if defined(TACHYON_HAS_OPENMP)
-  size_t size = size_t{1} << (static_cast<size_t>(omp_get_max_threads()) /
-                              GF7::kParallelBatchInverseDivisorThreshold);
-#else
-  size_t size = 7;
-#endif  // defined(TACHYON_HAS_OPENMP)
+  test::ScopedParallelBatchInverse<GF7> scoped_parallel_batch_inverse;
+  size_t size = test::kBatchInverseTestSize;
   std::vector<GF7> scalar_fields =
       base::CreateVector(size, [](int i) { return GF7(i % 7); });
   test::AffinePoint point = test::AffinePoint::Generator();
@@ -140,6 +137,49 @@ TEST_F(AffinePointTest, BatchMapScalarFieldToPoint) {
   EXPECT_EQ(affine_points, expected_affine_points);
 }
 
+TEST_F(AffinePointTest, BatchAdd) {
+  test::ScopedParallelBatchInverse<GF7> scoped_parallel_batch_inverse;
+  size_t size = test::kBatchInverseTestSize;
+  // Over GF7, the random pairs also cover P = Q, P = -Q and the identity.
+  std::vector<test::AffinePoint> a =
+      base::CreateVector(size, []() { return test::AffinePoint::Random(); });
+  std::vector<test::AffinePoint> b =
+      base::CreateVector(size, []() { return test::AffinePoint::Random(); });
+  a[0] = test::AffinePoint::Zero();
+  b[1] = test::AffinePoint::Zero();
+  b[2] = a[2];
+  b[3] = -a[3];
+  std::vector<test::AffinePoint> expected = base::CreateVector(
+      size, [&a, &b](size_t i) { return (a[i] + b[i]).ToAffine(); });
+
+  std::vector<test::AffinePoint> results(size - 1);
+  ASSERT_FALSE(test::AffinePoint::BatchAdd(a, b, &results));
+
+  results.resize(size);
+  ASSERT_TRUE(test::AffinePoint::BatchAdd(a, b, &results));
+  EXPECT_EQ(results, expected);
+
+  ASSERT_TRUE(test::AffinePoint::BatchAddInPlace(b, &a));
+  EXPECT_EQ(a, expected);
+}
+
+TEST_F(AffinePointTest, BatchDouble) {
+  test::ScopedParallelBatchInverse<GF7> scoped_parallel_batch_inverse;
+  size_t size = test::kBatchInverseTestSize;
+  std::vector<test::AffinePoint> points =
+      base::CreateVector(size, []() { return test::AffinePoint::Random(); });
+  points[0] = test::AffinePoint::Zero();
+  std::vector<test::AffinePoint> expected = base::CreateVector(
+      size, [&points](size_t i) { return points[i].Double().ToAffine(); });
+
+  std::vector<test::AffinePoint> results(size);
+  ASSERT_TRUE(test::AffinePoint::BatchDouble(points, &results));
+  EXPECT_EQ(results, expected);
+
+  ASSERT_TRUE(test::AffinePoint::BatchDouble(points, &points));
+  EXPECT_EQ(points, expected);
+}
+
 TEST_F(AffinePointTest, IsOnCurve) {
   test::AffinePoint invalid_point(GF7(1), GF7(2));
   EXPECT_FALSE(invalid_point.IsOnCurve());
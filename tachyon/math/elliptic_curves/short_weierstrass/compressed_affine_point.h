@@ -0,0 +1,184 @@
+#ifndef TACHYON_MATH_ELLIPTIC_CURVES_SHORT_WEIERSTRASS_COMPRESSED_AFFINE_POINT_H_
+#define TACHYON_MATH_ELLIPTIC_CURVES_SHORT_WEIERSTRASS_COMPRESSED_AFFINE_POINT_H_
+
+#include <stdint.h>
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "absl/strings/substitute.h"
+#include "absl/types/span.h"
+
+#include "tachyon/base/buffer/copyable.h"
+#include "tachyon/base/logging.h"
+#include "tachyon/base/parallelize.h"
+#include "tachyon/math/elliptic_curves/affine_point.h"
+#include "tachyon/math/elliptic_curves/curve_type.h"
+
+namespace tachyon {
+namespace math {
+
+// CompressedAffinePoint is an affine point on a short weierstrass curve that
+// only keeps x and the flags telling whether it is the point at infinity and
+// which of y and -y it is. This halves the size of the serialized points,
+// e.g., the powers of tau of the KZG params, at the cost of a square root per
+// point on decompression. See BatchDecompress().
+template <typename Curve>
+class CompressedAffinePoint {
+ public:
+  using BaseField = typename Curve::BaseField;
+  using AffinePointTy = AffinePoint<Curve>;
+
+  static_assert(Curve::kType == CurveType::kShortWeierstrass);
+
+  enum Flag : uint8_t {
+    kInfinity = 1 << 0,
+    kYIsOdd = 1 << 1,
+  };
+
+  CompressedAffinePoint() = default;
+  CompressedAffinePoint(const BaseField& x, uint8_t flags)
+      : x_(x), flags_(flags) {}
+  CompressedAffinePoint(BaseField&& x, uint8_t flags)
+      : x_(std::move(x)), flags_(flags) {}
+
+  static CompressedAffinePoint From(const AffinePointTy& point) {
+    if (point.infinity()) return {};
+    return {point.x(), Curve::IsOdd(point.y()) ? uint8_t{kYIsOdd} : uint8_t{0}};
+  }
+
+  // Compresses |points| in parallel.
+  template <typename Container>
+  static std::vector<CompressedAffinePoint> BatchFrom(const Container& points) {
+    size_t size = std::size(points);
+    absl::Span<const AffinePointTy> points_span(std::data(points), size);
+    std::vector<CompressedAffinePoint> ret(size);
+    base::Parallelize(
+        ret, [points_span](absl::Span<CompressedAffinePoint> chunk,
+                           size_t chunk_idx, size_t chunk_size) {
+          size_t begin = chunk_idx * chunk_size;
+          for (size_t i = 0; i < chunk.size(); ++i) {
+            chunk[i] = From(points_span[begin + i]);
+          }
+        });
+    return ret;
+  }
+
+  // Decompresses |compressed_points| into |points|. The square roots of
+  // y² = x³ + ax + b are computed in parallel with
+  // BaseField::BatchSquareRoot(). Returns false if any x is not on the curve.
+  // Like the uncompressed points read with base::Copyable, the points are not
+  // checked to be in the prime order subgroup.
+  template <typename Container>
+  [[nodiscard]] static bool BatchDecompress(
+      const Container& compressed_points, std::vector<AffinePointTy>* points) {
+    size_t size = std::size(compressed_points);
+    absl::Span<const CompressedAffinePoint> compressed_span(
+        std::data(compressed_points), size);
+    // NOTE: The points at infinity take the square root of zero, so that
+    // they don't fail the batch.
+    std::vector<BaseField> y_squares(size);
+    base::Parallelize(y_squares, [compressed_span](absl::Span<BaseField> chunk,
+                                                   size_t chunk_idx,
+                                                   size_t chunk_size) {
+      size_t begin = chunk_idx * chunk_size;
+      for (size_t i = 0; i < chunk.size(); ++i) {
+        const CompressedAffinePoint& compressed = compressed_span[begin + i];
+        chunk[i] = compressed.infinity() ? BaseField::Zero()
+                                         : Curve::ComputeYSquare(compressed.x_);
+      }
+    });
+    std::vector<BaseField> ys(size);
+    if (!BaseField::BatchSquareRoot(y_squares, &ys)) {
+      LOG(ERROR) << "Some of x coordinates are not on the curve";
+      return false;
+    }
+    y_squares.clear();
+    y_squares.shrink_to_fit();
+
+    points->resize(size);
+    base::Parallelize(*points, [compressed_span, &ys](
+                                   absl::Span<AffinePointTy> chunk,
+                                   size_t chunk_idx, size_t chunk_size) {
+      size_t begin = chunk_idx * chunk_size;
+      for (size_t i = 0; i < chunk.size(); ++i) {
+        const CompressedAffinePoint& compressed = compressed_span[begin + i];
+        if (compressed.infinity()) {
+          chunk[i] = AffinePointTy::Zero();
+          continue;
+        }
+        BaseField& y = ys[begin + i];
+        if (Curve::IsOdd(y) != compressed.y_is_odd()) y.NegInPlace();
+        chunk[i] = AffinePointTy(compressed.x_, std::move(y));
+      }
+    });
+    return true;
+  }
+
+  const BaseField& x() const { return x_; }
+  uint8_t flags() const { return flags_; }
+  bool infinity() const { return flags_ & kInfinity; }
+  bool y_is_odd() const { return flags_ & kYIsOdd; }
+
+  bool operator==(const CompressedAffinePoint& other) const {
+    if (infinity()) return other.infinity();
+    return x_ == other.x_ && flags_ == other.flags_;
+  }
+  bool operator!=(const CompressedAffinePoint& other) const {
+    return !operator==(other);
+  }
+
+  // Returns false if x is not on the curve.
+  [[nodiscard]] bool Decompress(AffinePointTy* point) const {
+    if (infinity()) {
+      *point = AffinePointTy::Zero();
+      return true;
+    }
+    return Curve::GetPointFromX(x_, y_is_odd(), point);
+  }
+
+  std::string ToString() const {
+    if (infinity()) return "infinity";
+    return absl::Substitute("($0, $1)", x_.ToString(),
+                            y_is_odd() ? "odd" : "even");
+  }
+
+ private:
+  BaseField x_;
+  uint8_t flags_ = kInfinity;
+};
+
+}  // namespace math
+
+namespace base {
+
+template <typename Curve>
+class Copyable<math::CompressedAffinePoint<Curve>> {
+ public:
+  using BaseField = typename Curve::BaseField;
+
+  static bool WriteTo(const math::CompressedAffinePoint<Curve>& point,
+                      Buffer* buffer) {
+    return buffer->WriteMany(point.x(), point.flags());
+  }
+
+  static bool ReadFrom(const ReadOnlyBuffer& buffer,
+                       math::CompressedAffinePoint<Curve>* point) {
+    BaseField x;
+    uint8_t flags;
+    if (!buffer.ReadMany(&x, &flags)) return false;
+
+    *point = math::CompressedAffinePoint<Curve>(std::move(x), flags);
+    return true;
+  }
+
+  static size_t EstimateSize(const math::CompressedAffinePoint<Curve>& point) {
+    return base::EstimateSize(point.x(), point.flags());
+  }
+};
+
+}  // namespace base
+}  // namespace tachyon
+
+#endif  // TACHYON_MATH_ELLIPTIC_CURVES_SHORT_WEIERSTRASS_COMPRESSED_AFFINE_POINT_H_
@@ -0,0 +1,91 @@
+#include "tachyon/math/elliptic_curves/short_weierstrass/compressed_affine_point.h"
+
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "tachyon/base/buffer/vector_buffer.h"
+#include "tachyon/base/containers/container_util.h"
+#include "tachyon/math/elliptic_curves/bls12/bls12_381/g2.h"
+#include "tachyon/math/elliptic_curves/bn/bn254/g1.h"
+#include "tachyon/math/elliptic_curves/bn/bn254/g2.h"
+
+namespace tachyon::math {
+
+namespace {
+
+template <typename AffinePointTy>
+class CompressedAffinePointTest : public testing::Test {
+ public:
+  static void SetUpTestSuite() { AffinePointTy::Curve::Init(); }
+};
+
+}  // namespace
+
+using AffinePointTypes =
+    testing::Types<bn254::G1AffinePoint, bn254::G2AffinePoint,
+                   bls12_381::G2AffinePoint>;
+TYPED_TEST_SUITE(CompressedAffinePointTest, AffinePointTypes);
+
+TYPED_TEST(CompressedAffinePointTest, Decompress) {
+  using AffinePointTy = TypeParam;
+  using CompressedPoint = CompressedAffinePoint<typename TypeParam::Curve>;
+
+  for (const AffinePointTy& expected :
+       {AffinePointTy::Random(), -AffinePointTy::Random(),
+        AffinePointTy::Zero()}) {
+    CompressedPoint compressed = CompressedPoint::From(expected);
+    EXPECT_EQ(compressed.infinity(), expected.infinity());
+    AffinePointTy point;
+    ASSERT_TRUE(compressed.Decompress(&point));
+    EXPECT_EQ(point, expected);
+  }
+}
+
+TYPED_TEST(CompressedAffinePointTest, BatchDecompress) {
+  using AffinePointTy = TypeParam;
+  using CompressedPoint = CompressedAffinePoint<typename TypeParam::Curve>;
+
+  std::vector<AffinePointTy> expected =
+      base::CreateVector(100, []() { return AffinePointTy::Random(); });
+  expected[10] = AffinePointTy::Zero();
+  std::vector<CompressedPoint> compressed =
+      CompressedPoint::BatchFrom(expected);
+  std::vector<AffinePointTy> points;
+  ASSERT_TRUE(CompressedPoint::BatchDecompress(compressed, &points));
+  EXPECT_EQ(points, expected);
+
+  // Half of the x coordinates are not on the curve.
+  using BaseField = typename AffinePointTy::BaseField;
+  AffinePointTy point;
+  do {
+    compressed[20] = CompressedPoint(BaseField::Random(), /*flags=*/0);
+  } while (compressed[20].Decompress(&point));
+  EXPECT_FALSE(CompressedPoint::BatchDecompress(compressed, &points));
+}
+
+TYPED_TEST(CompressedAffinePointTest, Copyable) {
+  using AffinePointTy = TypeParam;
+  using CompressedPoint = CompressedAffinePoint<typename TypeParam::Curve>;
+
+  for (const AffinePointTy& point :
+       {AffinePointTy::Random(), AffinePointTy::Zero()}) {
+    CompressedPoint expected = CompressedPoint::From(point);
+
+    base::Uint8VectorBuffer write_buf;
+    ASSERT_TRUE(write_buf.Grow(base::EstimateSize(expected)));
+    ASSERT_TRUE(write_buf.Write(expected));
+    ASSERT_TRUE(write_buf.Done());
+    // The compressed form takes a byte more than a half of the uncompressed
+    // one, which is x, y and a byte for the point at infinity.
+    EXPECT_EQ(write_buf.buffer_len() * 2, base::EstimateSize(point) + 1);
+
+    write_buf.set_buffer_offset(0);
+
+    CompressedPoint value;
+    ASSERT_TRUE(write_buf.Read(&value));
+    EXPECT_EQ(value, expected);
+  }
+}
+
+}  // namespace tachyon::math
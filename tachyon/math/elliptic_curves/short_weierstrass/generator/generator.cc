@@ -30,10 +30,67 @@ struct GenerationConfig : public build::CcWriter {
   std::string lambda;
   std::vector<std::string> glv_coefficients;
 
+  std::string GenerateGLVDecompositionConstants() const;
   int GenerateConfigHdr() const;
   int GenerateConfigGpuHdr() const;
 };
 
+// Generates the constants used by GLV<Point>::Decompose(). Let the rows of
+// |glv_coefficients| be the lattice basis (n₁₁, n₁₂) and (n₂₁, n₂₂), and r be
+// the order of the scalar field, which is |n₁₁ * n₂₂ - n₁₂ * n₂₁|. Then
+//
+//   β₁ = k * n₂₂ / r = s₁ * ⌊k * g₁ / 2ᵐ⌋ where g₁ = round(2ᵐ * |n₂₂| / r)
+//   β₂ = -k * n₁₂ / r = s₂ * ⌊k * g₂ / 2ᵐ⌋ where g₂ = round(2ᵐ * |n₁₂| / r)
+//
+// where m is the bit size of the limbs of r. The signs s₁ and s₂ are folded
+// into the basis, which is stored in two's complement modulo 2ᵐ.
+std::string GenerationConfig::GenerateGLVDecompositionConstants() const {
+  CHECK_EQ(glv_coefficients.size(), size_t{4});
+  std::vector<mpz_class> coeffs = base::Map(
+      glv_coefficients,
+      [](const std::string& coeff) { return mpz_class(coeff, 10); });
+  mpz_class r =
+      math::gmp::GetAbs(coeffs[0] * coeffs[3] - coeffs[1] * coeffs[2]);
+  size_t limb_nums = math::gmp::GetLimbSize(r);
+  mpz_class two_to_m = mpz_class(1) << (64 * limb_nums);
+
+  mpz_class numerators[] = {coeffs[3], -coeffs[1]};
+  std::vector<std::string> rounding_factors;
+  for (size_t i = 0; i < 2; ++i) {
+    mpz_class g = (math::gmp::GetAbs(numerators[i]) * two_to_m + r / 2) / r;
+    rounding_factors.push_back(absl::Substitute(
+        "      BigInt<$0>({$1}),", limb_nums, math::MpzClassToString(g)));
+    if (math::gmp::IsNegative(numerators[i])) {
+      coeffs[2 * i] = -coeffs[2 * i];
+      coeffs[2 * i + 1] = -coeffs[2 * i + 1];
+    }
+  }
+  std::vector<std::string> decomposition_coeffs =
+      base::Map(coeffs, [limb_nums, &two_to_m](const mpz_class& coeff) {
+        mpz_class value = coeff;
+        if (math::gmp::IsNegative(value)) value += two_to_m;
+        return absl::Substitute("      BigInt<$0>({$1}),", limb_nums,
+                                math::MpzClassToString(value));
+      });
+
+  std::vector<std::string> lines = {
+      "",
+      "  // Constants for GLV<Point>::Decompose(). See",
+      "  // tachyon/math/elliptic_curves/msm/glv.h for details.",
+      absl::Substitute("  constexpr static BigInt<$0> kGLVRoundingFactors[2] "
+                       "= {",
+                       limb_nums),
+      absl::StrJoin(rounding_factors, "\n"),
+      "  };",
+      absl::Substitute("  constexpr static BigInt<$0> "
+                       "kGLVDecompositionCoeffs[4] = {",
+                       limb_nums),
+      absl::StrJoin(decomposition_coeffs, "\n"),
+      "  };",
+  };
+  return absl::StrJoin(lines, "\n");
+}
+
 int GenerationConfig::GenerateConfigHdr() const {
   std::vector<std::string_view> tpl = {
       // clang-format off
@@ -72,6 +129,7 @@ int GenerationConfig::GenerateConfigHdr() const {
       "  static BaseField kEndomorphismCoefficient;",
       "  static ScalarField kLambda;",
       "  static mpz_class kGLVCoeffs[4];",
+      "%{glv_decomposition_constants}",
       "",
       "  static void Init() {",
       "%{a_init}",
@@ -125,7 +183,7 @@ int GenerationConfig::GenerateConfigHdr() const {
       size_t idx = tpl[j].find("kEndomorphismCoefficient");
       if (idx != std::string::npos) {
         auto it = tpl.begin() + j;
-        tpl.erase(it, it + 3);
+        tpl.erase(it, it + 4);
         break;
       }
     }
@@ -246,6 +304,8 @@ int GenerationConfig::GenerateConfigHdr() const {
         endomorphism_coefficient_init;
     replacements["%{lambda_init}"] = lambda_init;
     replacements["%{glv_coeffs_init}"] = glv_coeffs_init;
+    replacements["%{glv_decomposition_constants}"] =
+        GenerateGLVDecompositionConstants();
   }
 
   std::string content = absl::StrReplaceAll(tpl_content, replacements);
@@ -119,10 +119,7 @@ class JacobianPoint<
     std::vector<BaseField> z_inverses = base::Map(
         jacobian_points, [](const JacobianPoint& point) { return point.z_; });
 #if defined(TACHYON_HAS_OPENMP)
-    size_t thread_nums = static_cast<size_t>(omp_get_max_threads());
-    if (size >=
-        size_t{1} << (thread_nums /
-                      ScalarField::kParallelBatchInverseDivisorThreshold)) {
+    if (BaseField::ShouldParallelizeBatchInverse(size)) {
       size_t chunk_size = base::GetNumElementsPerThread(jacobian_points);
       size_t num_chunks = (size + chunk_size - 1) / chunk_size;
       OPENMP_PARALLEL_FOR(size_t i = 0; i < num_chunks; ++i) {
@@ -6,6 +6,7 @@
 #include "gtest/gtest.h"
 
 #include "tachyon/base/buffer/vector_buffer.h"
+#include "tachyon/math/base/test/scoped_parallel_batch_inverse.h"
 #include "tachyon/math/elliptic_curves/short_weierstrass/affine_point.h"
 #include "tachyon/math/elliptic_curves/short_weierstrass/point_xyzz.h"
 #include "tachyon/math/elliptic_curves/short_weierstrass/projective_point.h"
@@ -168,8 +169,8 @@ TEST_F(JacobianPointTest, ToXYZZ) {
 
 #if defined(TACHYON_HAS_OPENMP)
 TEST_F(JacobianPointTest, BatchNormalize) {
-  size_t size = size_t{1} << (static_cast<size_t>(omp_get_max_threads()) /
-                              GF7::kParallelBatchInverseDivisorThreshold);
+  test::ScopedParallelBatchInverse<GF7> scoped_parallel_batch_inverse;
+  size_t size = test::kBatchInverseTestSize;
   for (size_t i = 0; i < 1; ++i) {
     // NOTE(chokobole): if i == 0 runs in parallel, otherwise runs in serial.
     std::vector<test::JacobianPoint> jacobian_points =
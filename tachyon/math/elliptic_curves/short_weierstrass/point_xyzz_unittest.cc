@@ -6,6 +6,7 @@
 #include "gtest/gtest.h"
 
 #include "tachyon/base/buffer/vector_buffer.h"
+#include "tachyon/math/base/test/scoped_parallel_batch_inverse.h"
 #include "tachyon/math/elliptic_curves/short_weierstrass/affine_point.h"
 #include "tachyon/math/elliptic_curves/short_weierstrass/jacobian_point.h"
 #include "tachyon/math/elliptic_curves/short_weierstrass/projective_point.h"
@@ -173,8 +174,8 @@ TEST_F(PointXYZZTest, ToJacobian) {
 
 #if defined(TACHYON_HAS_OPENMP)
 TEST_F(PointXYZZTest, BatchNormalize) {
-  size_t size = size_t{1} << (static_cast<size_t>(omp_get_max_threads()) /
-                              GF7::kParallelBatchInverseDivisorThreshold);
+  test::ScopedParallelBatchInverse<GF7> scoped_parallel_batch_inverse;
+  size_t size = test::kBatchInverseTestSize;
   for (size_t i = 0; i < 1; ++i) {
     // NOTE(chokobole): if i == 0 runs in parallel, otherwise runs in serial.
     std::vector<test::PointXYZZ> point_xyzzs =
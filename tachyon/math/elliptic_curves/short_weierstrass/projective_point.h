@@ -118,10 +118,7 @@ class ProjectivePoint<
         base::Map(projective_points,
                   [](const ProjectivePoint& point) { return point.z_; });
 #if defined(TACHYON_HAS_OPENMP)
-    size_t thread_nums = static_cast<size_t>(omp_get_max_threads());
-    if (size >=
-        size_t{1} << (thread_nums /
-                      ScalarField::kParallelBatchInverseDivisorThreshold)) {
+    if (BaseField::ShouldParallelizeBatchInverse(size)) {
       size_t chunk_size = base::GetNumElementsPerThread(projective_points);
       size_t num_chunks = (size + chunk_size - 1) / chunk_size;
       OPENMP_PARALLEL_FOR(size_t i = 0; i < num_chunks; ++i) {
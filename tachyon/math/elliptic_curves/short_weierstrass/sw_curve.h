@@ -64,14 +64,10 @@ class SWCurve {
   // corresponds to a curve point. Otherwise, returns false.
   constexpr static bool GetYsFromX(const BaseField& x, BaseField* even_y,
                                    BaseField* odd_y) {
-    BaseField right = x.Square() * x + Config::kB;
-    if constexpr (!Config::kAIsZero) {
-      right += Config::kA * x;
-    }
     BaseField y;
-    if (!right.SquareRoot(&y)) return false;
+    if (!ComputeYSquare(x).SquareRoot(&y)) return false;
 
-    if (y.ToBigInt().IsEven()) {
+    if (!IsOdd(y)) {
       *odd_y = -y;
       *even_y = std::move(y);
     } else {
@@ -81,6 +77,27 @@ class SWCurve {
     return true;
   }
 
+  // Returns x³ + a * x + b, which is y² if |x| is the x coordinate of a point.
+  constexpr static BaseField ComputeYSquare(const BaseField& x) {
+    BaseField right = x.Square() * x + Config::kB;
+    if constexpr (!Config::kAIsZero) {
+      right += Config::kA * x;
+    }
+    return right;
+  }
+
+  // Returns whether |y| is odd, which tells y from -y. For an element of
+  // the quadratic extension field, e.g., a coordinate of G2, the parity of c1
+  // is used unless it is zero, in which case the parity of c0 is used.
+  template <typename F>
+  constexpr static bool IsOdd(const F& y) {
+    if constexpr (F::ExtensionDegree() == 1) {
+      return y.ToBigInt().IsOdd();
+    } else {
+      return y.c1().IsZero() ? IsOdd(y.c0()) : IsOdd(y.c1());
+    }
+  }
+
   constexpr static bool IsOnCurve(const AffinePoint& point) {
     if (point.infinity()) return false;
     BaseField right = point.x().Square() * point.x() + Config::kB;
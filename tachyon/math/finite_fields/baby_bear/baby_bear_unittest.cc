@@ -0,0 +1,44 @@
+#include "gtest/gtest.h"
+
+#include "tachyon/math/finite_fields/baby_bear/baby_bear4.h"
+#include "tachyon/math/finite_fields/test/finite_field_test.h"
+
+namespace tachyon::math {
+
+namespace {
+
+class BabyBear4Test : public FiniteFieldTest<BabyBear4> {};
+
+}  // namespace
+
+TEST_F(BabyBear4Test, NonResidue) {
+  // v⁴ = u² = 11
+  BabyBear4 v(BabyBear2::Zero(), BabyBear2::One());
+  EXPECT_EQ(v.Square().Square(),
+            BabyBear4(BabyBear2(BabyBear(11), BabyBear::Zero()),
+                      BabyBear2::Zero()));
+}
+
+TEST_F(BabyBear4Test, MultiplicativeOperators) {
+  for (size_t i = 0; i < 10; ++i) {
+    BabyBear4 a = BabyBear4::Random();
+    BabyBear4 b = BabyBear4::Random();
+    EXPECT_EQ(a * b, b * a);
+    EXPECT_EQ(a.Square(), a * a);
+    EXPECT_TRUE((a * a.Inverse()).IsOne());
+    EXPECT_EQ((a * b) / b, a);
+  }
+}
+
+TEST_F(BabyBear4Test, Frobenius) {
+  BabyBear4 a = BabyBear4::Random();
+  BabyBear4 expected = a;
+  for (size_t exponent = 0; exponent < 4; ++exponent) {
+    BabyBear4 frobenius = a;
+    frobenius.FrobeniusMapInPlace(exponent);
+    EXPECT_EQ(frobenius, expected);
+    expected = expected.Pow(BabyBear::Config::kModulus);
+  }
+}
+
+}  // namespace tachyon::math
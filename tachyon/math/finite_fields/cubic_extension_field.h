@@ -12,8 +12,10 @@
 #include "absl/strings/substitute.h"
 
 #include "tachyon/base/buffer/copyable.h"
+#include "tachyon/base/cxx20_is_constant_evaluated.h"
 #include "tachyon/base/json/json.h"
 #include "tachyon/math/finite_fields/cyclotomic_multiplicative_subgroup.h"
+#include "tachyon/math/finite_fields/double_width_extension_field.h"
 #include "tachyon/math/geometry/point3.h"
 
 namespace tachyon {
@@ -208,6 +210,18 @@ class CubicExtensionField : public CyclotomicMultiplicativeSubgroup<Derived> {
     // Devegili OhEig Scott Dahab --- Multiplication and Squaring on AbstractPairing-Friendly Fields.pdf; Section 4 (Karatsuba)
     // clang-format on
 
+    if constexpr (IsDoubleWidthSupported<Derived>::value) {
+      // Reduces once per coefficient of Fp2. See
+      // double_width_extension_field.h.
+      if (!base::is_constant_evaluated()) {
+        *static_cast<Derived*>(this) =
+            DoubleWidthFp6<Derived>::Mul(*static_cast<const Derived*>(this),
+                                         other)
+                .Reduce();
+        return *static_cast<Derived*>(this);
+      }
+    }
+
     BaseField v0 = c0_ * other.c0_;
     BaseField v1 = c1_ * other.c1_;
     BaseField v2 = c2_ * other.c2_;
@@ -250,6 +264,17 @@ class CubicExtensionField : public CyclotomicMultiplicativeSubgroup<Derived> {
     // Devegili OhEig Scott Dahab --- Multiplication and Squaring on AbstractPairing-Friendly Fields.pdf; Section 4 (CH-SQR2)
     // clang-format on
 
+    if constexpr (IsDoubleWidthSupported<Derived>::value) {
+      // Reduces once per coefficient of Fp2. See
+      // double_width_extension_field.h.
+      if (!base::is_constant_evaluated()) {
+        *static_cast<Derived*>(this) =
+            DoubleWidthFp6<Derived>::Square(*static_cast<const Derived*>(this))
+                .Reduce();
+        return *static_cast<Derived*>(this);
+      }
+    }
+
     // s0 = c0²
     BaseField s0 = c0_.Square();
     // s1 = 2 * c0 * c1
@@ -84,6 +84,49 @@ class CyclotomicMultiplicativeSubgroup : public FiniteField<F> {
     }
   }
 
+  // Returns this^|exponent| with the width-|window_bits| NAF of |exponent|.
+  // This has fewer multiplications than CyclotomicPow() for a dense
+  // |exponent| at the cost of precomputing this³, this⁵, ..., this^(2ʷ⁻¹ - 1),
+  // where w is |window_bits|. See BigInt::ToWNAF().
+  template <size_t N>
+  [[nodiscard]] F CyclotomicPowWithWindow(const BigInt<N>& exponent,
+                                          uint32_t window_bits) const {
+    static_assert(internal::SupportsFastCyclotomicInverseInPlace<F>::value);
+    const F& f = *static_cast<const F*>(this);
+    if (f.IsZero()) {
+      return f;
+    }
+
+    // |powers[i]| = this^(2i + 1)
+    std::vector<F> powers(size_t{1} << (window_bits - 2));
+    powers[0] = f;
+    if (powers.size() > 1) {
+      F square = f.CyclotomicSquare();
+      for (size_t i = 1; i < powers.size(); ++i) {
+        powers[i] = powers[i - 1] * square;
+      }
+    }
+
+    std::vector<int8_t> wnaf = exponent.ToWNAF(window_bits);
+    F ret = F::One();
+    bool found_nonzero = false;
+    for (int8_t v : base::Reversed(wnaf)) {
+      if (found_nonzero) {
+        ret.CyclotomicSquareInPlace();
+      }
+
+      if (v == 0) continue;
+      found_nonzero = true;
+
+      if (v > 0) {
+        ret *= powers[v / 2];
+      } else {
+        ret *= powers[-v / 2].CyclotomicInverse();
+      }
+    }
+    return ret;
+  }
+
  private:
   // Helper function to calculate the double-and-add loop for exponentiation.
   template <typename Iterator>
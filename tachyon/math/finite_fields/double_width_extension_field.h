@@ -0,0 +1,251 @@
+#ifndef TACHYON_MATH_FINITE_FIELDS_DOUBLE_WIDTH_EXTENSION_FIELD_H_
+#define TACHYON_MATH_FINITE_FIELDS_DOUBLE_WIDTH_EXTENSION_FIELD_H_
+
+#include <stdint.h>
+
+#include <type_traits>
+#include <utility>
+
+#include "tachyon/math/finite_fields/double_width_prime_field.h"
+#include "tachyon/math/finite_fields/finite_field_forwards.h"
+
+namespace tachyon::math {
+
+// Fp2 = Fp[u] / (u² + 1), which is the case for the BN254 and the BLS12-381
+// towers.
+template <typename Config>
+struct IsDoubleWidthSupported<Fp2<Config>>
+    : std::bool_constant<
+          Config::kNonResidueIsMinusOne &&
+          IsDoubleWidthSupported<typename Config::BaseField>::value> {};
+
+// Fp6 = Fp2[v] / (v³ - ξ), where ξ = c + u for a small integer c.
+template <typename Config>
+struct IsDoubleWidthSupported<Fp6<Config>>
+    : std::bool_constant<
+          Config::kNonResidueIsSmallIntPlusU &&
+          IsDoubleWidthSupported<typename Config::BaseField>::value> {};
+
+// DoubleWidthFp2 is the unreduced counterpart of Fp2 = Fp[u] / (u² + 1) whose
+// coefficients are DoubleWidthPrimeField. See double_width_prime_field.h.
+template <typename F>
+class DoubleWidthFp2 {
+ public:
+  using BaseField = typename F::BaseField;
+  using DoubleWidthBaseField = DoubleWidthPrimeField<BaseField>;
+
+  static_assert(IsDoubleWidthSupported<F>::value);
+
+  DoubleWidthFp2() = default;
+  DoubleWidthFp2(const DoubleWidthBaseField& c0, const DoubleWidthBaseField& c1)
+      : c0_(c0), c1_(c1) {}
+
+  // Returns |a| * |b| with 3 unreduced multiplications (Karatsuba):
+  // (a₀ + a₁u)(b₀ + b₁u) = (a₀b₀ - a₁b₁) +
+  //                        ((a₀ + a₁)(b₀ + b₁) - a₀b₀ - a₁b₁)u
+  static DoubleWidthFp2 Mul(const F& a, const F& b) {
+    DoubleWidthBaseField v0 = DoubleWidthBaseField::Mul(a.c0(), b.c0());
+    DoubleWidthBaseField v1 = DoubleWidthBaseField::Mul(a.c1(), b.c1());
+    DoubleWidthBaseField c1 =
+        DoubleWidthBaseField::Mul(a.c0() + a.c1(), b.c0() + b.c1());
+    c1 -= v0;
+    c1 -= v1;
+    v0 -= v1;
+    return {v0, c1};
+  }
+
+  // Returns |a|² with 2 unreduced multiplications:
+  // (a₀ + a₁u)² = (a₀ + a₁)(a₀ - a₁) + 2a₀a₁u
+  static DoubleWidthFp2 Square(const F& a) {
+    return {DoubleWidthBaseField::Mul(a.c0() + a.c1(), a.c0() - a.c1()),
+            DoubleWidthBaseField::Mul(a.c0().Double(), a.c1())};
+  }
+
+  F Reduce() const { return F(c0_.Reduce(), c1_.Reduce()); }
+
+  DoubleWidthFp2 operator+(const DoubleWidthFp2& other) const {
+    DoubleWidthFp2 ret = *this;
+    return ret.AddInPlace(other);
+  }
+
+  DoubleWidthFp2& operator+=(const DoubleWidthFp2& other) {
+    return AddInPlace(other);
+  }
+
+  DoubleWidthFp2 operator-(const DoubleWidthFp2& other) const {
+    DoubleWidthFp2 ret = *this;
+    return ret.SubInPlace(other);
+  }
+
+  DoubleWidthFp2& operator-=(const DoubleWidthFp2& other) {
+    return SubInPlace(other);
+  }
+
+  DoubleWidthFp2& AddInPlace(const DoubleWidthFp2& other) {
+    c0_ += other.c0_;
+    c1_ += other.c1_;
+    return *this;
+  }
+
+  DoubleWidthFp2& SubInPlace(const DoubleWidthFp2& other) {
+    c0_ -= other.c0_;
+    c1_ -= other.c1_;
+    return *this;
+  }
+
+  DoubleWidthFp2& DoubleInPlace() {
+    c0_.DoubleInPlace();
+    c1_.DoubleInPlace();
+    return *this;
+  }
+
+  // Multiplies this by ξ = c + u, where c is |SmallInt|:
+  // (x₀ + x₁u)(c + u) = (cx₀ - x₁) + (x₀ + cx₁)u
+  template <uint64_t SmallInt>
+  DoubleWidthFp2& MulBySmallIntPlusUInPlace() {
+    DoubleWidthBaseField c0 = c0_;
+    c0.template MulBySmallInPlace<SmallInt>();
+    c0 -= c1_;
+    c1_.template MulBySmallInPlace<SmallInt>();
+    c1_ += c0_;
+    c0_ = std::move(c0);
+    return *this;
+  }
+
+ private:
+  DoubleWidthBaseField c0_;
+  DoubleWidthBaseField c1_;
+};
+
+// DoubleWidthFp6 is the unreduced counterpart of Fp6 = Fp2[v] / (v³ - ξ) whose
+// coefficients are DoubleWidthFp2. Each coefficient of a product is reduced
+// once, i.e., 6 Montgomery reductions per multiplication instead of 18.
+template <typename F>
+class DoubleWidthFp6 {
+ public:
+  using Config = typename F::Config;
+  using BaseField = typename F::BaseField;
+  using DoubleWidthBaseField = DoubleWidthFp2<BaseField>;
+
+  static_assert(IsDoubleWidthSupported<F>::value);
+
+  DoubleWidthFp6() = default;
+  DoubleWidthFp6(const DoubleWidthBaseField& c0, const DoubleWidthBaseField& c1,
+                 const DoubleWidthBaseField& c2)
+      : c0_(c0), c1_(c1), c2_(c2) {}
+
+  // Returns |a| * |b| with 6 unreduced multiplications (Karatsuba). See
+  // CubicExtensionField::MulInPlace().
+  static DoubleWidthFp6 Mul(const F& a, const F& b) {
+    DoubleWidthBaseField v0 = DoubleWidthBaseField::Mul(a.c0(), b.c0());
+    DoubleWidthBaseField v1 = DoubleWidthBaseField::Mul(a.c1(), b.c1());
+    DoubleWidthBaseField v2 = DoubleWidthBaseField::Mul(a.c2(), b.c2());
+    // c0 = a₀b₀ + ((a₁ + a₂)(b₁ + b₂) - a₁b₁ - a₂b₂)ξ
+    DoubleWidthBaseField c0 =
+        DoubleWidthBaseField::Mul(a.c1() + a.c2(), b.c1() + b.c2());
+    c0 -= v1;
+    c0 -= v2;
+    MulByNonResidueInPlace(&c0);
+    c0 += v0;
+    // c1 = (a₀ + a₁)(b₀ + b₁) - a₀b₀ - a₁b₁ + a₂b₂ξ
+    DoubleWidthBaseField c1 =
+        DoubleWidthBaseField::Mul(a.c0() + a.c1(), b.c0() + b.c1());
+    c1 -= v0;
+    c1 -= v1;
+    DoubleWidthBaseField v2_xi = v2;
+    MulByNonResidueInPlace(&v2_xi);
+    c1 += v2_xi;
+    // c2 = (a₀ + a₂)(b₀ + b₂) - a₀b₀ - a₂b₂ + a₁b₁
+    DoubleWidthBaseField c2 =
+        DoubleWidthBaseField::Mul(a.c0() + a.c2(), b.c0() + b.c2());
+    c2 -= v0;
+    c2 -= v2;
+    c2 += v1;
+    return {c0, c1, c2};
+  }
+
+  // Returns |a|² with 5 unreduced squarings (CH-SQR2). See
+  // CubicExtensionField::SquareInPlace().
+  static DoubleWidthFp6 Square(const F& a) {
+    // s0 = a₀²
+    DoubleWidthBaseField s0 = DoubleWidthBaseField::Square(a.c0());
+    // s1 = 2a₀a₁
+    DoubleWidthBaseField s1 =
+        DoubleWidthBaseField::Mul(a.c0().Double(), a.c1());
+    // s2 = (a₀ - a₁ + a₂)²
+    DoubleWidthBaseField s2 =
+        DoubleWidthBaseField::Square(a.c0() - a.c1() + a.c2());
+    // s3 = 2a₁a₂
+    DoubleWidthBaseField s3 =
+        DoubleWidthBaseField::Mul(a.c1().Double(), a.c2());
+    // s4 = a₂²
+    DoubleWidthBaseField s4 = DoubleWidthBaseField::Square(a.c2());
+    // c2 = s1 + s2 + s3 - s0 - s4 = a₁² + 2a₀a₂
+    DoubleWidthBaseField c2 = s1 + s2 + s3 - s0 - s4;
+    // c0 = a₀² + 2a₁a₂ξ
+    MulByNonResidueInPlace(&s3);
+    s0 += s3;
+    // c1 = 2a₀a₁ + a₂²ξ
+    MulByNonResidueInPlace(&s4);
+    s1 += s4;
+    return {s0, s1, c2};
+  }
+
+  F Reduce() const { return F(c0_.Reduce(), c1_.Reduce(), c2_.Reduce()); }
+
+  DoubleWidthFp6 operator+(const DoubleWidthFp6& other) const {
+    DoubleWidthFp6 ret = *this;
+    return ret.AddInPlace(other);
+  }
+
+  DoubleWidthFp6& operator+=(const DoubleWidthFp6& other) {
+    return AddInPlace(other);
+  }
+
+  DoubleWidthFp6 operator-(const DoubleWidthFp6& other) const {
+    DoubleWidthFp6 ret = *this;
+    return ret.SubInPlace(other);
+  }
+
+  DoubleWidthFp6& operator-=(const DoubleWidthFp6& other) {
+    return SubInPlace(other);
+  }
+
+  DoubleWidthFp6& AddInPlace(const DoubleWidthFp6& other) {
+    c0_ += other.c0_;
+    c1_ += other.c1_;
+    c2_ += other.c2_;
+    return *this;
+  }
+
+  DoubleWidthFp6& SubInPlace(const DoubleWidthFp6& other) {
+    c0_ -= other.c0_;
+    c1_ -= other.c1_;
+    c2_ -= other.c2_;
+    return *this;
+  }
+
+  // Multiplies this by v, which is the non-residue of Fp12 = Fp6[w] / (w² - v):
+  // (x₀ + x₁v + x₂v²)v = x₂ξ + x₀v + x₁v²
+  DoubleWidthFp6& MulByVInPlace() {
+    MulByNonResidueInPlace(&c2_);
+    DoubleWidthBaseField c0 = std::move(c2_);
+    c2_ = std::move(c1_);
+    c1_ = std::move(c0_);
+    c0_ = std::move(c0);
+    return *this;
+  }
+
+ private:
+  static void MulByNonResidueInPlace(DoubleWidthBaseField* v) {
+    v->template MulBySmallIntPlusUInPlace<Config::kNonResidueSmallInt>();
+  }
+
+  DoubleWidthBaseField c0_;
+  DoubleWidthBaseField c1_;
+  DoubleWidthBaseField c2_;
+};
+
+}  // namespace tachyon::math
+
+#endif  // TACHYON_MATH_FINITE_FIELDS_DOUBLE_WIDTH_EXTENSION_FIELD_H_
@@ -0,0 +1,135 @@
+#include "tachyon/math/finite_fields/double_width_extension_field.h"
+
+#include "gtest/gtest.h"
+
+#include "tachyon/math/elliptic_curves/bls12/bls12_381/fq12.h"
+#include "tachyon/math/elliptic_curves/bn/bn254/fq12.h"
+#include "tachyon/math/finite_fields/test/finite_field_test.h"
+
+namespace tachyon::math {
+
+namespace {
+
+template <typename Fp12>
+class DoubleWidthExtensionFieldTest : public FiniteFieldTest<Fp12> {
+ public:
+  using Fp6 = typename Fp12::BaseField;
+  using Fp2 = typename Fp6::BaseField;
+  using F = typename Fp2::BaseField;
+
+  constexpr static size_t kTestNum = 100;
+
+  // The schoolbook multiplications below only use the multiplication of the
+  // base field, so that they don't depend on the lazy reduction of this
+  // extension field.
+  static Fp2 MulFp2(const Fp2& a, const Fp2& b) {
+    return Fp2(a.c0() * b.c0() - a.c1() * b.c1(),
+               a.c0() * b.c1() + a.c1() * b.c0());
+  }
+
+  static Fp6 MulFp6(const Fp6& a, const Fp6& b) {
+    using Config = typename Fp6::Config;
+    Fp2 c0 = MulFp2(a.c0(), b.c0()) +
+             Config::MulByNonResidue(MulFp2(a.c1(), b.c2()) +
+                                     MulFp2(a.c2(), b.c1()));
+    Fp2 c1 = MulFp2(a.c0(), b.c1()) + MulFp2(a.c1(), b.c0()) +
+             Config::MulByNonResidue(MulFp2(a.c2(), b.c2()));
+    Fp2 c2 = MulFp2(a.c0(), b.c2()) + MulFp2(a.c1(), b.c1()) +
+             MulFp2(a.c2(), b.c0());
+    return Fp6(c0, c1, c2);
+  }
+
+  static Fp12 MulFp12(const Fp12& a, const Fp12& b) {
+    using Config = typename Fp12::Config;
+    Fp6 c0 = MulFp6(a.c0(), b.c0()) +
+             Config::MulByNonResidue(MulFp6(a.c1(), b.c1()));
+    Fp6 c1 = MulFp6(a.c0(), b.c1()) + MulFp6(a.c1(), b.c0());
+    return Fp12(c0, c1);
+  }
+};
+
+}  // namespace
+
+using Fp12Types = testing::Types<bn254::Fq12, bls12_381::Fq12>;
+TYPED_TEST_SUITE(DoubleWidthExtensionFieldTest, Fp12Types);
+
+TYPED_TEST(DoubleWidthExtensionFieldTest, IsDoubleWidthSupported) {
+  using Fp12 = TypeParam;
+  using Fp6 = typename Fp12::BaseField;
+  using Fp2 = typename Fp6::BaseField;
+  using F = typename Fp2::BaseField;
+
+  EXPECT_TRUE(IsDoubleWidthSupported<F>::value);
+  EXPECT_TRUE(IsDoubleWidthSupported<Fp2>::value);
+  EXPECT_TRUE(IsDoubleWidthSupported<Fp6>::value);
+  EXPECT_FALSE(IsDoubleWidthSupported<Fp12>::value);
+  // Fp12::MulInPlace() takes the lazy reduction only with this.
+  EXPECT_TRUE(Fp12::Config::kNonResidueIsV);
+}
+
+TYPED_TEST(DoubleWidthExtensionFieldTest, PrimeFieldArithmetic) {
+  using F = typename TestFixture::F;
+  using DoubleWidthF = DoubleWidthPrimeField<F>;
+
+  // The largest elements exercise the carries and the borrows.
+  const F minus_one = -F::One();
+  EXPECT_EQ(DoubleWidthF::Mul(minus_one, minus_one).Reduce(), F::One());
+  EXPECT_EQ((DoubleWidthF::Mul(minus_one, minus_one) +
+             DoubleWidthF::Mul(minus_one, minus_one))
+                .Reduce(),
+            F(2));
+  EXPECT_TRUE((DoubleWidthF::Mul(minus_one, minus_one) -
+               DoubleWidthF::Mul(F::One(), F::One()))
+                  .Reduce()
+                  .IsZero());
+
+  for (size_t i = 0; i < TestFixture::kTestNum; ++i) {
+    F a[] = {F::Random(), F::Random(), F::Random()};
+    F b[] = {F::Random(), F::Random(), F::Random()};
+    DoubleWidthF v = DoubleWidthF::Mul(a[0], b[0]);
+    v -= DoubleWidthF::Mul(a[1], b[1]);
+    v += DoubleWidthF::Mul(a[2], b[2]);
+    EXPECT_EQ(v.Reduce(), a[0] * b[0] - a[1] * b[1] + a[2] * b[2]);
+    EXPECT_EQ((-v).Reduce(), -(a[0] * b[0] - a[1] * b[1] + a[2] * b[2]));
+    EXPECT_EQ(v.template MulBySmallInPlace<9>().Reduce(),
+              (a[0] * b[0] - a[1] * b[1] + a[2] * b[2]) * F(9));
+  }
+}
+
+TYPED_TEST(DoubleWidthExtensionFieldTest, Mul) {
+  using Fp12 = TypeParam;
+  using Fp6 = typename TestFixture::Fp6;
+  using Fp2 = typename TestFixture::Fp2;
+
+  for (size_t i = 0; i < TestFixture::kTestNum; ++i) {
+    Fp2 a2 = Fp2::Random();
+    Fp2 b2 = Fp2::Random();
+    EXPECT_EQ(a2 * b2, TestFixture::MulFp2(a2, b2));
+    EXPECT_EQ(a2.Square(), TestFixture::MulFp2(a2, a2));
+
+    Fp6 a6 = Fp6::Random();
+    Fp6 b6 = Fp6::Random();
+    EXPECT_EQ(a6 * b6, TestFixture::MulFp6(a6, b6));
+    EXPECT_EQ(a6.Square(), TestFixture::MulFp6(a6, a6));
+
+    Fp12 a12 = Fp12::Random();
+    Fp12 b12 = Fp12::Random();
+    EXPECT_EQ(a12 * b12, TestFixture::MulFp12(a12, b12));
+    EXPECT_EQ(a12.Square(), TestFixture::MulFp12(a12, a12));
+  }
+}
+
+TYPED_TEST(DoubleWidthExtensionFieldTest, MulWithLargestElements) {
+  using Fp6 = typename TestFixture::Fp6;
+  using Fp2 = typename TestFixture::Fp2;
+  using F = typename TestFixture::F;
+
+  const F minus_one = -F::One();
+  const Fp2 a2(minus_one, minus_one);
+  const Fp6 a6(a2, a2, a2);
+  EXPECT_EQ(a2 * a2, TestFixture::MulFp2(a2, a2));
+  EXPECT_EQ(a6 * a6, TestFixture::MulFp6(a6, a6));
+  EXPECT_EQ(a6.Square(), TestFixture::MulFp6(a6, a6));
+}
+
+}  // namespace tachyon::math
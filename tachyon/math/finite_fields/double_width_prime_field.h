@@ -0,0 +1,200 @@
+#ifndef TACHYON_MATH_FINITE_FIELDS_DOUBLE_WIDTH_PRIME_FIELD_H_
+#define TACHYON_MATH_FINITE_FIELDS_DOUBLE_WIDTH_PRIME_FIELD_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <type_traits>
+#include <utility>
+
+#include "tachyon/base/compiler_specific.h"
+#include "tachyon/math/base/arithmetics.h"
+#include "tachyon/math/base/big_int.h"
+#include "tachyon/math/finite_fields/finite_field_forwards.h"
+
+namespace tachyon::math {
+
+// Returns whether |F| supports DoubleWidthPrimeField<F>. The special primes,
+// e.g., Goldilocks and BabyBear, have their own reductions.
+template <typename F>
+struct IsDoubleWidthSupported : std::false_type {};
+
+template <typename Config>
+struct IsDoubleWidthSupported<PrimeField<Config>>
+    : std::bool_constant<!Config::kIsSpecialPrime> {};
+
+// DoubleWidthPrimeField holds an unreduced product of the elements of a prime
+// field |F| in Montgomery form. The product aR * bR of aR and bR is kept in 2N
+// limbs, and the sums and the differences of the products are computed modulo
+// pR, where R = 2⁶⁴ᴺ. Since the lower N limbs of pR are zero, it only touches
+// the upper N limbs. As the value is always less than pR, Reduce() returns
+// abR with a single Montgomery reduction. This way, a sum of products such as
+// a₀b₀ - a₁b₁ is reduced once instead of once per product.
+template <typename F>
+class DoubleWidthPrimeField {
+ public:
+  using Config = typename F::Config;
+
+  constexpr static size_t N = F::N;
+
+  DoubleWidthPrimeField() = default;
+
+  // Returns |a| * |b| without the Montgomery reduction.
+  static DoubleWidthPrimeField Mul(const F& a, const F& b) {
+    DoubleWidthPrimeField ret;
+    if constexpr (Config::kHasAsmMontgomery) {
+      if (F::CanUseAsmMontgomery()) {
+        Config::AsmMul(a.value_.limbs, b.value_.limbs, ret.value_.limbs);
+        return ret;
+      }
+    }
+    ret.value_ = a.value_.Mul(b.value_);
+    return ret;
+  }
+
+  static DoubleWidthPrimeField Square(const F& a) { return Mul(a, a); }
+
+  // Returns the element represented by this, i.e., this * R⁻¹ mod p.
+  F Reduce() const {
+    F ret;
+    if constexpr (Config::kHasAsmMontgomery) {
+      if (F::CanUseAsmMontgomery()) {
+        Config::AsmMontgomeryReduce(value_.limbs, ret.value_.limbs);
+        return ret;
+      }
+    }
+    BigInt<2 * N> r = value_;
+    BigInt<N>::template MontgomeryReduce64<Config::kModulusHasSpareBit>(
+        r, Config::kModulus, Config::kInverse64, &ret.value_);
+    return ret;
+  }
+
+  DoubleWidthPrimeField operator+(const DoubleWidthPrimeField& other) const {
+    DoubleWidthPrimeField ret = *this;
+    return ret.AddInPlace(other);
+  }
+
+  DoubleWidthPrimeField& operator+=(const DoubleWidthPrimeField& other) {
+    return AddInPlace(other);
+  }
+
+  DoubleWidthPrimeField operator-(const DoubleWidthPrimeField& other) const {
+    DoubleWidthPrimeField ret = *this;
+    return ret.SubInPlace(other);
+  }
+
+  DoubleWidthPrimeField& operator-=(const DoubleWidthPrimeField& other) {
+    return SubInPlace(other);
+  }
+
+  DoubleWidthPrimeField operator-() const {
+    DoubleWidthPrimeField ret = *this;
+    return ret.NegInPlace();
+  }
+
+  DoubleWidthPrimeField& AddInPlace(const DoubleWidthPrimeField& other) {
+    uint64_t carry = AddLimbs(value_.limbs, other.value_.limbs, value_.limbs,
+                              std::make_index_sequence<2 * N>());
+    // The sum is less than 2pR. If it is not less than pR, subtracts pR from
+    // it. This is done without a branch, since the carries of the random
+    // values are unpredictable.
+    uint64_t unused[N];
+    uint64_t borrow = SubLimbs(&value_.limbs[N], Config::kModulus.limbs, unused,
+                               std::make_index_sequence<N>());
+    SubModulusIf(carry | (borrow ^ 1));
+    return *this;
+  }
+
+  DoubleWidthPrimeField& DoubleInPlace() { return AddInPlace(*this); }
+
+  DoubleWidthPrimeField& SubInPlace(const DoubleWidthPrimeField& other) {
+    uint64_t borrow = SubLimbs(value_.limbs, other.value_.limbs, value_.limbs,
+                               std::make_index_sequence<2 * N>());
+    // The difference is greater than -pR. If it is negative, adds pR to it.
+    AddModulusIf(borrow);
+    return *this;
+  }
+
+  DoubleWidthPrimeField& NegInPlace() {
+    DoubleWidthPrimeField zero;
+    *this = zero.SubInPlace(*this);
+    return *this;
+  }
+
+  // Multiplies this by a small constant |Scalar| with the additions.
+  template <uint64_t Scalar>
+  DoubleWidthPrimeField& MulBySmallInPlace() {
+    static_assert(Scalar > 0);
+    if constexpr (Scalar == 1) {
+      return *this;
+    } else if constexpr (Scalar % 2 == 0) {
+      MulBySmallInPlace<Scalar / 2>();
+      return DoubleInPlace();
+    } else {
+      DoubleWidthPrimeField value = *this;
+      MulBySmallInPlace<Scalar - 1>();
+      return AddInPlace(value);
+    }
+  }
+
+ private:
+  // The carry chains are unrolled with the fold expressions. Otherwise, the
+  // compiler keeps the loops over the limbs and spills the carries.
+  template <size_t... Is>
+  static uint64_t AddLimbs(const uint64_t* a, const uint64_t* b, uint64_t* c,
+                           std::index_sequence<Is...>) {
+    uint64_t carry = 0;
+    ((carry = AddLimb(a[Is], b[Is], carry, &c[Is])), ...);
+    return carry;
+  }
+
+  template <size_t... Is>
+  static uint64_t SubLimbs(const uint64_t* a, const uint64_t* b, uint64_t* c,
+                           std::index_sequence<Is...>) {
+    uint64_t borrow = 0;
+    ((borrow = SubLimb(a[Is], b[Is], borrow, &c[Is])), ...);
+    return borrow;
+  }
+
+  // Adds pR to this if |condition| is 1.
+  void AddModulusIf(uint64_t condition) {
+    uint64_t mask = uint64_t{0} - condition;
+    uint64_t modulus[N];
+    for (size_t i = 0; i < N; ++i) {
+      modulus[i] = Config::kModulus.limbs[i] & mask;
+    }
+    AddLimbs(&value_.limbs[N], modulus, &value_.limbs[N],
+             std::make_index_sequence<N>());
+  }
+
+  // Subtracts pR from this if |condition| is 1.
+  void SubModulusIf(uint64_t condition) {
+    uint64_t mask = uint64_t{0} - condition;
+    uint64_t modulus[N];
+    for (size_t i = 0; i < N; ++i) {
+      modulus[i] = Config::kModulus.limbs[i] & mask;
+    }
+    SubLimbs(&value_.limbs[N], modulus, &value_.limbs[N],
+             std::make_index_sequence<N>());
+  }
+
+  ALWAYS_INLINE static uint64_t AddLimb(uint64_t a, uint64_t b, uint64_t carry,
+                                        uint64_t* c) {
+    AddResult<uint64_t> result = internal::u64::AddWithCarry(a, b, carry);
+    *c = result.result;
+    return result.carry;
+  }
+
+  ALWAYS_INLINE static uint64_t SubLimb(uint64_t a, uint64_t b,
+                                        uint64_t borrow, uint64_t* c) {
+    SubResult<uint64_t> result = internal::u64::SubWithBorrow(a, b, borrow);
+    *c = result.result;
+    return result.borrow;
+  }
+
+  BigInt<2 * N> value_;
+};
+
+}  // namespace tachyon::math
+
+#endif  // TACHYON_MATH_FINITE_FIELDS_DOUBLE_WIDTH_PRIME_FIELD_H_
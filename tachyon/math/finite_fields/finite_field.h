@@ -1,8 +1,18 @@
 #ifndef TACHYON_MATH_FINITE_FIELDS_FINITE_FIELD_H_
 #define TACHYON_MATH_FINITE_FIELDS_FINITE_FIELD_H_
 
+#include <stddef.h>
+
+#include <algorithm>
+#include <vector>
+
+#include "absl/types/span.h"
+
+#include "tachyon/base/logging.h"
+#include "tachyon/base/parallelize.h"
 #include "tachyon/math/base/field.h"
 #include "tachyon/math/finite_fields/finite_field_traits.h"
+#include "tachyon/math/finite_fields/square_root_algorithms/sarkar.h"
 #include "tachyon/math/finite_fields/square_root_algorithms/shanks.h"
 #include "tachyon/math/finite_fields/square_root_algorithms/tonelli_shanks.h"
 
@@ -23,6 +33,8 @@ class FiniteField : public Field<F> {
   constexpr bool SquareRoot(F* ret) const {
     if constexpr (Config::kModulusModFourIsThree) {
       return ComputeShanksSquareRoot(*static_cast<const F*>(this), ret);
+    } else if constexpr (Config::kHasSquareRootTable) {
+      return ComputeSarkarSquareRoot(*static_cast<const F*>(this), ret);
     } else {
       static_assert(Config::kHasTwoAdicRootOfUnity);
       return ComputeTonelliShanksSquareRoot(
@@ -31,6 +43,39 @@ class FiniteField : public Field<F> {
     }
     return false;
   }
+
+  // Computes the square roots of |values| into |roots| in parallel. This is
+  // useful for decompressing a batch of points or hashing a batch of messages
+  // to a curve. Returns false if the sizes do not match or any of |values| is
+  // a quadratic non-residue, in which case the corresponding root is left
+  // unchanged.
+  template <typename InputContainer, typename OutputContainer>
+  [[nodiscard]] static bool BatchSquareRoot(const InputContainer& values,
+                                            OutputContainer* roots) {
+    size_t size = std::size(values);
+    if (size != std::size(*roots)) {
+      LOG(ERROR) << "Size of |values| and |roots| do not match";
+      return false;
+    }
+    absl::Span<const F> values_span(std::data(values), size);
+    absl::Span<F> roots_span(std::data(*roots), size);
+    // NOTE: The number of non-residues is returned per chunk instead of a bool,
+    // since writing to a std::vector<bool> in parallel is a data race.
+    std::vector<size_t> non_residue_nums = base::ParallelizeMap(
+        roots_span, [values_span](absl::Span<F> chunk, size_t chunk_idx,
+                                  size_t chunk_size) {
+          size_t begin = chunk_idx * chunk_size;
+          size_t non_residue_num = 0;
+          for (size_t i = 0; i < chunk.size(); ++i) {
+            if (!values_span[begin + i].SquareRoot(&chunk[i])) {
+              ++non_residue_num;
+            }
+          }
+          return non_residue_num;
+        });
+    return std::all_of(non_residue_nums.begin(), non_residue_nums.end(),
+                       [](size_t num) { return num == 0; });
+  }
 };
 
 }  // namespace tachyon::math
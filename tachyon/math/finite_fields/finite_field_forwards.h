@@ -21,6 +21,9 @@ class Fp3;
 template <typename Config>
 class Fp4;
 
+template <typename Config>
+class Fp5;
+
 template <typename Config, typename SFINAE = void>
 class Fp6;
 
@@ -59,6 +59,14 @@ struct FiniteFieldTraits<Fp4<_Config>> {
   using Config = _Config;
 };
 
+template <typename _Config>
+struct FiniteFieldTraits<Fp5<_Config>> {
+  static constexpr bool kIsPrimeField = false;
+  static constexpr bool kIsExtensionField = true;
+
+  using Config = _Config;
+};
+
 template <typename _Config>
 struct FiniteFieldTraits<Fp6<_Config>> {
   static constexpr bool kIsPrimeField = false;
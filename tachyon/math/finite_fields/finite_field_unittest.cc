@@ -1,7 +1,10 @@
+#include <vector>
+
 #include "gtest/gtest.h"
 
 #include "tachyon/math/elliptic_curves/bn/bn254/fq.h"
 #include "tachyon/math/elliptic_curves/bn/bn254/fr.h"
+#include "tachyon/math/finite_fields/baby_bear/baby_bear.h"
 
 namespace tachyon::math {
 
@@ -14,7 +17,7 @@ class FiniteFieldTest : public testing::Test {
 
 }  // namespace
 
-using PrimeFieldTypes = testing::Types<bn254::Fq, bn254::Fr>;
+using PrimeFieldTypes = testing::Types<bn254::Fq, bn254::Fr, BabyBear>;
 
 TYPED_TEST_SUITE(FiniteFieldTest, PrimeFieldTypes);
 
@@ -40,4 +43,70 @@ TYPED_TEST(FiniteFieldTest, SquareRoot) {
   EXPECT_TRUE(success);
 }
 
+TYPED_TEST(FiniteFieldTest, SquareRootOfSquare) {
+  using F = TypeParam;
+
+  for (size_t i = 0; i < 100; ++i) {
+    F f = F::Random();
+    F sqrt;
+    ASSERT_TRUE(f.Square().SquareRoot(&sqrt));
+    EXPECT_TRUE(sqrt == f || sqrt == -f);
+  }
+}
+
+TYPED_TEST(FiniteFieldTest, BatchSquareRoot) {
+  using F = TypeParam;
+
+  std::vector<F> values = {F::Zero(), F::One()};
+  for (size_t i = 0; i < 100; ++i) {
+    values.push_back(F::Random().Square());
+  }
+  std::vector<F> roots(values.size());
+  ASSERT_TRUE(F::BatchSquareRoot(values, &roots));
+  for (size_t i = 0; i < values.size(); ++i) {
+    EXPECT_EQ(roots[i].Square(), values[i]);
+  }
+
+  F non_residue = F::Random();
+  while (non_residue.Legendre() != LegendreSymbol::kMinusOne) {
+    non_residue = F::Random();
+  }
+  values.push_back(non_residue);
+  roots.push_back(F::Zero());
+  EXPECT_FALSE(F::BatchSquareRoot(values, &roots));
+
+  roots.pop_back();
+  EXPECT_FALSE(F::BatchSquareRoot(values, &roots));
+}
+
+TEST(SarkarSquareRootTest, AgreesWithTonelliShanks) {
+  using F = bn254::Fr;
+  F::Init();
+  static_assert(F::Config::kHasSquareRootTable);
+
+  F g = F::FromMontgomery(F::Config::kTwoAdicRootOfUnity);
+  std::vector<F> values;
+  // The 2ˢ-th roots of unity exercise every window of the discrete logarithm.
+  for (size_t i = 0; i < 50; ++i) {
+    values.push_back(g.Pow(F::Random().ToBigInt()[0]));
+    values.push_back(F::Random());
+  }
+  for (const F& value : values) {
+    F sarkar_sqrt;
+    F tonelli_shanks_sqrt;
+    bool sarkar_success = ComputeSarkarSquareRoot(value, &sarkar_sqrt);
+    ASSERT_EQ(sarkar_success,
+              ComputeTonelliShanksSquareRoot(
+                  value, F::FromMontgomery(F::Config::kTwoAdicRootOfUnity),
+                  &tonelli_shanks_sqrt));
+    if (sarkar_success) {
+      EXPECT_EQ(sarkar_sqrt.Square(), value);
+      EXPECT_TRUE(sarkar_sqrt == tonelli_shanks_sqrt ||
+                  sarkar_sqrt == -tonelli_shanks_sqrt);
+    } else {
+      EXPECT_EQ(value.Legendre(), LegendreSymbol::kMinusOne);
+    }
+  }
+}
+
 }  // namespace tachyon::math
@@ -7,8 +7,11 @@
 #define TACHYON_MATH_FINITE_FIELDS_FP12_H_
 
 #include <utility>
+#include <vector>
 
+#include "tachyon/base/logging.h"
 #include "tachyon/math/base/gmp/gmp_util.h"
+#include "tachyon/math/finite_fields/double_width_extension_field.h"
 #include "tachyon/math/finite_fields/quadratic_extension_field.h"
 
 namespace tachyon::math {
@@ -151,35 +154,20 @@ class Fp12 final : public QuadraticExtensionField<Fp12<Config>> {
       // a² = (α₀ + α₄x)² = α₀² + 2α₀α₄x + α₄²x²
       //                  = α₀² + α₄²q + 2α₀α₄x (where q = x²)
       //                  = t₀ + t₁x
-      Fp2 tmp = a0 * a4;
-      // t₀ = (α₀ + α₄) * (α₀ + α₄q) - α₀α₄ - α₀α₄x
-      //    = α₀² + α₄²q
-      Fp2 t0 = (a0 + a4) * (a0 + Fp6::Config::MulByNonResidue(a4)) - tmp -
-               Fp6::Config::MulByNonResidue(tmp);
-      // t₁ = 2α₀α₄
-      Fp2 t1 = tmp.Double();
+      Fp2 t0, t1;
+      SquareFp4(a0, a4, &t0, &t1);
 
       // b² = (α₃ + α₂x)² = α₃² + 2α₂α₃x + α₂²x²
       //                  = α₃² + α₂²q + 2α₂α₃x (where q = x²)
       //                  = t₂ + t₃x
-      tmp = a3 * a2;
-      // t₂ = (α₃ + α₂) * (α₃ + α₂q) - α₂α₃ - α₂α₃x
-      //    = α₃² + α₂²q
-      Fp2 t2 = (a3 + a2) * (a3 + Fp6::Config::MulByNonResidue(a2)) - tmp -
-               Fp6::Config::MulByNonResidue(tmp);
-      // t₃ = 2α₂α₃
-      Fp2 t3 = tmp.Double();
+      Fp2 t2, t3;
+      SquareFp4(a3, a2, &t2, &t3);
 
       // c² = (α₁ + α₅x)² = α₁² + 2α₁α₅x + α₅²x²
       //                  = α₁² + α₅²q + 2α₁α₅x (where q = x²)
       //                  = t₄ + t₅x
-      tmp = a1 * a5;
-      // t₄ = (α₁ + α₅) * (α₁ + α₅q) - α₁α₅ - α₁α₅x
-      //    = α₁² + α₅²q
-      Fp2 t4 = (a1 + a5) * (a1 + Fp6::Config::MulByNonResidue(a5)) - tmp -
-               Fp6::Config::MulByNonResidue(tmp);
-      // t₅ = 2α₁α₅
-      Fp2 t5 = tmp.Double();
+      Fp2 t4, t5;
+      SquareFp4(a1, a5, &t4, &t5);
 
       Fp2& z0 = this->c0_.c0_;
       Fp2& z4 = this->c0_.c1_;
@@ -206,7 +194,7 @@ class Fp12 final : public QuadraticExtensionField<Fp12<Config>> {
 
       // z₂ = 3 * (q * t₅) + 2 * z₂
       //    = 2 * (z₂ + q * t₅) + q * t₅
-      tmp = Fp6::Config::MulByNonResidue(t5);
+      Fp2 tmp = Fp6::Config::MulByNonResidue(t5);
       z2 += tmp;
       z2.DoubleInPlace();
       z2 += tmp;
@@ -237,6 +225,111 @@ class Fp12 final : public QuadraticExtensionField<Fp12<Config>> {
     }
   }
 
+  // Squares this in the compressed form of Karabina, i.e., only α₁, α₂, α₃
+  // and α₅ of α = (α₀ + α₁x + α₂x² + (α₃ + α₄x + α₅x²)y) are used and updated.
+  // This costs 2 squarings in Fp4, while FastCyclotomicSquareInPlace() costs 3
+  // squarings in Fp4. α₀ and α₄ are recovered with
+  // DecompressCyclotomicInPlace() or BatchDecompressCyclotomicInPlace(). This
+  // must be in the cyclotomic subgroup.
+  // See https://eprint.iacr.org/2010/542.pdf (theorem 3.2)
+  Fp12& CompressedCyclotomicSquareInPlace() {
+    Fp2& a1 = this->c0_.c1_;
+    Fp2& a2 = this->c0_.c2_;
+    Fp2& a3 = this->c1_.c0_;
+    Fp2& a5 = this->c1_.c2_;
+
+    // (α₃ + α₂x)² = s₀ + t₁x, where s₀ = α₃² + α₂²q and t₁ = 2α₂α₃
+    Fp2 s0, t1;
+    SquareFp4(a3, a2, &s0, &t1);
+    // (α₁ + α₅x)² = s₁ + t₀x, where s₁ = α₁² + α₅²q and t₀ = 2α₁α₅
+    Fp2 s1, t0;
+    SquareFp4(a1, a5, &s1, &t0);
+    // t₀ = 2α₁α₅q
+    t0 = Fp6::Config::MulByNonResidue(t0);
+
+    // α₁' = 3s₀ - 2α₁
+    a1 = s0 - a1;
+    a1.DoubleInPlace();
+    a1 += s0;
+    // α₂' = 3s₁ - 2α₂
+    a2 = s1 - a2;
+    a2.DoubleInPlace();
+    a2 += s1;
+    // α₃' = 3t₀ + 2α₃
+    a3 += t0;
+    a3.DoubleInPlace();
+    a3 += t0;
+    // α₅' = 3t₁ + 2α₅
+    a5 += t1;
+    a5.DoubleInPlace();
+    a5 += t1;
+    return *this;
+  }
+
+  // Recovers α₀ and α₄ of the compressed form of Karabina. See
+  // CompressedCyclotomicSquareInPlace().
+  Fp12& DecompressCyclotomicInPlace() {
+    Fp2 numerator;
+    Fp2 denominator;
+    if (!ComputeDecompressionFraction(&numerator, &denominator)) {
+      return *this = Fp12::One();
+    }
+    denominator.InverseInPlace();
+    return FinishDecompression(numerator * denominator);
+  }
+
+  // Recovers α₀ and α₄ of each of the compressed forms of Karabina with a
+  // single inversion. See CompressedCyclotomicSquareInPlace().
+  template <typename Container>
+  static void BatchDecompressCyclotomicInPlace(Container* values) {
+    size_t size = std::size(*values);
+    std::vector<Fp2> numerators(size);
+    std::vector<Fp2> denominators(size);
+    for (size_t i = 0; i < size; ++i) {
+      if (!(*values)[i].ComputeDecompressionFraction(&numerators[i],
+                                                     &denominators[i])) {
+        (*values)[i] = Fp12::One();
+        // NOTE: The zero is skipped by the batch inversion.
+        denominators[i] = Fp2::Zero();
+      }
+    }
+    CHECK(Fp2::BatchInverseInPlaceSerial(denominators));
+    for (size_t i = 0; i < size; ++i) {
+      if (denominators[i].IsZero()) continue;
+      (*values)[i].FinishDecompression(numerators[i] * denominators[i]);
+    }
+  }
+
+  // Returns this^|exponent| for this in the cyclotomic subgroup. The squarings
+  // run in the compressed form, and this^(2ⁱ) for each nonzero digit i of the
+  // NAF of |exponent| is decompressed at once. This pays off over
+  // CyclotomicPow() when the digits are sparse, so that the decompressions are
+  // amortized over the long runs of squarings.
+  template <size_t N>
+  Fp12 CompressedCyclotomicPow(const BigInt<N>& exponent) const {
+    std::vector<int8_t> naf = exponent.ToNAF();
+    std::vector<Fp12> powers;
+    std::vector<int8_t> digits;
+    Fp12 power = *this;
+    for (size_t i = 0; i < naf.size(); ++i) {
+      if (i != 0) power.CompressedCyclotomicSquareInPlace();
+      if (naf[i] != 0) {
+        powers.push_back(power);
+        digits.push_back(naf[i]);
+      }
+    }
+    BatchDecompressCyclotomicInPlace(&powers);
+    Fp12 ret = Fp12::One();
+    for (size_t i = 0; i < powers.size(); ++i) {
+      if (digits[i] > 0) {
+        ret *= powers[i];
+      } else {
+        ret *= powers[i].CyclotomicInverseInPlace();
+      }
+    }
+    return ret;
+  }
+
   // Return α = (α₀', α₁', α₂', α₃', α₄', α₅'), such that
   // α = (α₀ + α₁x + α₂x² + (α₃ + α₄x + α₅x²)y) * (β₀ + β₃y + β₄xy)
   Fp12& MulInPlaceBy034(const Fp2& beta0, const Fp2& beta3, const Fp2& beta4) {
@@ -346,6 +439,71 @@ class Fp12 final : public QuadraticExtensionField<Fp12<Config>> {
     this->c0_ += a;
     return *this;
   }
+
+ private:
+  // Computes (|a| + |b|z)² = |c0| + |c1|z, where z² = q and q is the
+  // non-residue of Fp6 = Fp2[x] / (x³ - q).
+  static void SquareFp4(const Fp2& a, const Fp2& b, Fp2* c0, Fp2* c1) {
+    if constexpr (IsDoubleWidthSupported<Fp6>::value) {
+      // c₀ = a² + b²q and c₁ = 2ab are reduced once. See
+      // double_width_extension_field.h.
+      using DoubleWidthF2 = DoubleWidthFp2<Fp2>;
+      DoubleWidthF2 b_square = DoubleWidthF2::Square(b);
+      b_square.template MulBySmallIntPlusUInPlace<
+          Fp6::Config::kNonResidueSmallInt>();
+      *c0 = (DoubleWidthF2::Square(a) + b_square).Reduce();
+      *c1 = DoubleWidthF2::Mul(a.Double(), b).Reduce();
+    } else {
+      Fp2 tmp = a * b;
+      // c₀ = (a + b) * (a + bq) - ab - abq
+      //    = a² + b²q
+      *c0 = (a + b) * (a + Fp6::Config::MulByNonResidue(b)) - tmp -
+            Fp6::Config::MulByNonResidue(tmp);
+      // c₁ = 2ab
+      *c1 = tmp.Double();
+    }
+  }
+
+  // Computes α₄ = |numerator| / |denominator| of the compressed form of
+  // Karabina. Returns false if this is the compressed form of one.
+  bool ComputeDecompressionFraction(Fp2* numerator, Fp2* denominator) const {
+    const Fp2& a1 = this->c0_.c1_;
+    const Fp2& a2 = this->c0_.c2_;
+    const Fp2& a3 = this->c1_.c0_;
+    const Fp2& a5 = this->c1_.c2_;
+    if (a3.IsZero()) {
+      // α₄ = 2α₁α₅ / α₂
+      if (a2.IsZero()) return false;
+      *numerator = (a1 * a5).Double();
+      *denominator = a2;
+    } else {
+      // α₄ = (α₅²q + 3α₁² - 2α₂) / 4α₃, where q = x³
+      Fp2 a1_square = a1.Square();
+      *numerator = a1_square - a2;
+      numerator->DoubleInPlace();
+      *numerator += a1_square;
+      *numerator += Fp6::Config::MulByNonResidue(a5.Square());
+      *denominator = a3.Double().Double();
+    }
+    return true;
+  }
+
+  // Sets α₄ to |a4| and recovers α₀ = (2α₄² + α₃α₅ - 3α₁α₂)q + 1, where
+  // q = x³.
+  Fp12& FinishDecompression(const Fp2& a4) {
+    const Fp2& a1 = this->c0_.c1_;
+    const Fp2& a2 = this->c0_.c2_;
+    const Fp2& a3 = this->c1_.c0_;
+    const Fp2& a5 = this->c1_.c2_;
+    Fp2 a1_a2 = a1 * a2;
+    Fp2 t = a4.Square() - a1_a2;
+    t.DoubleInPlace();
+    t -= a1_a2;
+    t += a3 * a5;
+    this->c0_.c0_ = Fp6::Config::MulByNonResidue(t) + Fp2::One();
+    this->c1_.c1_ = a4;
+    return *this;
+  }
 };
 
 }  // namespace tachyon::math
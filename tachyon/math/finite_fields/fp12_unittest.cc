@@ -1,6 +1,9 @@
+#include <vector>
+
 #include "gtest/gtest.h"
 
 #include "tachyon/base/buffer/vector_buffer.h"
+#include "tachyon/math/elliptic_curves/bls12/bls12_381/fq12.h"
 #include "tachyon/math/elliptic_curves/bn/bn254/fq12.h"
 #include "tachyon/math/finite_fields/test/finite_field_test.h"
 
@@ -10,13 +13,69 @@ namespace {
 
 class Fp12Test : public FiniteFieldTest<bn254::Fq12> {};
 
+template <typename F>
+class CyclotomicFp12Test : public FiniteFieldTest<F> {};
+
 }  // namespace
 
+using Fp12Types = testing::Types<bn254::Fq12, bls12_381::Fq12>;
+TYPED_TEST_SUITE(CyclotomicFp12Test, Fp12Types);
+
 TEST_F(Fp12Test, TypeTest) {
   EXPECT_TRUE((std::is_same_v<bn254::Fq12::BaseField, bn254::Fq6>));
   EXPECT_TRUE((std::is_same_v<bn254::Fq12::BasePrimeField, bn254::Fq>));
 }
 
+TYPED_TEST(CyclotomicFp12Test, CompressedCyclotomicSquare) {
+  using F = TypeParam;
+
+  // f^((p⁶ - 1)(p² + 1)) is in the cyclotomic subgroup.
+  F f = F::Random();
+  f = f.CyclotomicInverse() * f.Inverse();
+  F f_p2 = f;
+  f *= f_p2.FrobeniusMapInPlace(2);
+
+  std::vector<F> expected;
+  std::vector<F> compressed;
+  F square = f;
+  F compressed_square = f;
+  for (size_t i = 0; i < 10; ++i) {
+    square.CyclotomicSquareInPlace();
+    compressed_square.CompressedCyclotomicSquareInPlace();
+    expected.push_back(square);
+    compressed.push_back(compressed_square);
+    EXPECT_EQ(F(compressed_square).DecompressCyclotomicInPlace(), square);
+  }
+  F::BatchDecompressCyclotomicInPlace(&compressed);
+  EXPECT_EQ(compressed, expected);
+
+  F one = F::One();
+  EXPECT_EQ(
+      one.CompressedCyclotomicSquareInPlace().DecompressCyclotomicInPlace(),
+      F::One());
+}
+
+TYPED_TEST(CyclotomicFp12Test, CyclotomicPow) {
+  using F = TypeParam;
+
+  F f = F::Random();
+  f = f.CyclotomicInverse() * f.Inverse();
+  F f_p2 = f;
+  f *= f_p2.FrobeniusMapInPlace(2);
+
+  // The last two are |x| of BLS12-381 and BN254.
+  for (uint64_t exponent : {uint64_t{0}, uint64_t{1}, uint64_t{7},
+                            UINT64_C(0xd201000000010000),
+                            UINT64_C(0x44e992b44a6909f1)}) {
+    BigInt<1> e(exponent);
+    F expected = f.CyclotomicPow(e);
+    EXPECT_EQ(f.CompressedCyclotomicPow(e), expected);
+    for (uint32_t window_bits = 2; window_bits <= 6; ++window_bits) {
+      EXPECT_EQ(f.CyclotomicPowWithWindow(e, window_bits), expected);
+    }
+  }
+}
+
 TEST_F(Fp12Test, Copyable) {
   using F = bn254::Fq12;
 
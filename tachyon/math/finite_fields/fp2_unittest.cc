@@ -1,3 +1,5 @@
+#include <vector>
+
 #include "gtest/gtest.h"
 
 #include "tachyon/base/buffer/vector_buffer.h"
@@ -17,6 +19,46 @@ TEST_F(Fp2Test, TypeTest) {
   EXPECT_TRUE((std::is_same_v<bn254::Fq2::BasePrimeField, bn254::Fq>));
 }
 
+TEST_F(Fp2Test, SquareRoot) {
+  using F = bn254::Fq2;
+  using BaseField = F::BaseField;
+
+  for (size_t i = 0; i < 100; ++i) {
+    F f = F::Random();
+    F sqrt;
+    ASSERT_TRUE(f.Square().SquareRoot(&sqrt));
+    EXPECT_TRUE(sqrt == f || sqrt == -f);
+  }
+
+  // The elements of the base field are squares in |F|.
+  for (const F& f : {F::Zero(), F::One(), F(BaseField(5), BaseField::Zero()),
+                     F(-BaseField(5), BaseField::Zero())}) {
+    F sqrt;
+    ASSERT_TRUE(f.SquareRoot(&sqrt));
+    EXPECT_EQ(sqrt.Square(), f);
+  }
+
+  // A random element is a non-square with probability 1/2.
+  size_t non_square_num = 0;
+  for (size_t i = 0; i < 100; ++i) {
+    F f = F::Random();
+    F sqrt;
+    if (f.SquareRoot(&sqrt)) {
+      EXPECT_EQ(sqrt.Square(), f);
+    } else {
+      ++non_square_num;
+    }
+  }
+  EXPECT_GT(non_square_num, 0);
+
+  std::vector<F> values = {F::Random().Square(), F::Random().Square()};
+  std::vector<F> roots(values.size());
+  ASSERT_TRUE(F::BatchSquareRoot(values, &roots));
+  for (size_t i = 0; i < values.size(); ++i) {
+    EXPECT_EQ(roots[i].Square(), values[i]);
+  }
+}
+
 TEST_F(Fp2Test, Copyable) {
   using F = bn254::Fq2;
 
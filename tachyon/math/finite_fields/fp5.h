@@ -0,0 +1,88 @@
+#ifndef TACHYON_MATH_FINITE_FIELDS_FP5_H_
+#define TACHYON_MATH_FINITE_FIELDS_FP5_H_
+
+#include "tachyon/math/base/gmp/gmp_util.h"
+#include "tachyon/math/finite_fields/quintic_extension_field.h"
+
+namespace tachyon::math {
+
+template <typename Config>
+class Fp5 final : public QuinticExtensionField<Fp5<Config>> {
+ public:
+  using BaseField = typename Config::BaseField;
+  using BasePrimeField = typename Config::BasePrimeField;
+  using FrobeniusCoefficient = typename Config::FrobeniusCoefficient;
+
+  using CpuField = Fp5<Config>;
+  // TODO(chokobole): Implements Fp5Gpu
+  using GpuField = Fp5<Config>;
+
+  using QuinticExtensionField<Fp5<Config>>::QuinticExtensionField;
+
+  static_assert(Config::kDegreeOverBaseField == 5);
+  static_assert(BaseField::ExtensionDegree() == 1);
+
+  constexpr static uint64_t kDegreeOverBasePrimeField = 5;
+
+  static void Init() {
+    Config::Init();
+    // x⁵ = q = Config::kNonResidue
+
+    // αᴾ = (α₀ + α₁x + α₂x² + α₃x³ + α₄x⁴)ᴾ
+    //    = α₀ + α₁xᴾ + α₂x²ᴾ + α₃x³ᴾ + α₄x⁴ᴾ <- Fermat's little theorem
+    //    = α₀ + α₁ωx + α₂ω²x² + α₃ω³x³ + α₄ω⁴x⁴,
+    // where ω = xᴾ⁻¹ = q^((P - 1) / 5) is a quintic root of unity.
+    // See QuinticExtensionField::FrobeniusMapInPlace().
+
+    constexpr uint64_t N = BasePrimeField::kLimbNums;
+    // m₁ = P
+    mpz_class m1;
+    gmp::WriteLimbs(BasePrimeField::Config::kModulus.limbs, N, &m1);
+
+#define SET_M(d, d_prev) mpz_class m##d = m##d_prev * m1
+
+    // m₂ = m₁ * P = P²
+    SET_M(2, 1);
+    // m₃ = m₂ * P = P³
+    SET_M(3, 2);
+    // m₄ = m₃ * P = P⁴
+    SET_M(4, 3);
+
+#undef SET_M
+
+#define SET_EXP_GMP(d) mpz_class exp##d##_gmp = (m##d - 1) / mpz_class(5)
+
+    // exp₁ = (m₁ - 1) / 5 = (P¹ - 1) / 5
+    SET_EXP_GMP(1);
+    // exp₂ = (m₂ - 1) / 5 = (P² - 1) / 5
+    SET_EXP_GMP(2);
+    // exp₃ = (m₃ - 1) / 5 = (P³ - 1) / 5
+    SET_EXP_GMP(3);
+    // exp₄ = (m₄ - 1) / 5 = (P⁴ - 1) / 5
+    SET_EXP_GMP(4);
+
+#undef SET_EXP_GMP
+
+    // kFrobeniusCoeffs[0] = q^((P⁰ - 1) / 5) = 1
+    Config::kFrobeniusCoeffs[0] = FrobeniusCoefficient::One();
+#define SET_FROBENIUS_COEFF(d)                \
+  BigInt<d * N> exp##d;                       \
+  gmp::CopyLimbs(exp##d##_gmp, exp##d.limbs); \
+  Config::kFrobeniusCoeffs[d] = Config::kNonResidue.Pow(exp##d)
+
+    // kFrobeniusCoeffs[1] = q^(exp₁) = q^((P¹ - 1) / 5) = ω
+    SET_FROBENIUS_COEFF(1);
+    // kFrobeniusCoeffs[2] = q^(exp₂) = q^((P² - 1) / 5)
+    SET_FROBENIUS_COEFF(2);
+    // kFrobeniusCoeffs[3] = q^(exp₃) = q^((P³ - 1) / 5)
+    SET_FROBENIUS_COEFF(3);
+    // kFrobeniusCoeffs[4] = q^(exp₄) = q^((P⁴ - 1) / 5)
+    SET_FROBENIUS_COEFF(4);
+
+#undef SET_FROBENIUS_COEFF
+  }
+};
+
+}  // namespace tachyon::math
+
+#endif  // TACHYON_MATH_FINITE_FIELDS_FP5_H_
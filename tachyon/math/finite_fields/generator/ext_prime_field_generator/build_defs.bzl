@@ -119,6 +119,17 @@ def generate_fp4s(
         **kwargs
     )
 
+def generate_fp5s(
+        name,
+        **kwargs):
+    _generate_ext_prime_fields(
+        name = name,
+        degree = 5,
+        base_field_degree = 1,
+        ext_prime_field_deps = ["//tachyon/math/finite_fields:fp5"],
+        **kwargs
+    )
+
 def generate_fp6s(
         name,
         **kwargs):
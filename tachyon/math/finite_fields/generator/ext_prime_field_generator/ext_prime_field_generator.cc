@@ -45,6 +45,14 @@ int GenerationConfig::GenerateConfigHdr() const {
       "  static FrobeniusCoefficient kFrobeniusCoeffs2[%{frob_coeffs_size}];",
       "",
       "  constexpr static bool kNonResidueIsMinusOne = %{non_residue_is_minus_one};",
+      "  // Whether the non-residue is c + u for a small integer c, where u is the",
+      "  // generator of |BaseField| over |BasePrimeField|. If so, the lazy reduction",
+      "  // of double_width_extension_field.h is used. c is |kNonResidueSmallInt|.",
+      "  constexpr static bool kNonResidueIsSmallIntPlusU = %{non_residue_is_small_int_plus_u};",
+      "  constexpr static uint64_t kNonResidueSmallInt = %{non_residue_small_int};",
+      "  // Whether |BaseField| is Fp6 = Fp2[v] / (v³ - ξ) and the non-residue is v.",
+      "  // If so, the lazy reduction of double_width_extension_field.h is used.",
+      "  constexpr static bool kNonResidueIsV = %{non_residue_is_v};",
       "  constexpr static uint64_t kDegreeOverBaseField = %{degree_over_base_field};",
       "  constexpr static uint64_t kDegreeOverBasePrimeField = %{degree_over_base_prime_field};",
       "",
@@ -112,6 +120,22 @@ int GenerationConfig::GenerateConfigHdr() const {
                                       /*is_prime_field=*/degree != 12);
   }
 
+  // The lazy reduction multiplies the unreduced values by c + u with the
+  // additions, so c should be small.
+  constexpr int64_t kMaxNonResidueSmallInt = 16;
+  int64_t non_residue_small_int = 0;
+  bool non_residue_is_small_int_plus_u =
+      degree == 6 && base_field_degree == 2 && non_residue.size() == 2 &&
+      non_residue[1] == "1" &&
+      base::StringToInt64(non_residue[0], &non_residue_small_int) &&
+      non_residue_small_int > 0 &&
+      non_residue_small_int <= kMaxNonResidueSmallInt;
+  if (!non_residue_is_small_int_plus_u) non_residue_small_int = 0;
+
+  bool non_residue_is_v = degree == 12 && base_field_degree == 6 &&
+                          non_residue ==
+                              std::vector<std::string>{"0", "1", "0"};
+
   std::string mul_by_non_residue;
   if (!mul_by_non_residue_override.empty()) {
     mul_by_non_residue = mul_by_non_residue_override;
@@ -169,6 +193,11 @@ int GenerationConfig::GenerateConfigHdr() const {
                                   : "typename BaseField::BasePrimeField"},
       {"%{non_residue_is_minus_one}",
        base::BoolToString(non_residue_is_minus_one)},
+      {"%{non_residue_is_small_int_plus_u}",
+       base::BoolToString(non_residue_is_small_int_plus_u)},
+      {"%{non_residue_small_int}",
+       base::NumberToString(non_residue_small_int)},
+      {"%{non_residue_is_v}", base::BoolToString(non_residue_is_v)},
       {"%{mul_by_non_residue}", mul_by_non_residue},
       {"%{init}", init},
       {"%{frobenius_coefficient}", frobenius_coefficient},
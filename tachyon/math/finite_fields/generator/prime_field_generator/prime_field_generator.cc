@@ -9,6 +9,8 @@
 #include "tachyon/math/base/bit_iterator.h"
 #include "tachyon/math/base/gmp/bit_traits.h"
 #include "tachyon/math/finite_fields/generator/generator_util.h"
+#include "tachyon/math/finite_fields/generator/prime_field_generator/square_root_table.h"
+#include "tachyon/math/finite_fields/generator/prime_field_generator/x86_64_montgomery_asm.h"
 #include "tachyon/math/finite_fields/prime_field_util.h"
 
 namespace tachyon {
@@ -88,6 +90,7 @@ int GenerationConfig::GenerateConfigHdr() const {
   // clang-format off
   std::vector<std::string> tpl = {
       "#include \"tachyon/export.h\"",
+      "#include \"tachyon/build/build_config.h\"",
       "#include \"tachyon/math/finite_fields/prime_field.h\"",
       "",
       "namespace %{namespace} {",
@@ -130,6 +133,9 @@ int GenerationConfig::GenerateConfigHdr() const {
       "  constexpr static uint64_t kInverse64 = UINT64_C(%{inverse64});",
       "  constexpr static uint32_t kInverse32 = %{inverse32};",
       "",
+      "  constexpr static bool kHasAsmMontgomery = false;",
+      "  constexpr static bool kUseSafeGcdInverse = %{use_safegcd_inverse};",
+      "",
       "  constexpr static BigInt<%{n}> kOne = BigInt<%{n}>({",
       "    %{one_mont_form}",
       "  });",
@@ -137,6 +143,8 @@ int GenerationConfig::GenerateConfigHdr() const {
       "  constexpr static bool kHasTwoAdicRootOfUnity = false;",
       "",
       "  constexpr static bool kHasLargeSubgroupRootOfUnity = false;",
+      "",
+      "  constexpr static bool kHasSquareRootTable = false;",
       "};",
       "",
       "using %{class} = PrimeField<%{class}Config>;",
@@ -222,6 +230,20 @@ int GenerationConfig::GenerateConfigHdr() const {
       }
     }
 
+    if (CanGenerateSquareRootTable(two_adicity)) {
+      std::vector<std::string> lines =
+          GenerateSquareRootTable(m, two_adic_root_of_unity, two_adicity);
+      for (size_t i = 0; i < tpl.size(); ++i) {
+        size_t idx =
+            tpl[i].find("constexpr static bool kHasSquareRootTable = false;");
+        if (idx != std::string::npos) {
+          auto it = tpl.erase(tpl.begin() + i);
+          tpl.insert(it, lines.begin(), lines.end());
+          break;
+        }
+      }
+    }
+
     if (!small_subgroup_base.empty()) {
       CHECK(!small_subgroup_adicity.empty());
       // 5) gᵗ^(2ˢ) = 1 (mod m)
@@ -256,8 +278,7 @@ int GenerationConfig::GenerateConfigHdr() const {
         size_t idx = tpl[i].find(
             "constexpr static bool kHasLargeSubgroupRootOfUnity = false;");
         if (idx != std::string::npos) {
-          auto it = tpl.begin() + i;
-          tpl.erase(it);
+          auto it = tpl.erase(tpl.begin() + i);
           tpl.insert(it, lines.begin(), lines.end());
           break;
         }
@@ -270,6 +291,36 @@ int GenerationConfig::GenerateConfigHdr() const {
     CHECK(small_subgroup_adicity.empty());
   }
 
+  if (CanGenerateX86_64MontgomeryAsm(n)) {
+    std::vector<std::string> lines;
+    lines.push_back(
+        "#if defined(ARCH_CPU_X86_64) && defined(COMPILER_GCC) && "
+        "!defined(__CUDA_ARCH__)");
+    lines.push_back("  constexpr static bool kHasAsmMontgomery = true;");
+    lines.push_back("");
+    std::vector<std::string> asm_lines = GenerateX86_64MontgomeryAsm(n);
+    lines.insert(lines.end(), asm_lines.begin(), asm_lines.end());
+    lines.push_back("#else");
+    lines.push_back("  constexpr static bool kHasAsmMontgomery = false;");
+    lines.push_back("#endif");
+
+    for (size_t i = 0; i < tpl.size(); ++i) {
+      size_t idx =
+          tpl[i].find("constexpr static bool kHasAsmMontgomery = false;");
+      if (idx != std::string::npos) {
+        auto it = tpl.begin() + i;
+        tpl.erase(it);
+        tpl.insert(it, lines.begin(), lines.end());
+        break;
+      }
+    }
+  }
+
+  // The safegcd inversion is about 3 times faster than the binary extended
+  // Euclidean algorithm for 4 and 6 limbs, but on par for a single limb, where
+  // the exponentiation also beats its Legendre symbol.
+  bool use_safegcd_inverse = n >= 2;
+
   std::string tpl_content = absl::StrJoin(tpl, "\n");
 
   std::string content = absl::StrReplaceAll(
@@ -301,6 +352,7 @@ int GenerationConfig::GenerateConfigHdr() const {
           {"%{inverse64}", base::NumberToString(modulus_info.inverse64)},
           {"%{inverse32}", base::NumberToString(modulus_info.inverse32)},
           {"%{one_mont_form}", math::MpzClassToMontString(mpz_class(1), m)},
+          {"%{use_safegcd_inverse}", base::BoolToString(use_safegcd_inverse)},
       });
   return WriteHdr(content, false);
 }
@@ -0,0 +1,96 @@
+#include "tachyon/math/finite_fields/generator/prime_field_generator/square_root_table.h"
+
+#include <algorithm>
+#include <utility>
+
+#include "absl/strings/str_join.h"
+#include "absl/strings/substitute.h"
+
+#include "tachyon/base/logging.h"
+#include "tachyon/math/base/gmp/gmp_util.h"
+#include "tachyon/math/finite_fields/generator/generator_util.h"
+
+namespace tachyon {
+
+namespace {
+
+// The windows are at most 8 bits, so that each table has at most 256 elements.
+constexpr uint32_t kMaxWindowBits = 8;
+
+}  // namespace
+
+bool CanGenerateSquareRootTable(uint32_t two_adicity) {
+  return two_adicity >= 16 && two_adicity < 64;
+}
+
+std::vector<std::string> GenerateSquareRootTable(
+    const mpz_class& modulus, const mpz_class& two_adic_root_of_unity,
+    uint32_t two_adicity) {
+  CHECK(CanGenerateSquareRootTable(two_adicity));
+  uint32_t window_nums = (two_adicity + kMaxWindowBits - 1) / kMaxWindowBits;
+  uint32_t window_bits = (two_adicity + window_nums - 1) / window_nums;
+  uint32_t lowest_window_bits = two_adicity - window_bits * (window_nums - 1);
+  uint32_t table_size = uint32_t{1} << window_bits;
+
+  mpz_class g_inv;
+  mpz_invert(g_inv.get_mpz_t(), two_adic_root_of_unity.get_mpz_t(),
+             modulus.get_mpz_t());
+
+  std::vector<std::string> lines;
+  // clang-format off
+  lines.push_back("  constexpr static bool kHasSquareRootTable = true;");
+  lines.push_back(absl::Substitute("  constexpr static uint32_t kSquareRootWindowBits = $0;", window_bits));
+  lines.push_back(absl::Substitute("  constexpr static uint32_t kSquareRootWindowNums = $0;", window_nums));
+  lines.push_back("  constexpr static BigInt<%{n}> kSquareRootTable[] = {");
+  // clang-format on
+  for (uint32_t j = 0; j < window_nums; ++j) {
+    uint32_t position =
+        j == 0 ? 0 : lowest_window_bits + window_bits * (j - 1);
+    // base = g^(-2ᵖ)
+    mpz_class base;
+    mpz_class exponent = mpz_class(1) << position;
+    mpz_powm(base.get_mpz_t(), g_inv.get_mpz_t(), exponent.get_mpz_t(),
+             modulus.get_mpz_t());
+    mpz_class value = 1;
+    for (uint32_t i = 0; i < table_size; ++i) {
+      lines.push_back(
+          absl::Substitute("    BigInt<%{n}>({$0}),",
+                           math::MpzClassToMontString(value, modulus)));
+      value = (value * base) % modulus;
+    }
+  }
+  lines.push_back("  };");
+
+  // ξ = g^(2ˢ⁻ʷ)
+  mpz_class xi;
+  mpz_class exponent = mpz_class(1) << (two_adicity - window_bits);
+  mpz_powm(xi.get_mpz_t(), two_adic_root_of_unity.get_mpz_t(),
+           exponent.get_mpz_t(), modulus.get_mpz_t());
+  std::vector<std::pair<uint64_t, uint32_t>> dlogs;
+  mpz_class value = 1;
+  for (uint32_t i = 0; i < table_size; ++i) {
+    dlogs.push_back({math::gmp::GetLimbConstRef(value, 0), i});
+    value = (value * xi) % modulus;
+  }
+  std::sort(dlogs.begin(), dlogs.end());
+  for (size_t i = 1; i < dlogs.size(); ++i) {
+    CHECK_NE(dlogs[i - 1].first, dlogs[i].first)
+        << "The lowest limbs of the roots of unity collide";
+  }
+
+  std::vector<std::string> keys;
+  std::vector<std::string> indices;
+  for (const auto& [key, index] : dlogs) {
+    keys.push_back(absl::Substitute("UINT64_C($0)", key));
+    indices.push_back(absl::Substitute("$0", index));
+  }
+  lines.push_back("  constexpr static uint64_t kSquareRootDlogKeys[] = {");
+  lines.push_back(absl::Substitute("    $0", absl::StrJoin(keys, ", ")));
+  lines.push_back("  };");
+  lines.push_back("  constexpr static uint32_t kSquareRootDlogIndices[] = {");
+  lines.push_back(absl::Substitute("    $0", absl::StrJoin(indices, ", ")));
+  lines.push_back("  };");
+  return lines;
+}
+
+}  // namespace tachyon
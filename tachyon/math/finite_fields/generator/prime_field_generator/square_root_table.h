@@ -0,0 +1,39 @@
+#ifndef TACHYON_MATH_FINITE_FIELDS_GENERATOR_PRIME_FIELD_GENERATOR_SQUARE_ROOT_TABLE_H_
+#define TACHYON_MATH_FINITE_FIELDS_GENERATOR_PRIME_FIELD_GENERATOR_SQUARE_ROOT_TABLE_H_
+
+#include <stdint.h>
+
+#include <string>
+#include <vector>
+
+#include "third_party/gmp/include/gmpxx.h"
+
+namespace tachyon {
+
+// Returns whether the square root table of a prime field whose two-adicity is
+// |two_adicity| is generated. For a low two-adicity, Tonelli-Shanks is as fast
+// as the table lookups.
+bool CanGenerateSquareRootTable(uint32_t two_adicity);
+
+// Returns the lines of the static members of a prime field config below, which
+// are used by ComputeSarkarSquareRoot(). Here, g is |two_adic_root_of_unity|,
+// s is |two_adicity|, and s is split into |kSquareRootWindowNums| windows of
+// w = |kSquareRootWindowBits| bits, where the lowest window can be shorter.
+//
+//   constexpr static bool kHasSquareRootTable = true;
+//   constexpr static uint32_t kSquareRootWindowBits;
+//   constexpr static uint32_t kSquareRootWindowNums;
+//   // kSquareRootTable[j * 2ʷ + i] = g^(-i * 2ᵖ), where p is the position of
+//   // the j-th window.
+//   constexpr static BigInt<n> kSquareRootTable[];
+//   // The lowest limbs of ξⁱ in ascending order and their i's, where
+//   // ξ = g^(2ˢ⁻ʷ).
+//   constexpr static uint64_t kSquareRootDlogKeys[];
+//   constexpr static uint32_t kSquareRootDlogIndices[];
+std::vector<std::string> GenerateSquareRootTable(
+    const mpz_class& modulus, const mpz_class& two_adic_root_of_unity,
+    uint32_t two_adicity);
+
+}  // namespace tachyon
+
+#endif  // TACHYON_MATH_FINITE_FIELDS_GENERATOR_PRIME_FIELD_GENERATOR_SQUARE_ROOT_TABLE_H_
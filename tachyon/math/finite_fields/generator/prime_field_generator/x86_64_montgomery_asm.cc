@@ -0,0 +1,316 @@
+#include "tachyon/math/finite_fields/generator/prime_field_generator/x86_64_montgomery_asm.h"
+
+#include <algorithm>
+
+#include "absl/strings/str_join.h"
+#include "absl/strings/substitute.h"
+
+namespace tachyon {
+
+namespace {
+
+// Emits the body of an extended inline assembly statement. The accumulator
+// is kept in |n| + 2 registers, t₀ to tₙ₊₁, whose names are rotated instead of
+// moving their values whenever the accumulator is shifted down by a limb.
+class AsmWriter {
+ public:
+  explicit AsmWriter(size_t n) : n_(n) {
+    for (size_t i = 0; i < n + 2; ++i) {
+      regs_.push_back(i);
+    }
+  }
+
+  const std::vector<std::string>& lines() const { return lines_; }
+
+  void Emit(std::string_view insn) {
+    lines_.push_back(absl::Substitute("        \"$0\\n\\t\"", insn));
+  }
+
+  // Returns the register of tᵢ.
+  std::string T(size_t i) const { return absl::Substitute("%[t$0]", regs_[i]); }
+
+  // Returns the 32-bit name of the register of tᵢ.
+  std::string T32(size_t i) const {
+    return absl::Substitute("%k[t$0]", regs_[i]);
+  }
+
+  static std::string Mem(std::string_view ptr, size_t i) {
+    return absl::Substitute("$0(%[$1])", 8 * i, ptr);
+  }
+
+  void Zero(size_t i) { Emit(absl::Substitute("xorl $0, $0", T32(i))); }
+
+  // t += Σⱼ rdx * |src|[j] * 2⁶⁴ʲ for j in [|from|, n), where rdx should be set
+  // beforehand. The low halves of the products are accumulated on the OF
+  // chain and the high halves on the CF chain.
+  void MulAccumulate(std::string_view src, size_t from) {
+    Emit("xorl %k[lo], %k[lo]");
+    for (size_t j = from; j < n_; ++j) {
+      Emit(absl::Substitute("mulxq $0, %[lo], %[hi]", Mem(src, j)));
+      Emit(absl::Substitute("adoxq %[lo], $0", T(j)));
+      Emit(absl::Substitute("adcxq %[hi], $0", T(j + 1)));
+    }
+    FlushCarries();
+  }
+
+  // t += m * p, where m = t₀ * -p⁻¹ mod 2⁶⁴, and shifts t down by a limb.
+  void Reduce() {
+    Emit(absl::Substitute("movq $0, %%rdx", T(0)));
+    Emit("imulq %[inv], %%rdx");
+    Emit("xorl %k[lo], %k[lo]");
+    for (size_t j = 0; j < n_; ++j) {
+      Emit(absl::Substitute("mulxq %[p$0], %[lo], %[hi]", j));
+      Emit(absl::Substitute("adoxq %[lo], $0", T(j)));
+      Emit(absl::Substitute("adcxq %[hi], $0", T(j + 1)));
+    }
+    FlushCarries();
+    // t₀ is zero now, so it becomes the new tₙ₊₁.
+    Rotate();
+  }
+
+  // Shifts t down by a limb. The register of t₀ becomes tₙ₊₁, so it should be
+  // zero.
+  void Rotate() { std::rotate(regs_.begin(), regs_.begin() + 1, regs_.end()); }
+
+  // |dst| = t - p if t ≥ p, otherwise t. t should be less than 2p.
+  void StoreWithFinalSubtraction(std::string_view dst) {
+    for (size_t j = 0; j < n_; ++j) {
+      Emit(absl::Substitute("movq $0, $1", T(j), Mem(dst, j)));
+    }
+    Emit(absl::Substitute("subq %[p0], $0", T(0)));
+    for (size_t j = 1; j < n_; ++j) {
+      Emit(absl::Substitute("sbbq %[p$0], $1", j, T(j)));
+    }
+    Emit(absl::Substitute("sbbq $$0, $0", T(n_)));
+    // If it borrowed, t < p, so t is restored.
+    for (size_t j = 0; j < n_; ++j) {
+      Emit(absl::Substitute("cmovcq $0, $1", Mem(dst, j), T(j)));
+    }
+    for (size_t j = 0; j < n_; ++j) {
+      Emit(absl::Substitute("movq $0, $1", T(j), Mem(dst, j)));
+    }
+  }
+
+ private:
+  // Adds the carry on the OF chain out of tₙ₋₁ and the carry on the CF chain
+  // out of tₙ.
+  void FlushCarries() {
+    // NOTE: movq doesn't affect the flags.
+    Emit("movq $0, %[lo]");
+    Emit(absl::Substitute("adoxq %[lo], $0", T(n_)));
+    Emit(absl::Substitute("adoxq %[lo], $0", T(n_ + 1)));
+    Emit(absl::Substitute("adcxq %[lo], $0", T(n_ + 1)));
+  }
+
+  size_t n_;
+  // The indices of the operands of t₀ to tₙ₊₁.
+  std::vector<size_t> regs_;
+  std::vector<std::string> lines_;
+};
+
+std::string JoinOperands(std::vector<std::string> operands) {
+  return absl::StrJoin(operands, ", ");
+}
+
+std::vector<std::string> TempOperands(size_t n) {
+  std::vector<std::string> operands;
+  for (size_t i = 0; i < n + 2; ++i) {
+    operands.push_back(absl::Substitute("[t$0] \"=&r\"(t$0)", i));
+  }
+  operands.push_back("[lo] \"=&r\"(lo)");
+  operands.push_back("[hi] \"=&r\"(hi)");
+  return operands;
+}
+
+std::vector<std::string> ModulusOperands(size_t n) {
+  std::vector<std::string> operands;
+  for (size_t i = 0; i < n; ++i) {
+    operands.push_back(absl::Substitute("[p$0] \"m\"(constants[$0])", i));
+  }
+  operands.push_back(absl::Substitute("[inv] \"m\"(constants[$0])", n));
+  return operands;
+}
+
+// NOTE: |kModulus| and |kInverse64| are copied to the stack. Otherwise, each of
+// them may take a register for its address in position independent code,
+// which runs out of the registers when n is 6.
+std::string ConstantDeclaration(size_t n) {
+  std::vector<std::string> constants;
+  for (size_t i = 0; i < n; ++i) {
+    constants.push_back(absl::Substitute("kModulus.limbs[$0]", i));
+  }
+  constants.push_back("kInverse64");
+  return absl::Substitute("    const uint64_t constants[] = {$0};",
+                          absl::StrJoin(constants, ", "));
+}
+
+std::string TempDeclaration(size_t n) {
+  std::vector<std::string> names;
+  for (size_t i = 0; i < n + 2; ++i) {
+    names.push_back(absl::Substitute("t$0", i));
+  }
+  names.push_back("lo");
+  names.push_back("hi");
+  return absl::Substitute("    uint64_t $0;", absl::StrJoin(names, ", "));
+}
+
+void AppendAsm(const AsmWriter& writer, std::vector<std::string> inputs,
+               size_t n, std::vector<std::string>* lines) {
+  lines->push_back(ConstantDeclaration(n));
+  lines->push_back(TempDeclaration(n));
+  lines->push_back("    asm volatile(");
+  lines->insert(lines->end(), writer.lines().begin(), writer.lines().end());
+  lines->push_back(
+      absl::Substitute("        : $0", JoinOperands(TempOperands(n))));
+  std::vector<std::string> modulus_operands = ModulusOperands(n);
+  inputs.insert(inputs.end(), modulus_operands.begin(),
+                modulus_operands.end());
+  lines->push_back(absl::Substitute("        : $0", JoinOperands(inputs)));
+  lines->push_back("        : \"rdx\", \"cc\", \"memory\");");
+}
+
+}  // namespace
+
+bool CanGenerateX86_64MontgomeryAsm(size_t n) { return n == 4 || n == 6; }
+
+std::vector<std::string> GenerateX86_64MontgomeryAsm(size_t n) {
+  std::vector<std::string> lines;
+
+  // AsmMulInPlace(): CIOS(Coarsely Integrated Operand Scanning).
+  {
+    AsmWriter writer(n);
+    for (size_t i = 0; i < n + 2; ++i) {
+      writer.Zero(i);
+    }
+    for (size_t i = 0; i < n; ++i) {
+      writer.Emit(absl::Substitute("movq $0, %%rdx", AsmWriter::Mem("b", i)));
+      writer.MulAccumulate("a", 0);
+      writer.Reduce();
+    }
+    writer.StoreWithFinalSubtraction("a");
+
+    lines.push_back(
+        absl::Substitute("  // |a| = |a| * |b| * R⁻¹ mod p, where a and b are "
+                         "$0 limbs.",
+                         n));
+    lines.push_back(
+        "  static void AsmMulInPlace(uint64_t* a, const uint64_t* b) {");
+    AppendAsm(writer, {"[a] \"r\"(a)", "[b] \"r\"(b)"}, n, &lines);
+    lines.push_back("  }");
+    lines.push_back("");
+  }
+
+  // AsmMul(): the schoolbook multiplication whose lower limbs are stored as
+  // soon as they are completed.
+  {
+    AsmWriter writer(n);
+    for (size_t i = 0; i < n + 2; ++i) {
+      writer.Zero(i);
+    }
+    for (size_t i = 0; i < n; ++i) {
+      writer.Emit(absl::Substitute("movq $0, %%rdx", AsmWriter::Mem("b", i)));
+      writer.MulAccumulate("a", 0);
+      writer.Emit(
+          absl::Substitute("movq $0, $1", writer.T(0), AsmWriter::Mem("x", i)));
+      writer.Zero(0);
+      writer.Rotate();
+    }
+    for (size_t i = 0; i < n; ++i) {
+      writer.Emit(absl::Substitute("movq $0, $1", writer.T(i),
+                                   AsmWriter::Mem("x", n + i)));
+    }
+
+    lines.push_back(absl::Substitute(
+        "  // |x| = |a| * |b|, where a and b are $0 limbs and x is $1 limbs.",
+        n, 2 * n));
+    lines.push_back(
+        "  static void AsmMul(const uint64_t* a, const uint64_t* b, "
+        "uint64_t* x) {");
+    AppendAsm(writer, {"[a] \"r\"(a)", "[b] \"r\"(b)", "[x] \"r\"(x)"}, n,
+              &lines);
+    lines.push_back("  }");
+    lines.push_back("");
+  }
+
+  // AsmSquareInPlace(): the products aᵢ * aⱼ with i < j are computed once and
+  // doubled, and the squares aᵢ² are added to them.
+  {
+    AsmWriter writer(n);
+    for (size_t i = 0; i < n + 2; ++i) {
+      writer.Zero(i);
+    }
+    for (size_t i = 0; i < n; ++i) {
+      if (i + 1 < n) {
+        writer.Emit(
+            absl::Substitute("movq $0, %%rdx", AsmWriter::Mem("a", i)));
+        // Row i adds aᵢ * aⱼ to t at j, whose base is at the limb i.
+        writer.MulAccumulate("a", i + 1);
+      }
+      writer.Emit(
+          absl::Substitute("movq $0, $1", writer.T(0), AsmWriter::Mem("x", i)));
+      writer.Zero(0);
+      writer.Rotate();
+    }
+    for (size_t i = 0; i < n; ++i) {
+      writer.Emit(absl::Substitute("movq $0, $1", writer.T(i),
+                                   AsmWriter::Mem("x", n + i)));
+    }
+    for (size_t i = 0; i < 2 * n; ++i) {
+      writer.Emit(absl::Substitute("movq $0, %[lo]", AsmWriter::Mem("x", i)));
+      writer.Emit(i == 0 ? "addq %[lo], %[lo]" : "adcq %[lo], %[lo]");
+      writer.Emit(absl::Substitute("movq %[lo], $0", AsmWriter::Mem("x", i)));
+    }
+    for (size_t i = 0; i < n; ++i) {
+      writer.Emit(absl::Substitute("movq $0, %%rdx", AsmWriter::Mem("a", i)));
+      writer.Emit("mulxq %%rdx, %[lo], %[hi]");
+      writer.Emit(absl::Substitute("$0 %[lo], $1", i == 0 ? "addq" : "adcq",
+                                   AsmWriter::Mem("x", 2 * i)));
+      writer.Emit(
+          absl::Substitute("adcq %[hi], $0", AsmWriter::Mem("x", 2 * i + 1)));
+    }
+
+    lines.push_back(absl::Substitute(
+        "  // |a| = |a|² * R⁻¹ mod p, where a is $0 limbs.", n));
+    lines.push_back("  static void AsmSquareInPlace(uint64_t* a) {");
+    lines.push_back(absl::Substitute("    uint64_t x[$0];", 2 * n));
+    AppendAsm(writer, {"[a] \"r\"(a)", "[x] \"r\"(x)"}, n, &lines);
+    lines.push_back("    AsmMontgomeryReduce(x, a);");
+    lines.push_back("  }");
+    lines.push_back("");
+  }
+
+  // AsmMontgomeryReduce(): the lower half of x is reduced, and then the upper
+  // half is added to it.
+  {
+    AsmWriter writer(n);
+    for (size_t i = 0; i < n; ++i) {
+      writer.Emit(
+          absl::Substitute("movq $0, $1", AsmWriter::Mem("x", i), writer.T(i)));
+    }
+    writer.Zero(n);
+    writer.Zero(n + 1);
+    for (size_t i = 0; i < n; ++i) {
+      writer.Reduce();
+    }
+    // Now t ≤ p, and the upper half of x is less than p.
+    writer.Emit(absl::Substitute("addq $0, $1", AsmWriter::Mem("x", n),
+                                 writer.T(0)));
+    for (size_t i = 1; i < n; ++i) {
+      writer.Emit(absl::Substitute("adcq $0, $1", AsmWriter::Mem("x", n + i),
+                                   writer.T(i)));
+    }
+    writer.Emit(absl::Substitute("adcq $$0, $0", writer.T(n)));
+    writer.StoreWithFinalSubtraction("r");
+
+    lines.push_back(absl::Substitute(
+        "  // |r| = |x| * R⁻¹ mod p, where x is $0 limbs and less than p * R.",
+        2 * n));
+    lines.push_back(
+        "  static void AsmMontgomeryReduce(const uint64_t* x, uint64_t* r) {");
+    AppendAsm(writer, {"[x] \"r\"(x)", "[r] \"r\"(r)"}, n, &lines);
+    lines.push_back("  }");
+  }
+  return lines;
+}
+
+}  // namespace tachyon
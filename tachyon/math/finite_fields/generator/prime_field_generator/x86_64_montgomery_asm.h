@@ -0,0 +1,35 @@
+#ifndef TACHYON_MATH_FINITE_FIELDS_GENERATOR_PRIME_FIELD_GENERATOR_X86_64_MONTGOMERY_ASM_H_
+#define TACHYON_MATH_FINITE_FIELDS_GENERATOR_PRIME_FIELD_GENERATOR_X86_64_MONTGOMERY_ASM_H_
+
+#include <stddef.h>
+
+#include <string>
+#include <vector>
+
+namespace tachyon {
+
+// Returns whether the Montgomery arithmetic of an |n|-limb prime field is
+// emitted in x86-64 assembly.
+bool CanGenerateX86_64MontgomeryAsm(size_t n);
+
+// Returns the lines of the static member functions of a prime field config
+// below, which compute the Montgomery multiplication, squaring and reduction
+// and the plain multiplication of an |n|-limb prime field in x86-64 assembly
+// with MULX(BMI2) and ADCX/ADOX(ADX). The carries of the products and of the
+// reductions are chained independently on CF and OF, so that two additions are
+// in flight at once. They are written in GCC extended inline assembly that
+// reads |kModulus| and |kInverse64| of the config, and they should be called
+// only if base::CPU reports both BMI2 and ADX.
+//
+//   static void AsmMulInPlace(uint64_t a[n], const uint64_t b[n]);
+//   static void AsmSquareInPlace(uint64_t a[n]);
+//   static void AsmMontgomeryReduce(const uint64_t x[2n], uint64_t r[n]);
+//   static void AsmMul(const uint64_t a[n], const uint64_t b[n],
+//                      uint64_t x[2n]);
+//
+// Any modulus of |n| limbs is supported, with or without a spare bit.
+std::vector<std::string> GenerateX86_64MontgomeryAsm(size_t n);
+
+}  // namespace tachyon
+
+#endif  // TACHYON_MATH_FINITE_FIELDS_GENERATOR_PRIME_FIELD_GENERATOR_X86_64_MONTGOMERY_ASM_H_
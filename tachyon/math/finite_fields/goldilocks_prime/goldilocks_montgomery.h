@@ -0,0 +1,41 @@
+#ifndef TACHYON_MATH_FINITE_FIELDS_GOLDILOCKS_PRIME_GOLDILOCKS_MONTGOMERY_H_
+#define TACHYON_MATH_FINITE_FIELDS_GOLDILOCKS_PRIME_GOLDILOCKS_MONTGOMERY_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace tachyon::math::internal {
+
+// p = 2⁶⁴ - 2³² + 1
+constexpr uint64_t kGoldilocksModulus = 0xffffffff00000001;
+// 2⁶⁴ - p = 2³² - 1
+constexpr uint64_t kGoldilocksEpsilon = 0xffffffff;
+
+// Returns whether |Config| is a prime field config of the Goldilocks prime.
+template <typename Config>
+constexpr bool IsGoldilocksConfig() {
+  if constexpr (Config::kModulusBits == 64) {
+    return Config::kModulus[0] == kGoldilocksModulus;
+  } else {
+    return false;
+  }
+}
+
+// Returns (|hi| * 2⁶⁴ + |lo|) * 2⁻⁶⁴ mod p, where the input is less than
+// p * 2⁶⁴. Since p⁻¹ = 2³² + 1 mod 2⁶⁴, both m = |lo| * p⁻¹ mod 2⁶⁴ and the
+// upper half of m * p of the Montgomery reduction are computed with shifts
+// instead of multiplications. The result is less than p.
+// See https://github.com/pornin/ecgfp5/blob/main/c/ecgfp5.c
+constexpr uint64_t GoldilocksMontgomeryReduce(uint64_t lo, uint64_t hi) {
+  uint64_t m = lo + (lo << 32);
+  uint64_t carry = m < lo ? 1 : 0;
+  // The lower half of m * p equals |lo|, so it doesn't need to be subtracted.
+  uint64_t mp_hi = m - (m >> 32) - carry;
+  uint64_t r = hi - mp_hi;
+  // If it borrowed, p is added back, which is subtracting 2⁶⁴ - p modulo 2⁶⁴.
+  return hi < mp_hi ? r - kGoldilocksEpsilon : r;
+}
+
+}  // namespace tachyon::math::internal
+
+#endif  // TACHYON_MATH_FINITE_FIELDS_GOLDILOCKS_PRIME_GOLDILOCKS_MONTGOMERY_H_
@@ -0,0 +1,249 @@
+#ifndef TACHYON_MATH_FINITE_FIELDS_GOLDILOCKS_PRIME_PACKED_GOLDILOCKS_H_
+#define TACHYON_MATH_FINITE_FIELDS_GOLDILOCKS_PRIME_PACKED_GOLDILOCKS_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <vector>
+
+#include "absl/types/span.h"
+
+#include "tachyon/base/logging.h"
+#include "tachyon/math/finite_fields/goldilocks_prime/goldilocks_montgomery.h"
+#include "tachyon/math/finite_fields/packed_u64.h"
+
+namespace tachyon::math {
+
+// PackedGoldilocks holds |Lanes| elements of the Goldilocks prime field |F|,
+// p = 2⁶⁴ - 2³² + 1, in a single vector register. As with PrimeField, the
+// elements stay in the Montgomery form, so that loading and storing are plain
+// vector moves. The 128-bit products are assembled from four 32-bit products
+// and reduced with GoldilocksMontgomeryReduce(), which needs only shifts,
+// additions and comparisons that every vector extension provides.
+template <typename F, size_t Lanes = internal::kNativeVectorLanes>
+class PackedGoldilocks {
+ public:
+  using Field = F;
+  using Backend = internal::PackedU64<Lanes>;
+  using Vec = typename Backend::Vec;
+
+  constexpr static size_t kLanes = Lanes;
+  // Unlike PackedPrimeField, it doesn't need the 52-bit multiplications, so
+  // any vector extension is faster than the scalar arithmetic.
+  constexpr static bool kIsAccelerated = Backend::kIsVectorized;
+
+  static_assert(sizeof(F) == sizeof(uint64_t),
+                "F should be laid out as its Montgomery form");
+
+  PackedGoldilocks() : value_(Backend::Zero()) {}
+
+  static PackedGoldilocks Zero() { return PackedGoldilocks(); }
+
+  static PackedGoldilocks One() { return Broadcast(F::One()); }
+
+  static PackedGoldilocks Broadcast(const F& value) {
+    return PackedGoldilocks(Backend::Broadcast(value.value()[0]));
+  }
+
+  // Loads |kLanes| elements from |values|.
+  static PackedGoldilocks Load(const F* values) {
+    return PackedGoldilocks(
+        Backend::Load(reinterpret_cast<const uint64_t*>(values)));
+  }
+
+  static PackedGoldilocks Load(absl::Span<const F> values) {
+    CHECK_EQ(values.size(), Lanes);
+    return Load(values.data());
+  }
+
+  // Stores |kLanes| elements to |values|.
+  void Store(F* values) const {
+    Backend::Store(reinterpret_cast<uint64_t*>(values), value_);
+  }
+
+  void Store(absl::Span<F> values) const {
+    CHECK_EQ(values.size(), Lanes);
+    Store(values.data());
+  }
+
+  // Computes the inverses of |values| into |inverses| with Montgomery's trick.
+  // The i-th element belongs to the chain of the (i mod |kLanes|)-th lane, so
+  // that the |kLanes| chains of the prefix products are multiplied at once,
+  // and only |kLanes| scalar inversions are needed at the end. Every inverse is
+  // multiplied by |coeff|, and the inverse of zero is zero. This backs
+  // MultiplicativeGroup::BatchInverse() of the Goldilocks PrimeField.
+  [[nodiscard]] static bool BatchInverse(absl::Span<const F> values,
+                                         absl::Span<F> inverses,
+                                         const F& coeff = F::One()) {
+    if (values.size() != inverses.size()) {
+      LOG(ERROR) << "Size of |values| and |inverses| do not match";
+      return false;
+    }
+    size_t num_rows = values.size() / Lanes;
+    PackedGoldilocks one = One();
+
+    // First pass: |products[i]| = a₀ * a₁ * ... * aᵢ, where aᵢ is the i-th row
+    // whose zeros are replaced with ones.
+    std::vector<PackedGoldilocks> products;
+    products.reserve(num_rows);
+    PackedGoldilocks product = one;
+    for (size_t i = 0; i < num_rows; ++i) {
+      product *= Load(&values[i * Lanes]).ReplaceZeros(one);
+      products.push_back(product);
+    }
+
+    // c * (a₀ * a₁ * ... * aₙ₋₁)⁻¹
+    F product_invs[Lanes];
+    product.Store(product_invs);
+    for (F& product_inv : product_invs) {
+      product_inv.InverseInPlace();
+      if (!coeff.IsOne()) product_inv *= coeff;
+    }
+    PackedGoldilocks inv = Load(product_invs);
+
+    // Second pass: c * aᵢ⁻¹ = c * (a₀ * ... * aᵢ)⁻¹ * (a₀ * ... * aᵢ₋₁).
+    for (size_t i = num_rows - 1; i != SIZE_MAX; --i) {
+      PackedGoldilocks row = Load(&values[i * Lanes]);
+      PackedGoldilocks zero_mask(Backend::Equal(row.value_, Backend::Zero()));
+      PackedGoldilocks row_inv = i == 0 ? inv : inv * products[i - 1];
+      inv *= row.ReplaceZeros(one);
+      PackedGoldilocks(Backend::AndNot(zero_mask.value_, row_inv.value_))
+          .Store(&inverses[i * Lanes]);
+    }
+
+    for (size_t i = num_rows * Lanes; i < values.size(); ++i) {
+      inverses[i] =
+          values[i].IsZero() ? F::Zero() : coeff * values[i].Inverse();
+    }
+    return true;
+  }
+
+  PackedGoldilocks operator+(const PackedGoldilocks& other) const {
+    PackedGoldilocks ret = *this;
+    return ret.AddInPlace(other);
+  }
+
+  PackedGoldilocks& operator+=(const PackedGoldilocks& other) {
+    return AddInPlace(other);
+  }
+
+  PackedGoldilocks operator-(const PackedGoldilocks& other) const {
+    PackedGoldilocks ret = *this;
+    return ret.SubInPlace(other);
+  }
+
+  PackedGoldilocks& operator-=(const PackedGoldilocks& other) {
+    return SubInPlace(other);
+  }
+
+  PackedGoldilocks operator-() const {
+    PackedGoldilocks ret = *this;
+    return ret.NegInPlace();
+  }
+
+  PackedGoldilocks operator*(const PackedGoldilocks& other) const {
+    PackedGoldilocks ret = *this;
+    return ret.MulInPlace(other);
+  }
+
+  PackedGoldilocks& operator*=(const PackedGoldilocks& other) {
+    return MulInPlace(other);
+  }
+
+  PackedGoldilocks& AddInPlace(const PackedGoldilocks& other) {
+    Vec sum = Backend::Add(value_, other.value_);
+    Vec carry = Backend::LessThan(sum, value_);
+    // If it carried or |sum| ≥ p, the result is |sum| + 2⁶⁴ - p modulo 2⁶⁴.
+    // Note that |sum| + 2⁶⁴ - p overflows if and only if |sum| ≥ p.
+    Vec reduced = Backend::Add(sum, Backend::Broadcast(kEpsilon));
+    Vec mask = Backend::Or(carry, Backend::LessThan(reduced, sum));
+    value_ = Backend::Or(Backend::And(mask, reduced),
+                         Backend::AndNot(mask, sum));
+    return *this;
+  }
+
+  PackedGoldilocks& DoubleInPlace() { return AddInPlace(*this); }
+
+  PackedGoldilocks Double() const {
+    PackedGoldilocks ret = *this;
+    return ret.DoubleInPlace();
+  }
+
+  PackedGoldilocks& SubInPlace(const PackedGoldilocks& other) {
+    Vec borrow = Backend::LessThan(value_, other.value_);
+    // If it borrowed, p is added back, which is subtracting 2⁶⁴ - p modulo
+    // 2⁶⁴.
+    value_ = Backend::Sub(Backend::Sub(value_, other.value_),
+                          Backend::And(borrow, Backend::Broadcast(kEpsilon)));
+    return *this;
+  }
+
+  PackedGoldilocks& NegInPlace() {
+    Vec zero_mask = Backend::Equal(value_, Backend::Zero());
+    value_ = Backend::AndNot(
+        zero_mask, Backend::Sub(Backend::Broadcast(kModulus), value_));
+    return *this;
+  }
+
+  PackedGoldilocks& MulInPlace(const PackedGoldilocks& other) {
+    const Vec& a = value_;
+    const Vec& b = other.value_;
+    Vec mask = Backend::Broadcast(kMask32);
+
+    // |a| * |b| = (a_hi * 2³² + a_lo) * (b_hi * 2³² + b_lo)
+    Vec a_hi = Backend::ShiftRight(a, 32);
+    Vec b_hi = Backend::ShiftRight(b, 32);
+    Vec lo_lo = Backend::MulU32(a, b);
+    Vec lo_hi = Backend::MulU32(a, b_hi);
+    Vec hi_lo = Backend::MulU32(a_hi, b);
+    Vec hi_hi = Backend::MulU32(a_hi, b_hi);
+    // Neither of the sums below overflows, since (2³² - 1)² + 2 * (2³² - 1) <
+    // 2⁶⁴.
+    Vec mid = Backend::Add(lo_hi, Backend::ShiftRight(lo_lo, 32));
+    Vec mid2 = Backend::Add(hi_lo, Backend::And(mid, mask));
+    Vec lo =
+        Backend::Or(Backend::ShiftLeft(mid2, 32), Backend::And(lo_lo, mask));
+    Vec hi = Backend::Add(hi_hi, Backend::Add(Backend::ShiftRight(mid, 32),
+                                              Backend::ShiftRight(mid2, 32)));
+    value_ = MontgomeryReduce(lo, hi);
+    return *this;
+  }
+
+  PackedGoldilocks& SquareInPlace() { return MulInPlace(*this); }
+
+  PackedGoldilocks Square() const {
+    PackedGoldilocks ret = *this;
+    return ret.SquareInPlace();
+  }
+
+ private:
+  explicit PackedGoldilocks(Vec value) : value_(value) {}
+
+  // The vectorized GoldilocksMontgomeryReduce().
+  static Vec MontgomeryReduce(Vec lo, Vec hi) {
+    Vec m = Backend::Add(lo, Backend::ShiftLeft(lo, 32));
+    // Adding the mask of the carry subtracts the carry.
+    Vec mp_hi = Backend::Add(Backend::Sub(m, Backend::ShiftRight(m, 32)),
+                             Backend::LessThan(m, lo));
+    Vec borrow = Backend::LessThan(hi, mp_hi);
+    return Backend::Sub(Backend::Sub(hi, mp_hi),
+                        Backend::And(borrow, Backend::Broadcast(kEpsilon)));
+  }
+
+  // Returns a copy of this, where the zero lanes are replaced with |one|.
+  PackedGoldilocks ReplaceZeros(const PackedGoldilocks& one) const {
+    Vec zero_mask = Backend::Equal(value_, Backend::Zero());
+    return PackedGoldilocks(Backend::Or(Backend::And(zero_mask, one.value_),
+                                        Backend::AndNot(zero_mask, value_)));
+  }
+
+  constexpr static uint64_t kModulus = internal::kGoldilocksModulus;
+  constexpr static uint64_t kEpsilon = internal::kGoldilocksEpsilon;
+  constexpr static uint64_t kMask32 = (uint64_t{1} << 32) - 1;
+
+  Vec value_;
+};
+
+}  // namespace tachyon::math
+
+#endif  // TACHYON_MATH_FINITE_FIELDS_GOLDILOCKS_PRIME_PACKED_GOLDILOCKS_H_
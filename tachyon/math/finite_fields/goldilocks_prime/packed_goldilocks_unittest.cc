@@ -0,0 +1,152 @@
+#include "tachyon/math/finite_fields/goldilocks_prime/packed_goldilocks.h"
+
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "tachyon/base/containers/container_util.h"
+#include "tachyon/math/finite_fields/goldilocks_prime/goldilocks.h"
+#include "tachyon/math/finite_fields/test/finite_field_test.h"
+
+namespace tachyon::math {
+
+namespace {
+
+template <typename PackedF>
+class PackedGoldilocksTest : public FiniteFieldTest<typename PackedF::Field> {
+};
+
+}  // namespace
+
+// The native lanes run on AVX-512 or AVX2 if the target is compiled with
+// them, and 2 lanes always run on the portable implementation.
+using PackedGoldilocksTypes = testing::Types<PackedGoldilocks<Goldilocks>,
+                                             PackedGoldilocks<Goldilocks, 2>>;
+
+TYPED_TEST_SUITE(PackedGoldilocksTest, PackedGoldilocksTypes);
+
+// The scalar multiplication of Goldilocks goes through
+// GoldilocksMontgomeryReduce() as well.
+TEST(GoldilocksMontgomeryTest, Mul) {
+  Goldilocks::Init();
+  mpz_class modulus("18446744069414584321");
+  std::vector<Goldilocks> values = {Goldilocks::Zero(), Goldilocks::One(),
+                                    -Goldilocks::One(),
+                                    Goldilocks(uint64_t{1} << 32)};
+  for (size_t i = 0; i < 100; ++i) {
+    values.push_back(Goldilocks::Random());
+  }
+  for (const Goldilocks& a : values) {
+    for (const Goldilocks& b : values) {
+      EXPECT_EQ((a * b).ToMpzClass(),
+                mpz_class(a.ToMpzClass() * b.ToMpzClass() % modulus));
+    }
+  }
+}
+
+TYPED_TEST(PackedGoldilocksTest, LoadAndStore) {
+  using PackedF = TypeParam;
+  using F = typename PackedF::Field;
+
+  std::vector<F> values = base::CreateVector(PackedF::kLanes, [](size_t i) {
+    return i == 0 ? -F::One() : F::Random();
+  });
+  std::vector<F> stored(PackedF::kLanes);
+  PackedF::Load(absl::MakeConstSpan(values)).Store(absl::MakeSpan(stored));
+  EXPECT_EQ(stored, values);
+
+  PackedF::Broadcast(values[1]).Store(absl::MakeSpan(stored));
+  EXPECT_EQ(stored, std::vector<F>(PackedF::kLanes, values[1]));
+}
+
+TYPED_TEST(PackedGoldilocksTest, Operations) {
+  using PackedF = TypeParam;
+  using F = typename PackedF::Field;
+
+  for (size_t iter = 0; iter < 100; ++iter) {
+    std::vector<F> a = base::CreateVector(PackedF::kLanes, []() {
+      return F::Random();
+    });
+    std::vector<F> b = base::CreateVector(PackedF::kLanes, []() {
+      return F::Random();
+    });
+    // Covers the edge cases in the first lanes.
+    if (iter == 0) {
+      a[0] = F::Zero();
+      b[0] = -F::One();
+      a[1] = -F::One();
+      b[1] = -F::One();
+    }
+    PackedF packed_a = PackedF::Load(a.data());
+    PackedF packed_b = PackedF::Load(b.data());
+
+    std::vector<F> results(PackedF::kLanes);
+    auto expect_each = [&](const PackedF& packed, auto fn) {
+      packed.Store(results.data());
+      for (size_t i = 0; i < PackedF::kLanes; ++i) {
+        EXPECT_EQ(results[i], fn(a[i], b[i]));
+      }
+    };
+    expect_each(packed_a + packed_b,
+                [](const F& x, const F& y) { return x + y; });
+    expect_each(packed_a - packed_b,
+                [](const F& x, const F& y) { return x - y; });
+    expect_each(packed_b - packed_a,
+                [](const F& x, const F& y) { return y - x; });
+    expect_each(-packed_a, [](const F& x, const F& y) { return -x; });
+    expect_each(packed_a.Double(),
+                [](const F& x, const F& y) { return x.Double(); });
+    expect_each(packed_a * packed_b,
+                [](const F& x, const F& y) { return x * y; });
+    expect_each(packed_a.Square(),
+                [](const F& x, const F& y) { return x.Square(); });
+  }
+}
+
+TYPED_TEST(PackedGoldilocksTest, BatchInverse) {
+  using PackedF = TypeParam;
+  using F = typename PackedF::Field;
+
+  // Leaves a tail that doesn't fill the lanes.
+  std::vector<F> values = base::CreateVector(
+      4 * PackedF::kLanes + 1, [](size_t i) {
+        return i % 5 == 3 ? F::Zero() : F::Random();
+      });
+  F coeff = F::Random();
+  std::vector<F> inverses(values.size());
+  ASSERT_TRUE(PackedF::BatchInverse(values, absl::MakeSpan(inverses), coeff));
+  for (size_t i = 0; i < values.size(); ++i) {
+    if (values[i].IsZero()) {
+      EXPECT_TRUE(inverses[i].IsZero());
+    } else {
+      EXPECT_EQ(inverses[i], coeff * values[i].Inverse());
+    }
+  }
+
+  std::vector<F> wrong_size(values.size() - 1);
+  EXPECT_FALSE(PackedF::BatchInverse(values, absl::MakeSpan(wrong_size)));
+}
+
+// Goldilocks::BatchInverse() runs on PackedGoldilocks if the target has a
+// vector extension for it.
+TEST(GoldilocksBatchInverseTest, MultiplicativeGroup) {
+  Goldilocks::Init();
+  EXPECT_EQ(internal::SupportsPackedBatchInverse<Goldilocks>::value,
+            PackedGoldilocks<Goldilocks>::kIsAccelerated);
+
+  std::vector<Goldilocks> values = base::CreateVector(100, [](size_t i) {
+    return i % 7 == 2 ? Goldilocks::Zero() : Goldilocks::Random();
+  });
+  Goldilocks coeff = Goldilocks::Random();
+  std::vector<Goldilocks> inverses(values.size());
+  ASSERT_TRUE(Goldilocks::BatchInverse(values, &inverses, coeff));
+  for (size_t i = 0; i < values.size(); ++i) {
+    if (values[i].IsZero()) {
+      EXPECT_TRUE(inverses[i].IsZero());
+    } else {
+      EXPECT_EQ(inverses[i], coeff * values[i].Inverse());
+    }
+  }
+}
+
+}  // namespace tachyon::math
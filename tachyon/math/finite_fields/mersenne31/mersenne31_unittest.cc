@@ -0,0 +1,38 @@
+#include "gtest/gtest.h"
+
+#include "tachyon/math/finite_fields/mersenne31/mersenne31_2.h"
+#include "tachyon/math/finite_fields/test/finite_field_test.h"
+
+namespace tachyon::math {
+
+namespace {
+
+class Mersenne31_2Test : public FiniteFieldTest<Mersenne31_2> {};
+
+}  // namespace
+
+TEST_F(Mersenne31_2Test, NonResidue) {
+  // i² = -1
+  Mersenne31_2 i(Mersenne31::Zero(), Mersenne31::One());
+  EXPECT_EQ(i.Square(), -Mersenne31_2::One());
+}
+
+TEST_F(Mersenne31_2Test, MultiplicativeOperators) {
+  for (size_t i = 0; i < 10; ++i) {
+    Mersenne31_2 a = Mersenne31_2::Random();
+    Mersenne31_2 b = Mersenne31_2::Random();
+    EXPECT_EQ(a * b, b * a);
+    EXPECT_EQ(a.Square(), a * a);
+    EXPECT_TRUE((a * a.Inverse()).IsOne());
+    EXPECT_EQ((a * b) / b, a);
+  }
+}
+
+TEST_F(Mersenne31_2Test, Frobenius) {
+  Mersenne31_2 a = Mersenne31_2::Random();
+  Mersenne31_2 frobenius = a;
+  frobenius.FrobeniusMapInPlace(1);
+  EXPECT_EQ(frobenius, a.Pow(Mersenne31::Config::kModulus));
+}
+
+}  // namespace tachyon::math
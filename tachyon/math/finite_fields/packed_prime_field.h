@@ -0,0 +1,361 @@
+#ifndef TACHYON_MATH_FINITE_FIELDS_PACKED_PRIME_FIELD_H_
+#define TACHYON_MATH_FINITE_FIELDS_PACKED_PRIME_FIELD_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <array>
+#include <type_traits>
+
+#include "absl/types/span.h"
+
+#include "tachyon/base/logging.h"
+#include "tachyon/math/base/big_int.h"
+#include "tachyon/math/finite_fields/finite_field_forwards.h"
+#include "tachyon/math/finite_fields/goldilocks_prime/packed_goldilocks.h"
+#include "tachyon/math/finite_fields/packed_small_prime_field.h"
+#include "tachyon/math/finite_fields/packed_u64.h"
+
+namespace tachyon::math {
+
+namespace internal {
+
+// Splits the little-endian 64-bit limbs of |value| into |L| 52-bit limbs.
+template <size_t L, size_t N>
+constexpr std::array<uint64_t, L> ToLimbs52(const BigInt<N>& value) {
+  constexpr uint64_t kMask = (uint64_t{1} << 52) - 1;
+  std::array<uint64_t, L> ret = {};
+  for (size_t k = 0; k < L; ++k) {
+    size_t bit = k * 52;
+    size_t word = bit / 64;
+    size_t offset = bit % 64;
+    if (word >= N) break;
+    uint64_t limb = value[word] >> offset;
+    if (offset > 12 && word + 1 < N) {
+      limb |= value[word + 1] << (64 - offset);
+    }
+    ret[k] = limb & kMask;
+  }
+  return ret;
+}
+
+}  // namespace internal
+
+// PackedPrimeField holds |Lanes| elements of a prime field |F| in the
+// struct-of-arrays layout: the k-th limb of every lane is kept in a single
+// vector register, and the elements are split into limbs of 52 bits so that
+// the multiplication maps onto VPMADD52LUQ/VPMADD52HUQ of AVX-512 IFMA. See
+// PackedU64 for the AVX2 and the portable fallback.
+//
+// The elements stay in the Montgomery form of |F|, aR mod p where R = 2⁶⁴ᴺ,
+// so that loading and storing only repack the bits. The Montgomery reduction
+// with 52-bit limbs divides by R' = 2⁵²ᴸ instead, where L is |kLimbNums|. So
+// one of the operands is shifted left by 52L - 64N bits beforehand:
+//
+//   REDC(a * 2⁵²ᴸ⁻⁶⁴ᴺ * b) = a * b * 2⁵²ᴸ⁻⁶⁴ᴺ / 2⁵²ᴸ = a * b / R
+template <typename F, size_t Lanes = internal::kNativePackedLanes>
+class PackedPrimeField {
+ public:
+  using Field = F;
+  using Config = typename F::Config;
+  using Backend = internal::PackedU64<Lanes>;
+  using Vec = typename Backend::Vec;
+
+  constexpr static size_t N = F::N;
+  constexpr static size_t kLanes = Lanes;
+  constexpr static size_t kLimbBits = 52;
+  // It has at least a spare bit so that a sum of 2 elements fits.
+  constexpr static size_t kLimbNums = 64 * N / kLimbBits + 1;
+  constexpr static int kShift = kLimbBits * kLimbNums - 64 * N;
+  constexpr static uint64_t kLimbMask = (uint64_t{1} << kLimbBits) - 1;
+
+  static_assert(kLimbNums <= 16, "The accumulator may overflow");
+  static_assert(sizeof(F) == sizeof(uint64_t) * N,
+                "F should be laid out as its Montgomery form");
+
+  PackedPrimeField() {
+    for (Vec& limb : limbs_) {
+      limb = Backend::Zero();
+    }
+  }
+
+  static PackedPrimeField Zero() { return PackedPrimeField(); }
+
+  static PackedPrimeField Broadcast(const F& value) {
+    std::array<uint64_t, kLimbNums> limbs =
+        internal::ToLimbs52<kLimbNums>(value.value());
+    PackedPrimeField ret;
+    for (size_t k = 0; k < kLimbNums; ++k) {
+      ret.limbs_[k] = Backend::Broadcast(limbs[k]);
+    }
+    return ret;
+  }
+
+  // Loads |kLanes| elements from |values|. The k-th words of the elements
+  // are gathered into a vector, and then they are repacked into the 52-bit
+  // limbs all lanes at once.
+  static PackedPrimeField Load(const F* values) {
+    const uint64_t* words = reinterpret_cast<const uint64_t*>(values);
+    std::array<Vec, N> w;
+    for (size_t i = 0; i < N; ++i) {
+      w[i] = Backend::Gather(words + i, N);
+    }
+    Vec mask = Backend::Broadcast(kLimbMask);
+    PackedPrimeField ret;
+    for (size_t k = 0; k < kLimbNums; ++k) {
+      size_t bit = k * kLimbBits;
+      size_t word = bit / 64;
+      int offset = static_cast<int>(bit % 64);
+      if (word >= N) break;
+      Vec limb = Backend::ShiftRight(w[word], offset);
+      if (offset > 64 - static_cast<int>(kLimbBits) && word + 1 < N) {
+        limb = Backend::Or(limb, Backend::ShiftLeft(w[word + 1], 64 - offset));
+      }
+      ret.limbs_[k] = Backend::And(limb, mask);
+    }
+    return ret;
+  }
+
+  static PackedPrimeField Load(absl::Span<const F> values) {
+    CHECK_EQ(values.size(), Lanes);
+    return Load(values.data());
+  }
+
+  // Stores |kLanes| elements to |values|.
+  void Store(F* values) const {
+    std::array<Vec, N> w;
+    for (Vec& word : w) {
+      word = Backend::Zero();
+    }
+    for (size_t k = 0; k < kLimbNums; ++k) {
+      size_t bit = k * kLimbBits;
+      size_t word = bit / 64;
+      int offset = static_cast<int>(bit % 64);
+      if (word >= N) break;
+      w[word] = Backend::Or(w[word], Backend::ShiftLeft(limbs_[k], offset));
+      if (offset > 64 - static_cast<int>(kLimbBits) && word + 1 < N) {
+        w[word + 1] = Backend::Or(w[word + 1],
+                                  Backend::ShiftRight(limbs_[k], 64 - offset));
+      }
+    }
+    uint64_t* words = reinterpret_cast<uint64_t*>(values);
+    for (size_t i = 0; i < N; ++i) {
+      Backend::Scatter(words + i, N, w[i]);
+    }
+  }
+
+  void Store(absl::Span<F> values) const {
+    CHECK_EQ(values.size(), Lanes);
+    Store(values.data());
+  }
+
+  PackedPrimeField operator+(const PackedPrimeField& other) const {
+    PackedPrimeField ret = *this;
+    return ret.AddInPlace(other);
+  }
+
+  PackedPrimeField& operator+=(const PackedPrimeField& other) {
+    return AddInPlace(other);
+  }
+
+  PackedPrimeField operator-(const PackedPrimeField& other) const {
+    PackedPrimeField ret = *this;
+    return ret.SubInPlace(other);
+  }
+
+  PackedPrimeField& operator-=(const PackedPrimeField& other) {
+    return SubInPlace(other);
+  }
+
+  PackedPrimeField operator-() const {
+    PackedPrimeField ret;
+    return ret.SubInPlace(*this);
+  }
+
+  PackedPrimeField operator*(const PackedPrimeField& other) const {
+    PackedPrimeField ret = *this;
+    return ret.MulInPlace(other);
+  }
+
+  PackedPrimeField& operator*=(const PackedPrimeField& other) {
+    return MulInPlace(other);
+  }
+
+  PackedPrimeField& AddInPlace(const PackedPrimeField& other) {
+    for (size_t k = 0; k < kLimbNums; ++k) {
+      limbs_[k] = Backend::Add(limbs_[k], other.limbs_[k]);
+    }
+    Normalize(limbs_);
+    SubModulusIfGreaterOrEqual(limbs_);
+    return *this;
+  }
+
+  PackedPrimeField& DoubleInPlace() { return AddInPlace(*this); }
+
+  PackedPrimeField Double() const {
+    PackedPrimeField ret = *this;
+    return ret.DoubleInPlace();
+  }
+
+  PackedPrimeField& SubInPlace(const PackedPrimeField& other) {
+    Vec borrow = Backend::Zero();
+    for (size_t k = 0; k < kLimbNums; ++k) {
+      Vec diff =
+          Backend::Sub(Backend::Sub(limbs_[k], other.limbs_[k]), borrow);
+      borrow = Backend::ShiftRight(diff, 63);
+      limbs_[k] = Backend::And(diff, Backend::Broadcast(kLimbMask));
+    }
+    // If it borrowed, p is added back.
+    Vec mask = Backend::Sub(Backend::Zero(), borrow);
+    for (size_t k = 0; k < kLimbNums; ++k) {
+      limbs_[k] = Backend::Add(
+          limbs_[k], Backend::And(mask, Backend::Broadcast(kModulus[k])));
+    }
+    Normalize(limbs_);
+    // Drops the carry out of the last limb, which cancels the borrow above.
+    limbs_[kLimbNums - 1] =
+        Backend::And(limbs_[kLimbNums - 1], Backend::Broadcast(kLimbMask));
+    return *this;
+  }
+
+  PackedPrimeField& NegInPlace() {
+    *this = -*this;
+    return *this;
+  }
+
+  // Montgomery multiplication with CIOS(Coarsely Integrated Operand
+  // Scanning). A limb of the accumulator collects at most a few dozen 52-bit
+  // values in its 64 bits, so only the carry out of t₀ is propagated in the
+  // loop, and the rest are propagated at the end.
+  PackedPrimeField& MulInPlace(const PackedPrimeField& other) {
+    std::array<Vec, kLimbNums> a = ShiftLeftLimbs(limbs_);
+    const std::array<Vec, kLimbNums>& b = other.limbs_;
+    Vec inverse = Backend::Broadcast(kInverse52);
+
+    std::array<Vec, kLimbNums + 1> t;
+    for (Vec& limb : t) {
+      limb = Backend::Zero();
+    }
+    for (size_t i = 0; i < kLimbNums; ++i) {
+      for (size_t j = 0; j < kLimbNums; ++j) {
+        Backend::MAdd52(t[j], t[j + 1], a[j], b[i]);
+      }
+      Vec m = Backend::MulLo52(t[0], inverse);
+      for (size_t j = 0; j < kLimbNums; ++j) {
+        Backend::MAdd52(t[j], t[j + 1], m, Backend::Broadcast(kModulus[j]));
+      }
+      // The lower 52 bits of t₀ are zero now.
+      t[1] = Backend::Add(t[1], Backend::ShiftRight(t[0], kLimbBits));
+      for (size_t j = 0; j < kLimbNums; ++j) {
+        t[j] = t[j + 1];
+      }
+      t[kLimbNums] = Backend::Zero();
+    }
+    for (size_t k = 0; k < kLimbNums; ++k) {
+      limbs_[k] = t[k];
+    }
+    Normalize(limbs_);
+    SubModulusIfGreaterOrEqual(limbs_);
+    return *this;
+  }
+
+  PackedPrimeField& SquareInPlace() { return MulInPlace(*this); }
+
+  PackedPrimeField Square() const {
+    PackedPrimeField ret = *this;
+    return ret.SquareInPlace();
+  }
+
+ private:
+  // Propagates the carries so that every limb but the last is less than 2⁵².
+  static void Normalize(std::array<Vec, kLimbNums>& limbs) {
+    Vec mask = Backend::Broadcast(kLimbMask);
+    for (size_t k = 0; k < kLimbNums - 1; ++k) {
+      limbs[k + 1] = Backend::Add(
+          limbs[k + 1], Backend::ShiftRight(limbs[k], kLimbBits));
+      limbs[k] = Backend::And(limbs[k], mask);
+    }
+  }
+
+  // Subtracts p from |limbs| in each lane where |limbs| ≥ p. |limbs| should
+  // be normalized and less than 2p.
+  static void SubModulusIfGreaterOrEqual(std::array<Vec, kLimbNums>& limbs) {
+    Vec mask = Backend::Broadcast(kLimbMask);
+    std::array<Vec, kLimbNums> diff;
+    Vec borrow = Backend::Zero();
+    for (size_t k = 0; k < kLimbNums; ++k) {
+      diff[k] = Backend::Sub(
+          Backend::Sub(limbs[k], Backend::Broadcast(kModulus[k])), borrow);
+      borrow = Backend::ShiftRight(diff[k], 63);
+      diff[k] = Backend::And(diff[k], mask);
+    }
+    // If it borrowed, |limbs| < p and it is kept.
+    Vec keep = Backend::Sub(Backend::Zero(), borrow);
+    for (size_t k = 0; k < kLimbNums; ++k) {
+      limbs[k] = Backend::Or(Backend::And(keep, limbs[k]),
+                             Backend::AndNot(keep, diff[k]));
+    }
+  }
+
+  // Returns |limbs| * 2^|kShift|, which is less than 2⁵²ᴸ.
+  static std::array<Vec, kLimbNums> ShiftLeftLimbs(
+      const std::array<Vec, kLimbNums>& limbs) {
+    Vec mask = Backend::Broadcast(kLimbMask);
+    std::array<Vec, kLimbNums> ret;
+    ret[0] = Backend::And(Backend::ShiftLeft(limbs[0], kShift), mask);
+    for (size_t k = 1; k < kLimbNums; ++k) {
+      ret[k] = Backend::And(
+          Backend::Or(Backend::ShiftLeft(limbs[k], kShift),
+                      Backend::ShiftRight(limbs[k - 1], kLimbBits - kShift)),
+          mask);
+    }
+    return ret;
+  }
+
+  constexpr static std::array<uint64_t, kLimbNums> kModulus =
+      internal::ToLimbs52<kLimbNums>(Config::kModulus);
+  // -p⁻¹ mod 2⁵²
+  constexpr static uint64_t kInverse52 = Config::kInverse64 & kLimbMask;
+
+  std::array<Vec, kLimbNums> limbs_;
+};
+
+// PackedPrimeFieldTraits<F>::kIsAccelerated tells whether |F| is packed into
+// SIMD registers on this target, in which case PackedPrimeFieldTraits<F>::
+// Packed is the packed type. Otherwise, the callers should stick to |F|.
+template <typename F, typename SFINAE = void>
+struct PackedPrimeFieldTraits {
+  constexpr static bool kIsAccelerated = false;
+};
+
+template <typename Config>
+struct PackedPrimeFieldTraits<
+    PrimeField<Config>,
+    std::enable_if_t<!Config::kIsSpecialPrime &&
+                     !internal::IsGoldilocksConfig<Config>()>> {
+  using Packed = PackedPrimeField<PrimeField<Config>>;
+
+  constexpr static bool kIsAccelerated = Packed::Backend::kIsAccelerated;
+};
+
+template <typename Config>
+struct PackedPrimeFieldTraits<
+    PrimeField<Config>,
+    std::enable_if_t<!Config::kIsSpecialPrime &&
+                     internal::IsGoldilocksConfig<Config>()>> {
+  using Packed = PackedGoldilocks<PrimeField<Config>>;
+
+  constexpr static bool kIsAccelerated = Packed::kIsAccelerated;
+};
+
+template <typename Config>
+struct PackedPrimeFieldTraits<PrimeField<Config>,
+                              std::enable_if_t<Config::kIsSmallPrime>> {
+  using Packed = PackedSmallPrimeField<PrimeField<Config>>;
+
+  constexpr static bool kIsAccelerated = Packed::kIsAccelerated;
+};
+
+}  // namespace tachyon::math
+
+#endif  // TACHYON_MATH_FINITE_FIELDS_PACKED_PRIME_FIELD_H_
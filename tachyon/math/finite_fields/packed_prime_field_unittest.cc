@@ -0,0 +1,94 @@
+#include "tachyon/math/finite_fields/packed_prime_field.h"
+
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "tachyon/base/containers/container_util.h"
+#include "tachyon/math/elliptic_curves/bls12/bls12_381/fq.h"
+#include "tachyon/math/elliptic_curves/bn/bn254/fr.h"
+#include "tachyon/math/elliptic_curves/secp/secp256k1/fq.h"
+#include "tachyon/math/finite_fields/test/finite_field_test.h"
+#include "tachyon/math/finite_fields/test/gf7.h"
+
+namespace tachyon::math {
+
+namespace {
+
+template <typename PackedF>
+class PackedPrimeFieldTest
+    : public FiniteFieldTest<typename PackedF::Field> {};
+
+}  // namespace
+
+// The native lanes run on AVX-512 IFMA or AVX2 if the target is compiled with
+// them, and 2 lanes always run on the portable implementation.
+using PackedPrimeFieldTypes =
+    testing::Types<PackedPrimeField<GF7>, PackedPrimeField<bn254::Fr>,
+                   PackedPrimeField<secp256k1::Fq>,
+                   PackedPrimeField<bls12_381::Fq>,
+                   PackedPrimeField<bn254::Fr, 2>,
+                   PackedPrimeField<bls12_381::Fq, 2>>;
+
+TYPED_TEST_SUITE(PackedPrimeFieldTest, PackedPrimeFieldTypes);
+
+TYPED_TEST(PackedPrimeFieldTest, LoadAndStore) {
+  using PackedF = TypeParam;
+  using F = typename PackedF::Field;
+
+  std::vector<F> values = base::CreateVector(PackedF::kLanes, [](size_t i) {
+    return i == 0 ? -F::One() : F::Random();
+  });
+  std::vector<F> stored(PackedF::kLanes);
+  PackedF::Load(absl::MakeConstSpan(values)).Store(absl::MakeSpan(stored));
+  EXPECT_EQ(stored, values);
+
+  PackedF::Broadcast(values[1]).Store(absl::MakeSpan(stored));
+  EXPECT_EQ(stored, std::vector<F>(PackedF::kLanes, values[1]));
+}
+
+TYPED_TEST(PackedPrimeFieldTest, Operations) {
+  using PackedF = TypeParam;
+  using F = typename PackedF::Field;
+
+  for (size_t iter = 0; iter < 100; ++iter) {
+    std::vector<F> a = base::CreateVector(PackedF::kLanes, []() {
+      return F::Random();
+    });
+    std::vector<F> b = base::CreateVector(PackedF::kLanes, []() {
+      return F::Random();
+    });
+    // Covers the edge cases in the first lanes.
+    if (iter == 0) {
+      a[0] = F::Zero();
+      b[0] = -F::One();
+      a[1] = -F::One();
+      b[1] = -F::One();
+    }
+    PackedF packed_a = PackedF::Load(a.data());
+    PackedF packed_b = PackedF::Load(b.data());
+
+    std::vector<F> results(PackedF::kLanes);
+    auto expect_each = [&](const PackedF& packed, auto fn) {
+      packed.Store(results.data());
+      for (size_t i = 0; i < PackedF::kLanes; ++i) {
+        EXPECT_EQ(results[i], fn(a[i], b[i]));
+      }
+    };
+    expect_each(packed_a + packed_b,
+                [](const F& x, const F& y) { return x + y; });
+    expect_each(packed_a - packed_b,
+                [](const F& x, const F& y) { return x - y; });
+    expect_each(packed_b - packed_a,
+                [](const F& x, const F& y) { return y - x; });
+    expect_each(-packed_a, [](const F& x, const F& y) { return -x; });
+    expect_each(packed_a.Double(),
+                [](const F& x, const F& y) { return x.Double(); });
+    expect_each(packed_a * packed_b,
+                [](const F& x, const F& y) { return x * y; });
+    expect_each(packed_a.Square(),
+                [](const F& x, const F& y) { return x.Square(); });
+  }
+}
+
+}  // namespace tachyon::math
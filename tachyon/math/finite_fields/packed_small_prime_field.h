@@ -0,0 +1,252 @@
+#ifndef TACHYON_MATH_FINITE_FIELDS_PACKED_SMALL_PRIME_FIELD_H_
+#define TACHYON_MATH_FINITE_FIELDS_PACKED_SMALL_PRIME_FIELD_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <vector>
+
+#include "absl/types/span.h"
+
+#include "tachyon/base/logging.h"
+#include "tachyon/math/finite_fields/packed_u32.h"
+#include "tachyon/math/finite_fields/small_prime_field.h"
+
+namespace tachyon::math {
+
+// PackedSmallPrimeField holds |Lanes| elements of a prime field |F| less than
+// 2³¹, e.g., BabyBear and Mersenne-31, in a single vector register. The
+// elements are kept in the internal form of |F| (see small_prime_field.h), so
+// that loading and storing are plain vector moves.
+//
+// Since the sum of two elements fits in 32 bits, the additions are reduced
+// with an unsigned minimum: min(s, s - p) is s - p if s ≥ p, and s otherwise,
+// where s - p wraps around. The 64-bit products of the even and the odd lanes
+// are computed and reduced separately, and then blended.
+template <typename F, size_t Lanes = internal::kNativeVectorLanes32>
+class PackedSmallPrimeField {
+ public:
+  using Field = F;
+  using Backend = internal::PackedU32<Lanes>;
+  using Vec = typename Backend::Vec;
+
+  constexpr static size_t kLanes = Lanes;
+  // The scalar arithmetic processes a single element per instruction, so any
+  // vector extension is faster than it.
+  constexpr static bool kIsAccelerated = Backend::kIsVectorized;
+
+  static_assert(sizeof(F) == sizeof(uint32_t),
+                "F should be laid out as its internal form");
+
+  PackedSmallPrimeField() : value_(Backend::Zero()) {}
+
+  static PackedSmallPrimeField Zero() { return PackedSmallPrimeField(); }
+
+  static PackedSmallPrimeField One() { return Broadcast(F::One()); }
+
+  static PackedSmallPrimeField Broadcast(const F& value) {
+    return PackedSmallPrimeField(Backend::Broadcast(value.value()));
+  }
+
+  // Loads |kLanes| elements from |values|.
+  static PackedSmallPrimeField Load(const F* values) {
+    return PackedSmallPrimeField(
+        Backend::Load(reinterpret_cast<const uint32_t*>(values)));
+  }
+
+  static PackedSmallPrimeField Load(absl::Span<const F> values) {
+    CHECK_EQ(values.size(), Lanes);
+    return Load(values.data());
+  }
+
+  // Stores |kLanes| elements to |values|.
+  void Store(F* values) const {
+    Backend::Store(reinterpret_cast<uint32_t*>(values), value_);
+  }
+
+  void Store(absl::Span<F> values) const {
+    CHECK_EQ(values.size(), Lanes);
+    Store(values.data());
+  }
+
+  // Computes the inverses of |values| into |inverses| with Montgomery's trick.
+  // The i-th element belongs to the chain of the (i mod |kLanes|)-th lane, so
+  // that the |kLanes| chains of the prefix products are multiplied at once,
+  // and only |kLanes| scalar inversions are needed at the end. The inverse of
+  // zero is zero.
+  [[nodiscard]] static bool BatchInverse(absl::Span<const F> values,
+                                         absl::Span<F> inverses) {
+    if (values.size() != inverses.size()) {
+      LOG(ERROR) << "Size of |values| and |inverses| do not match";
+      return false;
+    }
+    size_t num_rows = values.size() / Lanes;
+    PackedSmallPrimeField one = One();
+
+    // First pass: |products[i]| = a₀ * a₁ * ... * aᵢ, where aᵢ is the i-th row
+    // whose zeros are replaced with ones.
+    std::vector<PackedSmallPrimeField> products;
+    products.reserve(num_rows);
+    PackedSmallPrimeField product = one;
+    for (size_t i = 0; i < num_rows; ++i) {
+      product *= Load(&values[i * Lanes]).ReplaceZeros(one);
+      products.push_back(product);
+    }
+
+    // (a₀ * a₁ * ... * aₙ₋₁)⁻¹
+    F product_invs[Lanes];
+    product.Store(product_invs);
+    for (F& product_inv : product_invs) {
+      product_inv.InverseInPlace();
+    }
+    PackedSmallPrimeField inv = Load(product_invs);
+
+    // Second pass: aᵢ⁻¹ = (a₀ * ... * aᵢ)⁻¹ * (a₀ * ... * aᵢ₋₁).
+    for (size_t i = num_rows - 1; i != SIZE_MAX; --i) {
+      PackedSmallPrimeField row = Load(&values[i * Lanes]);
+      Vec zero_mask = Backend::Equal(row.value_, Backend::Zero());
+      PackedSmallPrimeField row_inv = i == 0 ? inv : inv * products[i - 1];
+      inv *= row.ReplaceZeros(one);
+      PackedSmallPrimeField(Backend::AndNot(zero_mask, row_inv.value_))
+          .Store(&inverses[i * Lanes]);
+    }
+
+    for (size_t i = num_rows * Lanes; i < values.size(); ++i) {
+      inverses[i] = values[i].Inverse();
+    }
+    return true;
+  }
+
+  PackedSmallPrimeField operator+(const PackedSmallPrimeField& other) const {
+    PackedSmallPrimeField ret = *this;
+    return ret.AddInPlace(other);
+  }
+
+  PackedSmallPrimeField& operator+=(const PackedSmallPrimeField& other) {
+    return AddInPlace(other);
+  }
+
+  PackedSmallPrimeField operator-(const PackedSmallPrimeField& other) const {
+    PackedSmallPrimeField ret = *this;
+    return ret.SubInPlace(other);
+  }
+
+  PackedSmallPrimeField& operator-=(const PackedSmallPrimeField& other) {
+    return SubInPlace(other);
+  }
+
+  PackedSmallPrimeField operator-() const {
+    PackedSmallPrimeField ret = *this;
+    return ret.NegInPlace();
+  }
+
+  PackedSmallPrimeField operator*(const PackedSmallPrimeField& other) const {
+    PackedSmallPrimeField ret = *this;
+    return ret.MulInPlace(other);
+  }
+
+  PackedSmallPrimeField& operator*=(const PackedSmallPrimeField& other) {
+    return MulInPlace(other);
+  }
+
+  PackedSmallPrimeField& AddInPlace(const PackedSmallPrimeField& other) {
+    Vec sum = Backend::Add(value_, other.value_);
+    value_ =
+        Backend::Min(sum, Backend::Sub(sum, Backend::Broadcast(kModulus)));
+    return *this;
+  }
+
+  PackedSmallPrimeField& DoubleInPlace() { return AddInPlace(*this); }
+
+  PackedSmallPrimeField Double() const {
+    PackedSmallPrimeField ret = *this;
+    return ret.DoubleInPlace();
+  }
+
+  PackedSmallPrimeField& SubInPlace(const PackedSmallPrimeField& other) {
+    value_ = ReduceSigned(Backend::Sub(value_, other.value_));
+    return *this;
+  }
+
+  PackedSmallPrimeField& NegInPlace() {
+    value_ = ReduceSigned(Backend::Sub(Backend::Zero(), value_));
+    return *this;
+  }
+
+  PackedSmallPrimeField& MulInPlace(const PackedSmallPrimeField& other) {
+    Vec a_odd = Backend::ShiftRight64(value_, 32);
+    Vec b_odd = Backend::ShiftRight64(other.value_, 32);
+    Vec prod_even = Backend::MulEven(value_, other.value_);
+    Vec prod_odd = Backend::MulEven(a_odd, b_odd);
+    if constexpr (F::kUseMontgomery) {
+      value_ = MontgomeryReduce(prod_even, prod_odd);
+    } else {
+      value_ = Mersenne31Reduce(prod_even, prod_odd);
+    }
+    return *this;
+  }
+
+  PackedSmallPrimeField& SquareInPlace() { return MulInPlace(*this); }
+
+  PackedSmallPrimeField Square() const {
+    PackedSmallPrimeField ret = *this;
+    return ret.SquareInPlace();
+  }
+
+ private:
+  explicit PackedSmallPrimeField(Vec value) : value_(value) {}
+
+  // Reduces the lanes in (-p, p), where the negative values have wrapped
+  // around: min(d, d + p) is d + p if d is negative, and d otherwise.
+  static Vec ReduceSigned(Vec d) {
+    return Backend::Min(d, Backend::Add(d, Backend::Broadcast(kModulus)));
+  }
+
+  // The vectorized SmallMontgomeryReduce(). It uses m = x * p⁻¹ mod 2³²
+  // instead of -p⁻¹, so that the upper half of x - m * p, which is in
+  // (-p, p), is computed without a carry since the lower halves cancel out.
+  static Vec MontgomeryReduce(Vec prod_even, Vec prod_odd) {
+    Vec inverse = Backend::Broadcast(kPositiveInverse);
+    Vec modulus = Backend::Broadcast(kModulus);
+    Vec mp_even =
+        Backend::MulEven(Backend::MulEven(prod_even, inverse), modulus);
+    Vec mp_odd =
+        Backend::MulEven(Backend::MulEven(prod_odd, inverse), modulus);
+    // The differences of the upper halves are in the odd lanes.
+    Vec d_even = Backend::Sub(prod_even, mp_even);
+    Vec d_odd = Backend::Sub(prod_odd, mp_odd);
+    return ReduceSigned(
+        Backend::BlendOdd(Backend::ShiftRight64(d_even, 32), d_odd));
+  }
+
+  // The vectorized internal::Mersenne31Reduce().
+  static Vec Mersenne31Reduce(Vec prod_even, Vec prod_odd) {
+    Vec modulus = Backend::Broadcast(kModulus);
+    // (x mod 2³¹) + (x >> 31) < 2p in the even lanes. The odd lanes are
+    // discarded.
+    Vec t_even = Backend::Add(Backend::And(prod_even, modulus),
+                              Backend::ShiftRight64(prod_even, 31));
+    Vec t_odd = Backend::Add(Backend::And(prod_odd, modulus),
+                             Backend::ShiftRight64(prod_odd, 31));
+    Vec t = Backend::BlendOdd(t_even, Backend::ShiftLeft64(t_odd, 32));
+    return Backend::Min(t, Backend::Sub(t, modulus));
+  }
+
+  // Returns a copy of this, where the zero lanes are replaced with |one|.
+  PackedSmallPrimeField ReplaceZeros(const PackedSmallPrimeField& one) const {
+    Vec zero_mask = Backend::Equal(value_, Backend::Zero());
+    return PackedSmallPrimeField(
+        Backend::Or(Backend::And(zero_mask, one.value_),
+                    Backend::AndNot(zero_mask, value_)));
+  }
+
+  constexpr static uint32_t kModulus = F::kModulus;
+  // p⁻¹ mod 2³²
+  constexpr static uint32_t kPositiveInverse = -F::Config::kInverse32;
+
+  Vec value_;
+};
+
+}  // namespace tachyon::math
+
+#endif  // TACHYON_MATH_FINITE_FIELDS_PACKED_SMALL_PRIME_FIELD_H_
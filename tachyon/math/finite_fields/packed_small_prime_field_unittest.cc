@@ -0,0 +1,116 @@
+#include "tachyon/math/finite_fields/packed_small_prime_field.h"
+
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "tachyon/base/containers/container_util.h"
+#include "tachyon/math/finite_fields/baby_bear/baby_bear.h"
+#include "tachyon/math/finite_fields/mersenne31/mersenne31.h"
+#include "tachyon/math/finite_fields/test/finite_field_test.h"
+
+namespace tachyon::math {
+
+namespace {
+
+template <typename PackedF>
+class PackedSmallPrimeFieldTest
+    : public FiniteFieldTest<typename PackedF::Field> {};
+
+}  // namespace
+
+// The native lanes run on AVX2 if the target is compiled with it, 16 lanes on
+// AVX-512, and 2 lanes always run on the portable implementation.
+using PackedSmallPrimeFieldTypes =
+    testing::Types<PackedSmallPrimeField<BabyBear>,
+                   PackedSmallPrimeField<BabyBear, 2>,
+                   PackedSmallPrimeField<BabyBear, 16>,
+                   PackedSmallPrimeField<Mersenne31>,
+                   PackedSmallPrimeField<Mersenne31, 2>,
+                   PackedSmallPrimeField<Mersenne31, 16>>;
+
+TYPED_TEST_SUITE(PackedSmallPrimeFieldTest, PackedSmallPrimeFieldTypes);
+
+TYPED_TEST(PackedSmallPrimeFieldTest, LoadAndStore) {
+  using PackedF = TypeParam;
+  using F = typename PackedF::Field;
+
+  std::vector<F> values = base::CreateVector(PackedF::kLanes, [](size_t i) {
+    return i == 0 ? -F::One() : F::Random();
+  });
+  std::vector<F> stored(PackedF::kLanes);
+  PackedF::Load(absl::MakeConstSpan(values)).Store(absl::MakeSpan(stored));
+  EXPECT_EQ(stored, values);
+
+  PackedF::Broadcast(values[1]).Store(absl::MakeSpan(stored));
+  EXPECT_EQ(stored, std::vector<F>(PackedF::kLanes, values[1]));
+}
+
+TYPED_TEST(PackedSmallPrimeFieldTest, Operations) {
+  using PackedF = TypeParam;
+  using F = typename PackedF::Field;
+
+  for (size_t iter = 0; iter < 100; ++iter) {
+    std::vector<F> a = base::CreateVector(PackedF::kLanes, []() {
+      return F::Random();
+    });
+    std::vector<F> b = base::CreateVector(PackedF::kLanes, []() {
+      return F::Random();
+    });
+    // Covers the edge cases in the first lanes.
+    if (iter == 0) {
+      a[0] = F::Zero();
+      b[0] = -F::One();
+      a[1] = -F::One();
+      b[1] = -F::One();
+    }
+    PackedF packed_a = PackedF::Load(a.data());
+    PackedF packed_b = PackedF::Load(b.data());
+
+    std::vector<F> results(PackedF::kLanes);
+    auto expect_each = [&](const PackedF& packed, auto fn) {
+      packed.Store(results.data());
+      for (size_t i = 0; i < PackedF::kLanes; ++i) {
+        EXPECT_EQ(results[i], fn(a[i], b[i]));
+      }
+    };
+    expect_each(packed_a + packed_b,
+                [](const F& x, const F& y) { return x + y; });
+    expect_each(packed_a - packed_b,
+                [](const F& x, const F& y) { return x - y; });
+    expect_each(packed_b - packed_a,
+                [](const F& x, const F& y) { return y - x; });
+    expect_each(-packed_a, [](const F& x, const F& y) { return -x; });
+    expect_each(packed_a.Double(),
+                [](const F& x, const F& y) { return x.Double(); });
+    expect_each(packed_a * packed_b,
+                [](const F& x, const F& y) { return x * y; });
+    expect_each(packed_a.Square(),
+                [](const F& x, const F& y) { return x.Square(); });
+  }
+}
+
+TYPED_TEST(PackedSmallPrimeFieldTest, BatchInverse) {
+  using PackedF = TypeParam;
+  using F = typename PackedF::Field;
+
+  // Leaves a tail that doesn't fill the lanes.
+  std::vector<F> values = base::CreateVector(
+      4 * PackedF::kLanes + 1, [](size_t i) {
+        return i % 5 == 3 ? F::Zero() : F::Random();
+      });
+  std::vector<F> inverses(values.size());
+  ASSERT_TRUE(PackedF::BatchInverse(values, absl::MakeSpan(inverses)));
+  for (size_t i = 0; i < values.size(); ++i) {
+    if (values[i].IsZero()) {
+      EXPECT_TRUE(inverses[i].IsZero());
+    } else {
+      EXPECT_EQ(inverses[i], values[i].Inverse());
+    }
+  }
+
+  std::vector<F> wrong_size(values.size() - 1);
+  EXPECT_FALSE(PackedF::BatchInverse(values, absl::MakeSpan(wrong_size)));
+}
+
+}  // namespace tachyon::math
@@ -0,0 +1,208 @@
+#ifndef TACHYON_MATH_FINITE_FIELDS_PACKED_U32_H_
+#define TACHYON_MATH_FINITE_FIELDS_PACKED_U32_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <array>
+
+#include "tachyon/build/build_config.h"
+
+#if defined(ARCH_CPU_X86_FAMILY) && (defined(__AVX2__) || defined(__AVX512F__))
+#include <immintrin.h>
+#endif
+
+namespace tachyon::math::internal {
+
+// PackedU32<Lanes> is a vector of |Lanes| unsigned 32-bit integers, which is
+// used to hold |Lanes| elements of a prime field less than 2³¹. Besides the
+// lane-wise additions, comparisons and bitwise operations, it provides the
+// operations on the pairs of the adjacent lanes viewed as 64-bit integers,
+// since x86 multiplies only the even lanes into 64-bit products:
+//
+//   MulEven(a, b):       the 64-bit products of the even lanes of |a| and |b|
+//   ShiftLeft64(a, n):   shifts every 64-bit pair left by |n| bits
+//   ShiftRight64(a, n):  shifts every 64-bit pair right by |n| bits
+//   BlendOdd(a, b):      the even lanes of |a| and the odd lanes of |b|
+//
+// The specializations below use AVX-512 for 16 lanes and AVX2 for 8 lanes
+// when the target is compiled with them. Otherwise, it falls back to a
+// portable implementation.
+template <size_t Lanes>
+struct PackedU32 {
+  static_assert(Lanes % 2 == 0, "Lanes should be paired into 64-bit lanes");
+
+  using Vec = std::array<uint32_t, Lanes>;
+
+  // Whether the lanes are processed by a single vector instruction.
+  constexpr static bool kIsVectorized = false;
+
+  static Vec Zero() { return Vec{}; }
+
+  static Vec Broadcast(uint32_t value) {
+    Vec ret;
+    ret.fill(value);
+    return ret;
+  }
+
+  static Vec Load(const uint32_t* ptr) {
+    Vec ret;
+    for (size_t i = 0; i < Lanes; ++i) {
+      ret[i] = ptr[i];
+    }
+    return ret;
+  }
+
+  static void Store(uint32_t* ptr, const Vec& a) {
+    for (size_t i = 0; i < Lanes; ++i) {
+      ptr[i] = a[i];
+    }
+  }
+
+#define TACHYON_PACKED_U32_BINARY_OP(name, expr) \
+  static Vec name(const Vec& a, const Vec& b) {  \
+    Vec ret;                                     \
+    for (size_t i = 0; i < Lanes; ++i) {         \
+      ret[i] = expr;                             \
+    }                                            \
+    return ret;                                  \
+  }
+
+  TACHYON_PACKED_U32_BINARY_OP(Add, a[i] + b[i])
+  TACHYON_PACKED_U32_BINARY_OP(Sub, a[i] - b[i])
+  TACHYON_PACKED_U32_BINARY_OP(Min, std::min(a[i], b[i]))
+  TACHYON_PACKED_U32_BINARY_OP(And, a[i] & b[i])
+  // Computes ~|a| & |b|.
+  TACHYON_PACKED_U32_BINARY_OP(AndNot, ~a[i] & b[i])
+  TACHYON_PACKED_U32_BINARY_OP(Or, a[i] | b[i])
+  TACHYON_PACKED_U32_BINARY_OP(Equal, a[i] == b[i] ? ~uint32_t{0} : 0)
+  TACHYON_PACKED_U32_BINARY_OP(BlendOdd, i % 2 == 0 ? a[i] : b[i])
+
+#undef TACHYON_PACKED_U32_BINARY_OP
+
+  static Vec MulEven(const Vec& a, const Vec& b) {
+    Vec ret;
+    for (size_t i = 0; i < Lanes; i += 2) {
+      SetU64(ret, i, uint64_t{a[i]} * b[i]);
+    }
+    return ret;
+  }
+
+  // |bits| should be less than 64.
+  static Vec ShiftLeft64(const Vec& a, int bits) {
+    Vec ret;
+    for (size_t i = 0; i < Lanes; i += 2) {
+      SetU64(ret, i, GetU64(a, i) << bits);
+    }
+    return ret;
+  }
+
+  // |bits| should be less than 64.
+  static Vec ShiftRight64(const Vec& a, int bits) {
+    Vec ret;
+    for (size_t i = 0; i < Lanes; i += 2) {
+      SetU64(ret, i, GetU64(a, i) >> bits);
+    }
+    return ret;
+  }
+
+ private:
+  static uint64_t GetU64(const Vec& a, size_t i) {
+    return uint64_t{a[i]} | (uint64_t{a[i + 1]} << 32);
+  }
+
+  static void SetU64(Vec& a, size_t i, uint64_t value) {
+    a[i] = static_cast<uint32_t>(value);
+    a[i + 1] = static_cast<uint32_t>(value >> 32);
+  }
+};
+
+#if defined(ARCH_CPU_X86_FAMILY) && defined(__AVX512F__)
+
+template <>
+struct PackedU32<16> {
+  using Vec = __m512i;
+
+  constexpr static bool kIsVectorized = true;
+
+  static Vec Zero() { return _mm512_setzero_si512(); }
+  static Vec Broadcast(uint32_t value) {
+    return _mm512_set1_epi32(static_cast<int32_t>(value));
+  }
+  static Vec Load(const uint32_t* ptr) { return _mm512_loadu_si512(ptr); }
+  static void Store(uint32_t* ptr, Vec a) { _mm512_storeu_si512(ptr, a); }
+
+  static Vec Add(Vec a, Vec b) { return _mm512_add_epi32(a, b); }
+  static Vec Sub(Vec a, Vec b) { return _mm512_sub_epi32(a, b); }
+  static Vec Min(Vec a, Vec b) { return _mm512_min_epu32(a, b); }
+  static Vec And(Vec a, Vec b) { return _mm512_and_si512(a, b); }
+  static Vec AndNot(Vec a, Vec b) { return _mm512_andnot_si512(a, b); }
+  static Vec Or(Vec a, Vec b) { return _mm512_or_si512(a, b); }
+  static Vec Equal(Vec a, Vec b) {
+    return _mm512_maskz_mov_epi32(_mm512_cmpeq_epu32_mask(a, b),
+                                  _mm512_set1_epi32(-1));
+  }
+  static Vec BlendOdd(Vec a, Vec b) {
+    return _mm512_mask_blend_epi32(0xaaaa, a, b);
+  }
+
+  static Vec MulEven(Vec a, Vec b) { return _mm512_mul_epu32(a, b); }
+  static Vec ShiftLeft64(Vec a, int bits) {
+    return _mm512_slli_epi64(a, bits);
+  }
+  static Vec ShiftRight64(Vec a, int bits) {
+    return _mm512_srli_epi64(a, bits);
+  }
+};
+
+#endif
+
+#if defined(ARCH_CPU_X86_FAMILY) && defined(__AVX2__)
+
+template <>
+struct PackedU32<8> {
+  using Vec = __m256i;
+
+  constexpr static bool kIsVectorized = true;
+
+  static Vec Zero() { return _mm256_setzero_si256(); }
+  static Vec Broadcast(uint32_t value) {
+    return _mm256_set1_epi32(static_cast<int32_t>(value));
+  }
+  static Vec Load(const uint32_t* ptr) {
+    return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr));
+  }
+  static void Store(uint32_t* ptr, Vec a) {
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(ptr), a);
+  }
+
+  static Vec Add(Vec a, Vec b) { return _mm256_add_epi32(a, b); }
+  static Vec Sub(Vec a, Vec b) { return _mm256_sub_epi32(a, b); }
+  static Vec Min(Vec a, Vec b) { return _mm256_min_epu32(a, b); }
+  static Vec And(Vec a, Vec b) { return _mm256_and_si256(a, b); }
+  static Vec AndNot(Vec a, Vec b) { return _mm256_andnot_si256(a, b); }
+  static Vec Or(Vec a, Vec b) { return _mm256_or_si256(a, b); }
+  static Vec Equal(Vec a, Vec b) { return _mm256_cmpeq_epi32(a, b); }
+  static Vec BlendOdd(Vec a, Vec b) { return _mm256_blend_epi32(a, b, 0xaa); }
+
+  static Vec MulEven(Vec a, Vec b) { return _mm256_mul_epu32(a, b); }
+  static Vec ShiftLeft64(Vec a, int bits) {
+    return _mm256_slli_epi64(a, bits);
+  }
+  static Vec ShiftRight64(Vec a, int bits) {
+    return _mm256_srli_epi64(a, bits);
+  }
+};
+
+#endif
+
+// The default lanes of PackedU32. This is 8 on AVX-512 as well. The radix-2
+// FFT runs its first four stages in scalar with 16 lanes, since the butterfly
+// gap there is narrower than the lanes, which makes it slower than with 8
+// lanes. PackedU32<16> can still be requested explicitly.
+constexpr size_t kNativeVectorLanes32 = 8;
+
+}  // namespace tachyon::math::internal
+
+#endif  // TACHYON_MATH_FINITE_FIELDS_PACKED_U32_H_
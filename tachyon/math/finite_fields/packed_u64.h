@@ -0,0 +1,323 @@
+#ifndef TACHYON_MATH_FINITE_FIELDS_PACKED_U64_H_
+#define TACHYON_MATH_FINITE_FIELDS_PACKED_U64_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <array>
+
+#include "tachyon/build/build_config.h"
+#include "tachyon/math/base/arithmetics.h"
+
+#if defined(ARCH_CPU_X86_FAMILY) && (defined(__AVX2__) || defined(__AVX512F__))
+#include <immintrin.h>
+#endif
+
+namespace tachyon::math::internal {
+
+// PackedU64<Lanes> is a vector of |Lanes| unsigned 64-bit integers, which is
+// used to hold a 52-bit limb of |Lanes| field elements, or |Lanes| elements
+// of a 64-bit field. Besides the bitwise operations, it provides the 52-bit
+// multiplications that AVX-512 IFMA provides and the 32-bit multiplication
+// that every x86 vector extension provides:
+//
+//   MAdd52(lo, hi, a, b): |lo| += |a| * |b| mod 2⁵², |hi| += |a| * |b| >> 52
+//   MulLo52(a, b):        |a| * |b| mod 2⁵²
+//   MulU32(a, b):         (|a| mod 2³²) * (|b| mod 2³²)
+//
+// where only the lower 52 bits of |a| and |b| are used by the former two. The
+// comparisons return a lane mask, which is all ones where it holds and zero
+// otherwise. The specializations below use AVX-512 for 8 lanes and AVX2 for 4
+// lanes when the target is compiled with them, e.g., with
+// --copt=-march=native. Otherwise, it falls back to a portable
+// implementation.
+template <size_t Lanes>
+struct PackedU64 {
+  using Vec = std::array<uint64_t, Lanes>;
+
+  // Whether the packed arithmetic is faster than the scalar arithmetic of
+  // PrimeField, so that the callers should switch to it.
+  constexpr static bool kIsAccelerated = false;
+  // Whether the lanes are processed by a single vector instruction.
+  constexpr static bool kIsVectorized = false;
+  constexpr static uint64_t kMask32 = (uint64_t{1} << 32) - 1;
+  constexpr static uint64_t kMask52 = (uint64_t{1} << 52) - 1;
+
+  static Vec Zero() { return Vec{}; }
+
+  static Vec Broadcast(uint64_t value) {
+    Vec ret;
+    ret.fill(value);
+    return ret;
+  }
+
+  static Vec Load(const uint64_t* ptr) {
+    Vec ret;
+    for (size_t i = 0; i < Lanes; ++i) {
+      ret[i] = ptr[i];
+    }
+    return ret;
+  }
+
+  static void Store(uint64_t* ptr, const Vec& a) {
+    for (size_t i = 0; i < Lanes; ++i) {
+      ptr[i] = a[i];
+    }
+  }
+
+  // Loads |ptr[i * stride]| into the i-th lane.
+  static Vec Gather(const uint64_t* ptr, size_t stride) {
+    Vec ret;
+    for (size_t i = 0; i < Lanes; ++i) {
+      ret[i] = ptr[i * stride];
+    }
+    return ret;
+  }
+
+  // Stores the i-th lane into |ptr[i * stride]|.
+  static void Scatter(uint64_t* ptr, size_t stride, const Vec& a) {
+    for (size_t i = 0; i < Lanes; ++i) {
+      ptr[i * stride] = a[i];
+    }
+  }
+
+#define TACHYON_PACKED_U64_BINARY_OP(name, expr) \
+  static Vec name(const Vec& a, const Vec& b) {  \
+    Vec ret;                                     \
+    for (size_t i = 0; i < Lanes; ++i) {         \
+      ret[i] = expr;                             \
+    }                                            \
+    return ret;                                  \
+  }
+
+  TACHYON_PACKED_U64_BINARY_OP(Add, a[i] + b[i])
+  TACHYON_PACKED_U64_BINARY_OP(Sub, a[i] - b[i])
+  TACHYON_PACKED_U64_BINARY_OP(And, a[i] & b[i])
+  // Computes ~|a| & |b|.
+  TACHYON_PACKED_U64_BINARY_OP(AndNot, ~a[i] & b[i])
+  TACHYON_PACKED_U64_BINARY_OP(Or, a[i] | b[i])
+  TACHYON_PACKED_U64_BINARY_OP(MulU32, (a[i] & kMask32) * (b[i] & kMask32))
+  TACHYON_PACKED_U64_BINARY_OP(Equal, a[i] == b[i] ? ~uint64_t{0} : 0)
+  // Compares |a| < |b| as unsigned integers.
+  TACHYON_PACKED_U64_BINARY_OP(LessThan, a[i] < b[i] ? ~uint64_t{0} : 0)
+
+#undef TACHYON_PACKED_U64_BINARY_OP
+
+  // |bits| should be less than 64.
+  static Vec ShiftLeft(const Vec& a, int bits) {
+    Vec ret;
+    for (size_t i = 0; i < Lanes; ++i) {
+      ret[i] = a[i] << bits;
+    }
+    return ret;
+  }
+
+  // |bits| should be less than 64.
+  static Vec ShiftRight(const Vec& a, int bits) {
+    Vec ret;
+    for (size_t i = 0; i < Lanes; ++i) {
+      ret[i] = a[i] >> bits;
+    }
+    return ret;
+  }
+
+  static void MAdd52(Vec& lo, Vec& hi, const Vec& a, const Vec& b) {
+    for (size_t i = 0; i < Lanes; ++i) {
+      MulResult<uint64_t> result =
+          u64::MulAddWithCarry(0, a[i] & kMask52, b[i] & kMask52);
+      lo[i] += result.lo & kMask52;
+      hi[i] += (result.hi << 12) | (result.lo >> 52);
+    }
+  }
+
+  static Vec MulLo52(const Vec& a, const Vec& b) {
+    Vec ret;
+    for (size_t i = 0; i < Lanes; ++i) {
+      ret[i] = (a[i] * b[i]) & kMask52;
+    }
+    return ret;
+  }
+};
+
+#if defined(ARCH_CPU_X86_FAMILY) && defined(__AVX512F__)
+
+template <>
+struct PackedU64<8> {
+  using Vec = __m512i;
+
+#if defined(__AVX512IFMA__)
+  constexpr static bool kIsAccelerated = true;
+#else
+  constexpr static bool kIsAccelerated = false;
+#endif
+  constexpr static bool kIsVectorized = true;
+
+  static Vec Zero() { return _mm512_setzero_si512(); }
+  static Vec Broadcast(uint64_t value) {
+    return _mm512_set1_epi64(static_cast<int64_t>(value));
+  }
+  static Vec Load(const uint64_t* ptr) { return _mm512_loadu_si512(ptr); }
+  static void Store(uint64_t* ptr, Vec a) { _mm512_storeu_si512(ptr, a); }
+
+  static Vec Gather(const uint64_t* ptr, size_t stride) {
+    return _mm512_i64gather_epi64(Strides(stride), ptr, 8);
+  }
+  static void Scatter(uint64_t* ptr, size_t stride, Vec a) {
+    _mm512_i64scatter_epi64(ptr, Strides(stride), a, 8);
+  }
+
+  static Vec Add(Vec a, Vec b) { return _mm512_add_epi64(a, b); }
+  static Vec Sub(Vec a, Vec b) { return _mm512_sub_epi64(a, b); }
+  static Vec And(Vec a, Vec b) { return _mm512_and_si512(a, b); }
+  static Vec AndNot(Vec a, Vec b) { return _mm512_andnot_si512(a, b); }
+  static Vec Or(Vec a, Vec b) { return _mm512_or_si512(a, b); }
+  static Vec MulU32(Vec a, Vec b) { return _mm512_mul_epu32(a, b); }
+  static Vec Equal(Vec a, Vec b) {
+    return _mm512_maskz_mov_epi64(_mm512_cmpeq_epu64_mask(a, b),
+                                  _mm512_set1_epi64(-1));
+  }
+  static Vec LessThan(Vec a, Vec b) {
+    return _mm512_maskz_mov_epi64(_mm512_cmplt_epu64_mask(a, b),
+                                  _mm512_set1_epi64(-1));
+  }
+
+  static Vec ShiftLeft(Vec a, int bits) {
+    return _mm512_slli_epi64(a, bits);
+  }
+  static Vec ShiftRight(Vec a, int bits) {
+    return _mm512_srli_epi64(a, bits);
+  }
+
+#if defined(__AVX512IFMA__)
+  static void MAdd52(Vec& lo, Vec& hi, Vec a, Vec b) {
+    lo = _mm512_madd52lo_epu64(lo, a, b);
+    hi = _mm512_madd52hi_epu64(hi, a, b);
+  }
+  static Vec MulLo52(Vec a, Vec b) {
+    return _mm512_madd52lo_epu64(_mm512_setzero_si512(), a, b);
+  }
+#endif
+
+ private:
+  static Vec Strides(size_t stride) {
+    int64_t s = static_cast<int64_t>(stride);
+    return _mm512_set_epi64(7 * s, 6 * s, 5 * s, 4 * s, 3 * s, 2 * s, s, 0);
+  }
+};
+
+#endif
+
+#if defined(ARCH_CPU_X86_FAMILY) && defined(__AVX2__)
+
+// AVX2 has no 52-bit multiplication, so a 52-bit product is assembled from
+// four 26-bit products of VPMULUDQ.
+template <>
+struct PackedU64<4> {
+  using Vec = __m256i;
+
+  // It is about 2x slower than the scalar MULX/ADCX/ADOX multiplication of
+  // 4-limb and 6-limb prime fields, so it is used only when asked for.
+  constexpr static bool kIsAccelerated = false;
+  constexpr static bool kIsVectorized = true;
+
+  static Vec Zero() { return _mm256_setzero_si256(); }
+  static Vec Broadcast(uint64_t value) {
+    return _mm256_set1_epi64x(static_cast<int64_t>(value));
+  }
+  static Vec Load(const uint64_t* ptr) {
+    return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr));
+  }
+  static void Store(uint64_t* ptr, Vec a) {
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(ptr), a);
+  }
+
+  static Vec Gather(const uint64_t* ptr, size_t stride) {
+    int64_t s = static_cast<int64_t>(stride);
+    return _mm256_i64gather_epi64(reinterpret_cast<const long long*>(ptr),
+                                  _mm256_set_epi64x(3 * s, 2 * s, s, 0), 8);
+  }
+  // AVX2 has no scatter.
+  static void Scatter(uint64_t* ptr, size_t stride, Vec a) {
+    alignas(32) uint64_t lanes[4];
+    Store(lanes, a);
+    for (size_t i = 0; i < 4; ++i) {
+      ptr[i * stride] = lanes[i];
+    }
+  }
+
+  static Vec Add(Vec a, Vec b) { return _mm256_add_epi64(a, b); }
+  static Vec Sub(Vec a, Vec b) { return _mm256_sub_epi64(a, b); }
+  static Vec And(Vec a, Vec b) { return _mm256_and_si256(a, b); }
+  static Vec AndNot(Vec a, Vec b) { return _mm256_andnot_si256(a, b); }
+  static Vec Or(Vec a, Vec b) { return _mm256_or_si256(a, b); }
+  static Vec MulU32(Vec a, Vec b) { return _mm256_mul_epu32(a, b); }
+  static Vec Equal(Vec a, Vec b) { return _mm256_cmpeq_epi64(a, b); }
+  // AVX2 has only the signed comparison, so the sign bits are flipped.
+  static Vec LessThan(Vec a, Vec b) {
+    Vec sign = _mm256_set1_epi64x(INT64_MIN);
+    return _mm256_cmpgt_epi64(_mm256_xor_si256(b, sign),
+                              _mm256_xor_si256(a, sign));
+  }
+
+  static Vec ShiftLeft(Vec a, int bits) {
+    return _mm256_slli_epi64(a, bits);
+  }
+  static Vec ShiftRight(Vec a, int bits) {
+    return _mm256_srli_epi64(a, bits);
+  }
+
+  static void MAdd52(Vec& lo, Vec& hi, Vec a, Vec b) {
+    Vec mask26 = _mm256_set1_epi64x((int64_t{1} << 26) - 1);
+    Vec mask52 = _mm256_set1_epi64x((int64_t{1} << 52) - 1);
+    Vec a0 = _mm256_and_si256(a, mask26);
+    Vec a1 = _mm256_and_si256(_mm256_srli_epi64(a, 26), mask26);
+    Vec b0 = _mm256_and_si256(b, mask26);
+    Vec b1 = _mm256_and_si256(_mm256_srli_epi64(b, 26), mask26);
+    Vec mid = _mm256_add_epi64(_mm256_mul_epu32(a0, b1),
+                               _mm256_mul_epu32(a1, b0));
+    // |low| < 2⁵³
+    Vec low = _mm256_add_epi64(
+        _mm256_mul_epu32(a0, b0),
+        _mm256_slli_epi64(_mm256_and_si256(mid, mask26), 26));
+    lo = _mm256_add_epi64(lo, _mm256_and_si256(low, mask52));
+    hi = _mm256_add_epi64(
+        hi, _mm256_add_epi64(
+                _mm256_add_epi64(_mm256_mul_epu32(a1, b1),
+                                 _mm256_srli_epi64(mid, 26)),
+                _mm256_srli_epi64(low, 52)));
+  }
+  static Vec MulLo52(Vec a, Vec b) {
+    Vec mask26 = _mm256_set1_epi64x((int64_t{1} << 26) - 1);
+    Vec a0 = _mm256_and_si256(a, mask26);
+    Vec a1 = _mm256_srli_epi64(a, 26);
+    Vec b0 = _mm256_and_si256(b, mask26);
+    Vec b1 = _mm256_srli_epi64(b, 26);
+    Vec mid = _mm256_add_epi64(_mm256_mul_epu32(a0, b1),
+                               _mm256_mul_epu32(a1, b0));
+    return _mm256_and_si256(
+        _mm256_add_epi64(_mm256_mul_epu32(a0, b0),
+                         _mm256_slli_epi64(mid, 26)),
+        _mm256_set1_epi64x((int64_t{1} << 52) - 1));
+  }
+};
+
+#endif
+
+// The lanes of PackedU64 whose 52-bit multiplications are the fastest.
+#if defined(ARCH_CPU_X86_FAMILY) && defined(__AVX512F__) && \
+    defined(__AVX512IFMA__)
+constexpr size_t kNativePackedLanes = 8;
+#else
+constexpr size_t kNativePackedLanes = 4;
+#endif
+
+// The lanes of PackedU64 that fill the widest vector register.
+#if defined(ARCH_CPU_X86_FAMILY) && defined(__AVX512F__)
+constexpr size_t kNativeVectorLanes = 8;
+#else
+constexpr size_t kNativeVectorLanes = 4;
+#endif
+
+}  // namespace tachyon::math::internal
+
+#endif  // TACHYON_MATH_FINITE_FIELDS_PACKED_U64_H_
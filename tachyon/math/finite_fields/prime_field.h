@@ -9,14 +9,22 @@
 #include <stddef.h>
 #include <stdint.h>
 
+#include <numeric>
 #include <string>
+#include <vector>
 
+#include "absl/types/span.h"
 #include "gtest/gtest_prod.h"
 
+#include "tachyon/base/cpu.h"
+#include "tachyon/base/cxx20_is_constant_evaluated.h"
 #include "tachyon/base/logging.h"
+#include "tachyon/base/parallelize.h"
 #include "tachyon/math/base/arithmetics.h"
 #include "tachyon/math/base/big_int.h"
 #include "tachyon/math/base/gmp/gmp_util.h"
+#include "tachyon/math/finite_fields/goldilocks_prime/goldilocks_montgomery.h"
+#include "tachyon/math/finite_fields/goldilocks_prime/packed_goldilocks.h"
 #include "tachyon/math/finite_fields/modulus.h"
 #include "tachyon/math/finite_fields/prime_field_base.h"
 
@@ -25,6 +33,9 @@ namespace tachyon::math {
 template <typename Config>
 class PrimeFieldGpu;
 
+template <typename F>
+class DoubleWidthPrimeField;
+
 // A prime field is finite field GF(p) where p is a prime number.
 template <typename _Config>
 class PrimeField<_Config, std::enable_if_t<!_Config::kIsSpecialPrime>> final
@@ -196,6 +207,18 @@ class PrimeField<_Config, std::enable_if_t<!_Config::kIsSpecialPrime>> final
   // TODO(chokobole): Support bigendian.
   // MultiplicativeSemigroup methods
   constexpr PrimeField& MulInPlace(const PrimeField& other) {
+    if constexpr (internal::IsGoldilocksConfig<Config>()) {
+      MulResult<uint64_t> result =
+          internal::u64::MulAddWithCarry(0, value_[0], other.value_[0]);
+      value_[0] = internal::GoldilocksMontgomeryReduce(result.lo, result.hi);
+      return *this;
+    }
+    if constexpr (Config::kHasAsmMontgomery) {
+      if (!base::is_constant_evaluated() && CanUseAsmMontgomery()) {
+        Config::AsmMulInPlace(value_.limbs, other.value_.limbs);
+        return *this;
+      }
+    }
     if constexpr (Config::kCanUseNoCarryMulOptimization) {
       return FastMulInPlace(other);
     } else {
@@ -207,6 +230,12 @@ class PrimeField<_Config, std::enable_if_t<!_Config::kIsSpecialPrime>> final
     if (N == 1) {
       return MulInPlace(*this);
     }
+    if constexpr (Config::kHasAsmMontgomery) {
+      if (!base::is_constant_evaluated() && CanUseAsmMontgomery()) {
+        Config::AsmSquareInPlace(value_.limbs);
+        return *this;
+      }
+    }
 
     BigInt<N * 2> r;
     MulResult<uint64_t> mul_result;
@@ -246,15 +275,86 @@ class PrimeField<_Config, std::enable_if_t<!_Config::kIsSpecialPrime>> final
   }
 
   constexpr PrimeField& InverseInPlace() {
+    if constexpr (Config::kUseSafeGcdInverse) {
+      if (!base::is_constant_evaluated()) {
+        // See https://github.com/kroma-network/tachyon/issues/76
+        CHECK(!IsZero());
+        // (aR)⁻¹ * R³ * R⁻¹ = a⁻¹R
+        value_ = this->GetSafeGcd().Inverse(value_);
+        return MulInPlace(FromMontgomery(Config::kMontgomeryR3));
+      }
+    }
     value_ = value_.template MontgomeryInverse<Config::kModulusHasSpareBit>(
         Config::kModulus, Config::kMontgomeryR2);
     return *this;
   }
 
+  // Computes c * aᵢ⁻¹ of |values| into |inverses| on the vector lanes of
+  // PackedGoldilocks. MultiplicativeGroup::BatchInverse() delegates to this
+  // if it is available, i.e., the target has a vector extension for it.
+  template <typename C = Config,
+            std::enable_if_t<internal::IsGoldilocksConfig<C>() &&
+                             internal::PackedU64<internal::kNativeVectorLanes>::
+                                 kIsVectorized>* = nullptr>
+  static void PackedBatchInverse(absl::Span<const PrimeField> values,
+                                 absl::Span<PrimeField> inverses,
+                                 const PrimeField& coeff) {
+    CHECK(PackedGoldilocks<PrimeField>::BatchInverse(values, inverses, coeff));
+  }
+
+  // Field methods
+  // Sum of products: a₁ * b₁ + a₂ * b₂ + ... + aₙ * bₙ
+  // Unlike Field::SumOfProducts(), the products are accumulated before the
+  // Montgomery reduction, so that it is reduced once per chunk instead of
+  // once per product. See DoSumOfProductsSerial().
+  template <typename ContainerA, typename ContainerB>
+  static PrimeField SumOfProducts(const ContainerA& a, const ContainerB& b) {
+    size_t size = std::size(a);
+    CHECK_EQ(size, std::size(b));
+    if (size == 0) return Zero();
+    std::vector<PrimeField> partial_sum_of_products = base::ParallelizeMap(
+        a, [&a, &b](absl::Span<const PrimeField> chunk, size_t chunk_idx,
+                    size_t chunk_size) {
+          size_t begin = chunk_idx * chunk_size;
+          return DoSumOfProductsSerial(a, b, begin, begin + chunk.size());
+        });
+    return std::accumulate(partial_sum_of_products.begin(),
+                           partial_sum_of_products.end(), Zero(),
+                           [](PrimeField& acc, const PrimeField& partial) {
+                             return acc += partial;
+                           });
+  }
+
+  // Sum of products: a₁ * b₁ + a₂ * b₂ + ... + aₙ * bₙ
+  template <typename ContainerA, typename ContainerB>
+  constexpr static PrimeField SumOfProductsSerial(const ContainerA& a,
+                                                  const ContainerB& b) {
+    size_t size = std::size(a);
+    CHECK_EQ(size, std::size(b));
+    // NOTE: For a couple of products, reducing each of them is as fast as the
+    // lazy reduction.
+    if (base::is_constant_evaluated() || size < 3) {
+      PrimeField sum;
+      for (size_t i = 0; i < size; ++i) {
+        sum += a[i] * b[i];
+      }
+      return sum;
+    }
+    return DoSumOfProductsSerial(a, b, 0, size);
+  }
+
  private:
+  friend class DoubleWidthPrimeField<PrimeField>;
   template <typename PrimeField>
   FRIEND_TEST(PrimeFieldCorrectnessTest, MultiplicativeOperators);
 
+  // The assembly emitted by the generator uses MULX(BMI2) and ADCX/ADOX(ADX).
+  // On a CPU without them, the portable code is used.
+  static bool CanUseAsmMontgomery() {
+    const base::CPU& cpu = base::CPU::GetInstanceNoAllocation();
+    return cpu.has_bmi2() && cpu.has_adx();
+  }
+
   constexpr PrimeField& FastMulInPlace(const PrimeField& other) {
     BigInt<N> r;
     for (size_t i = 0; i < N; ++i) {
@@ -282,6 +382,91 @@ class PrimeField<_Config, std::enable_if_t<!_Config::kIsSpecialPrime>> final
     return *this;
   }
 
+  // Computes a[begin] * b[begin] + ... + a[end - 1] * b[end - 1] with a single
+  // Montgomery reduction. Each product aR * bR is less than p² and is
+  // accumulated into 2N + 1 limbs without being reduced. Whenever the sum
+  // exceeds R², pR is subtracted from it, which keeps it less than R². Since
+  // the lower N limbs of pR are zero, only the upper N + 1 limbs are touched.
+  // Finally, the upper limbs are reduced modulo p, so that the sum is less than
+  // pR and the Montgomery reduction returns (a₁b₁ + ... + aₙbₙ)R.
+  template <typename ContainerA, typename ContainerB>
+  static PrimeField DoSumOfProductsSerial(const ContainerA& a,
+                                          const ContainerB& b, size_t begin,
+                                          size_t end) {
+    bool use_asm = false;
+    if constexpr (Config::kHasAsmMontgomery) {
+      use_asm = CanUseAsmMontgomery();
+    }
+    BigInt<2 * N + 1> sum;
+    for (size_t i = begin; i < end; ++i) {
+      const BigInt<N>& x = a[i].value_;
+      const BigInt<N>& y = b[i].value_;
+      uint64_t product[2 * N] = {};
+      if constexpr (Config::kHasAsmMontgomery) {
+        if (use_asm) {
+          Config::AsmMul(x.limbs, y.limbs, product);
+        }
+      }
+      for (size_t j = 0; j < N && !use_asm; ++j) {
+        uint64_t carry = 0;
+        for (size_t k = 0; k < N; ++k) {
+          MulResult<uint64_t> result = internal::u64::MulAddWithCarry(
+              product[j + k], x[j], y[k], carry);
+          product[j + k] = result.lo;
+          carry = result.hi;
+        }
+        product[j + N] = carry;
+      }
+      uint64_t carry = 0;
+      for (size_t j = 0; j < 2 * N; ++j) {
+        AddResult<uint64_t> result =
+            internal::u64::AddWithCarry(sum[j], product[j], carry);
+        sum[j] = result.result;
+        carry = result.carry;
+      }
+      sum[2 * N] += carry;
+      if (sum[2 * N] != 0) {
+        SubtractModulusFromUpperLimbs(&sum);
+      }
+    }
+    while (SubtractModulusFromUpperLimbs(&sum)) {
+    }
+
+    BigInt<2 * N> r;
+    for (size_t i = 0; i < 2 * N; ++i) {
+      r[i] = sum[i];
+    }
+    PrimeField ret;
+    if constexpr (Config::kHasAsmMontgomery) {
+      if (use_asm) {
+        Config::AsmMontgomeryReduce(r.limbs, ret.value_.limbs);
+        return ret;
+      }
+    }
+    BigInt<N>::template MontgomeryReduce64<Config::kModulusHasSpareBit>(
+        r, Config::kModulus, Config::kInverse64, &ret.value_);
+    return ret;
+  }
+
+  // Subtracts pR from |sum| if it is not less than pR. Returns true if it is
+  // subtracted.
+  static bool SubtractModulusFromUpperLimbs(BigInt<2 * N + 1>* sum) {
+    uint64_t upper[N];
+    uint64_t borrow = 0;
+    for (size_t i = 0; i < N; ++i) {
+      SubResult<uint64_t> result = internal::u64::SubWithBorrow(
+          (*sum)[N + i], Config::kModulus[i], borrow);
+      upper[i] = result.result;
+      borrow = result.borrow;
+    }
+    if ((*sum)[2 * N] < borrow) return false;
+    for (size_t i = 0; i < N; ++i) {
+      (*sum)[N + i] = upper[i];
+    }
+    (*sum)[2 * N] -= borrow;
+    return true;
+  }
+
   constexpr PrimeField& SlowMulInPlace(const PrimeField& other) {
     BigInt<N * 2> r = value_.Mul(other.value_);
     BigInt<N>::template MontgomeryReduce64<Config::kModulusHasSpareBit>(
@@ -17,9 +17,11 @@
 
 #include "tachyon/base/bits.h"
 #include "tachyon/base/buffer/copyable.h"
+#include "tachyon/base/cxx20_is_constant_evaluated.h"
 #include "tachyon/base/json/json.h"
 #include "tachyon/base/strings/string_number_conversions.h"
 #include "tachyon/math/base/gmp/gmp_util.h"
+#include "tachyon/math/base/safegcd.h"
 #include "tachyon/math/finite_fields/finite_field.h"
 #include "tachyon/math/finite_fields/legendre_symbol.h"
 #include "tachyon/math/finite_fields/prime_field_util.h"
@@ -122,8 +124,27 @@ class PrimeFieldBase : public FiniteField<F> {
     return true;
   }
 
+  // Returns the safegcd of the modulus, which is used for the inversion and
+  // the Legendre symbol when |Config::kUseSafeGcdInverse| is set.
+  static const auto& GetSafeGcd() {
+    constexpr static SafeGcd<Config::kModulus.kLimbNums> kSafeGcd(
+        Config::kModulus);
+    return kSafeGcd;
+  }
+
   constexpr LegendreSymbol Legendre() const {
     const F* f = static_cast<const F*>(this);
+    if constexpr (Config::kUseSafeGcdInverse) {
+      if (!base::is_constant_evaluated()) {
+        if (f->IsZero()) return LegendreSymbol::kZero;
+        // The Montgomery form aR has the same symbol as a, since R = 2⁶⁴ᴺ is
+        // a square.
+        int jacobi;
+        if (GetSafeGcd().Jacobi(f->value(), &jacobi)) {
+          return jacobi == 1 ? LegendreSymbol::kOne : LegendreSymbol::kMinusOne;
+        }
+      }
+    }
     // s = a^((p - 1) / 2)
     F s = f->Pow(Config::kModulusMinusOneDivTwo);
     if (s.IsZero())
@@ -1,6 +1,12 @@
+#include <vector>
+
 #include "gtest/gtest.h"
 
 #include "tachyon/base/buffer/vector_buffer.h"
+#include "tachyon/math/elliptic_curves/bls12/bls12_381/fq.h"
+#include "tachyon/math/elliptic_curves/bn/bn254/fq.h"
+#include "tachyon/math/elliptic_curves/bn/bn254/fr.h"
+#include "tachyon/math/elliptic_curves/secp/secp256k1/fq.h"
 #include "tachyon/math/finite_fields/test/finite_field_test.h"
 #include "tachyon/math/finite_fields/test/gf7.h"
 
@@ -10,6 +16,9 @@ namespace {
 
 class PrimeFieldTest : public FiniteFieldTest<GF7> {};
 
+template <typename PrimeField>
+class PrimeFieldMontgomeryTest : public FiniteFieldTest<PrimeField> {};
+
 }  // namespace
 
 TEST_F(PrimeFieldTest, FromString) {
@@ -198,4 +207,51 @@ TEST_F(PrimeFieldTest, Copyable) {
   EXPECT_EQ(expected, value);
 }
 
+using PrimeFieldTypes = testing::Types<bn254::Fq, bn254::Fr, secp256k1::Fq,
+                                       bls12_381::Fq>;
+
+TYPED_TEST_SUITE(PrimeFieldMontgomeryTest, PrimeFieldTypes);
+
+// Depending on the CPU, this runs either the assembly emitted by the generator
+// or the portable code. Both should agree with gmp.
+TYPED_TEST(PrimeFieldMontgomeryTest, MulAndSquare) {
+  using F = TypeParam;
+
+  std::vector<F> values = {F::Zero(), F::One(), -F::One(), F(2), -F(2)};
+  for (size_t i = 0; i < 32; ++i) {
+    values.push_back(F::Random());
+  }
+  mpz_class modulus = (-F::One()).ToMpzClass() + 1;
+  for (const F& a : values) {
+    mpz_class a_mpz = a.ToMpzClass();
+    EXPECT_EQ(a.Square().ToMpzClass(), (a_mpz * a_mpz) % modulus);
+    for (const F& b : values) {
+      EXPECT_EQ((a * b).ToMpzClass(), (a_mpz * b.ToMpzClass()) % modulus);
+    }
+  }
+}
+
+TYPED_TEST(PrimeFieldMontgomeryTest, SumOfProducts) {
+  using F = TypeParam;
+
+  // The products of -1's are the largest ones to be accumulated.
+  std::vector<F> a(64, -F::One());
+  std::vector<F> b(64, -F::One());
+  for (size_t i = 0; i < 64; ++i) {
+    a.push_back(F::Random());
+    b.push_back(F::Random());
+  }
+  for (size_t size : {size_t{0}, size_t{1}, size_t{2}, size_t{3}, size_t{64},
+                      a.size()}) {
+    absl::Span<const F> a_span = absl::MakeConstSpan(a).subspan(0, size);
+    absl::Span<const F> b_span = absl::MakeConstSpan(b).subspan(0, size);
+    F expected = F::Zero();
+    for (size_t i = 0; i < size; ++i) {
+      expected += a[i] * b[i];
+    }
+    EXPECT_EQ(F::SumOfProductsSerial(a_span, b_span), expected);
+    EXPECT_EQ(F::SumOfProducts(a_span, b_span), expected);
+  }
+}
+
 }  // namespace tachyon::math
@@ -12,8 +12,10 @@
 #include "absl/strings/substitute.h"
 
 #include "tachyon/base/buffer/copyable.h"
+#include "tachyon/base/cxx20_is_constant_evaluated.h"
 #include "tachyon/base/json/json.h"
 #include "tachyon/math/finite_fields/cyclotomic_multiplicative_subgroup.h"
+#include "tachyon/math/finite_fields/double_width_extension_field.h"
 #include "tachyon/math/geometry/point2.h"
 
 namespace tachyon {
@@ -77,6 +79,37 @@ class QuadraticExtensionField
     return *static_cast<Derived*>(this);
   }
 
+  // Computes the square root with the square roots in |BaseField| (the complex
+  // method). See https://eprint.iacr.org/2012/685.pdf (page 15, algorithm 8).
+  // Let a = a₀ + a₁x, where x² = q. If a₁ = 0, the root is either √a₀ or
+  // √(a₀ / q)x. Otherwise, the root is x₀ + x₁x, where x₀² = (a₀ ± √N(a)) / 2
+  // and x₁ = a₁ / 2x₀, since (x₀ + x₁x)² = x₀² + qx₁² + 2x₀x₁x.
+  bool SquareRoot(Derived* ret) const {
+    BaseField x0;
+    if (c1_.IsZero()) {
+      if (c0_.SquareRoot(&x0)) {
+        *ret = Derived(std::move(x0), BaseField::Zero());
+        return true;
+      }
+      BaseField x1;
+      if (!(c0_ / Config::kNonResidue).SquareRoot(&x1)) return false;
+      *ret = Derived(BaseField::Zero(), std::move(x1));
+      return true;
+    }
+
+    BaseField alpha;
+    if (!Norm().SquareRoot(&alpha)) return false;
+    BaseField two_inv = BaseField(2).Inverse();
+    if (!((c0_ + alpha) * two_inv).SquareRoot(&x0) &&
+        !((c0_ - alpha) * two_inv).SquareRoot(&x0)) {
+      return false;
+    }
+    // NOTE: |x0| is not zero, since a₁ = 2x₀x₁ is not zero.
+    BaseField x1 = c1_ / x0.Double();
+    *ret = Derived(std::move(x0), std::move(x1));
+    return true;
+  }
+
   constexpr MontgomeryTy ToMontgomery() const {
     return {c0_.ToMontgomery(), c1_.ToMontgomery()};
   }
@@ -158,6 +191,37 @@ class QuadraticExtensionField
     //   = (c0 * other.c0 + c1 * other.c1 * q, c0 * other.c0 +  c1 * other.c0)
     // Where q is Config::kNonResidue.
     // clang-format on
+    if constexpr (IsDoubleWidthSupported<Derived>::value) {
+      // Karatsuba multiplication with a single reduction per coefficient.
+      // See double_width_extension_field.h.
+      if (!base::is_constant_evaluated()) {
+        *static_cast<Derived*>(this) =
+            DoubleWidthFp2<Derived>::Mul(*static_cast<const Derived*>(this),
+                                         other)
+                .Reduce();
+        return *static_cast<Derived*>(this);
+      }
+    } else if constexpr (Config::kNonResidueIsV &&
+                         IsDoubleWidthSupported<BaseField>::value) {
+      // Karatsuba multiplication over Fp6 with a single reduction per
+      // coefficient of Fp2, where the non-residue is v. See
+      // double_width_extension_field.h.
+      if (!base::is_constant_evaluated()) {
+        using DoubleWidthBaseField = DoubleWidthFp6<BaseField>;
+        DoubleWidthBaseField v0 = DoubleWidthBaseField::Mul(c0_, other.c0_);
+        DoubleWidthBaseField v1 = DoubleWidthBaseField::Mul(c1_, other.c1_);
+        // c1 = (c0 + c1) * (other.c0 + other.c1) - v0 - v1
+        DoubleWidthBaseField c1 =
+            DoubleWidthBaseField::Mul(c0_ + c1_, other.c0_ + other.c1_);
+        c1 -= v0;
+        c1 -= v1;
+        // c0 = v0 + v1 * v
+        v0 += v1.MulByVInPlace();
+        c0_ = v0.Reduce();
+        c1_ = c1.Reduce();
+        return *static_cast<Derived*>(this);
+      }
+    }
     if constexpr (ExtensionDegree() == 2) {
       BaseField c0;
       {
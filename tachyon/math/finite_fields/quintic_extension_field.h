@@ -0,0 +1,421 @@
+#ifndef TACHYON_MATH_FINITE_FIELDS_QUINTIC_EXTENSION_FIELD_H_
+#define TACHYON_MATH_FINITE_FIELDS_QUINTIC_EXTENSION_FIELD_H_
+
+#include <array>
+#include <string>
+#include <utility>
+
+#include "absl/strings/substitute.h"
+
+#include "tachyon/base/buffer/copyable.h"
+#include "tachyon/base/json/json.h"
+#include "tachyon/math/finite_fields/cyclotomic_multiplicative_subgroup.h"
+
+namespace tachyon {
+namespace math {
+
+// A quintic extension field Fq[x] / (x⁵ - q), where q is
+// |Config::kNonResidue|. It is meant for the small prime fields such as
+// BabyBear, whose degree 5 extension gives the ~155 bits of security that FRI
+// needs when the challenges are sampled from the extension field.
+template <typename Derived>
+class QuinticExtensionField : public CyclotomicMultiplicativeSubgroup<Derived> {
+ public:
+  using Config = typename FiniteField<Derived>::Config;
+  using BaseField = typename Config::BaseField;
+  using MontgomeryTy = std::array<typename BaseField::MontgomeryTy, 5>;
+
+  constexpr QuinticExtensionField() = default;
+  constexpr QuinticExtensionField(const BaseField& c0, const BaseField& c1,
+                                  const BaseField& c2, const BaseField& c3,
+                                  const BaseField& c4)
+      : c0_(c0), c1_(c1), c2_(c2), c3_(c3), c4_(c4) {}
+  constexpr QuinticExtensionField(BaseField&& c0, BaseField&& c1,
+                                  BaseField&& c2, BaseField&& c3,
+                                  BaseField&& c4)
+      : c0_(std::move(c0)),
+        c1_(std::move(c1)),
+        c2_(std::move(c2)),
+        c3_(std::move(c3)),
+        c4_(std::move(c4)) {}
+
+  constexpr static Derived Zero() {
+    return {BaseField::Zero(), BaseField::Zero(), BaseField::Zero(),
+            BaseField::Zero(), BaseField::Zero()};
+  }
+
+  constexpr static Derived One() {
+    return {BaseField::One(), BaseField::Zero(), BaseField::Zero(),
+            BaseField::Zero(), BaseField::Zero()};
+  }
+
+  static Derived Random() {
+    return {BaseField::Random(), BaseField::Random(), BaseField::Random(),
+            BaseField::Random(), BaseField::Random()};
+  }
+
+  constexpr static Derived FromMontgomery(const MontgomeryTy& mont) {
+    return {BaseField::FromMontgomery(mont[0]),
+            BaseField::FromMontgomery(mont[1]),
+            BaseField::FromMontgomery(mont[2]),
+            BaseField::FromMontgomery(mont[3]),
+            BaseField::FromMontgomery(mont[4])};
+  }
+
+  constexpr bool IsZero() const {
+    return c0_.IsZero() && c1_.IsZero() && c2_.IsZero() && c3_.IsZero() &&
+           c4_.IsZero();
+  }
+
+  constexpr bool IsOne() const {
+    return c0_.IsOne() && c1_.IsZero() && c2_.IsZero() && c3_.IsZero() &&
+           c4_.IsZero();
+  }
+
+  constexpr static uint64_t ExtensionDegree() {
+    return 5 * BaseField::ExtensionDegree();
+  }
+
+  // Calculate the norm of an element with respect to the base field
+  // |BaseField|.
+  // |a.Norm() = a * a^q * a^q² * a^q³ * a^q⁴|
+  constexpr BaseField Norm() const {
+    Derived conjugates = ConjugatesProduct();
+    return MulC0(conjugates);
+  }
+
+  constexpr Derived& FrobeniusMapInPlace(uint64_t exponent) {
+    c0_.FrobeniusMapInPlace(exponent);
+    c1_.FrobeniusMapInPlace(exponent);
+    c2_.FrobeniusMapInPlace(exponent);
+    c3_.FrobeniusMapInPlace(exponent);
+    c4_.FrobeniusMapInPlace(exponent);
+    // (xʲ)ᴾ^ᵉ = xʲ * ωʲ, where ω = q^((Pᵉ - 1) / 5).
+    const BaseField& coeff =
+        Config::kFrobeniusCoeffs[exponent % Config::kDegreeOverBasePrimeField];
+    BaseField coeff_pow = coeff;
+    c1_ *= coeff_pow;
+    coeff_pow *= coeff;
+    c2_ *= coeff_pow;
+    coeff_pow *= coeff;
+    c3_ *= coeff_pow;
+    coeff_pow *= coeff;
+    c4_ *= coeff_pow;
+    return *static_cast<Derived*>(this);
+  }
+
+  constexpr MontgomeryTy ToMontgomery() const {
+    return {c0_.ToMontgomery(), c1_.ToMontgomery(), c2_.ToMontgomery(),
+            c3_.ToMontgomery(), c4_.ToMontgomery()};
+  }
+
+  std::string ToString() const {
+    return absl::Substitute("($0, $1, $2, $3, $4)", c0_.ToString(),
+                            c1_.ToString(), c2_.ToString(), c3_.ToString(),
+                            c4_.ToString());
+  }
+
+  std::string ToHexString(bool pad_zero = false) const {
+    return absl::Substitute(
+        "($0, $1, $2, $3, $4)", c0_.ToHexString(pad_zero),
+        c1_.ToHexString(pad_zero), c2_.ToHexString(pad_zero),
+        c3_.ToHexString(pad_zero), c4_.ToHexString(pad_zero));
+  }
+
+  constexpr const BaseField& c0() const { return c0_; }
+  constexpr const BaseField& c1() const { return c1_; }
+  constexpr const BaseField& c2() const { return c2_; }
+  constexpr const BaseField& c3() const { return c3_; }
+  constexpr const BaseField& c4() const { return c4_; }
+
+  constexpr bool operator==(const Derived& other) const {
+    return c0_ == other.c0_ && c1_ == other.c1_ && c2_ == other.c2_ &&
+           c3_ == other.c3_ && c4_ == other.c4_;
+  }
+
+  constexpr bool operator!=(const Derived& other) const {
+    return !operator==(other);
+  }
+
+  constexpr bool operator<(const Derived& other) const {
+    return Compare(other) < 0;
+  }
+
+  constexpr bool operator>(const Derived& other) const {
+    return Compare(other) > 0;
+  }
+
+  constexpr bool operator<=(const Derived& other) const {
+    return Compare(other) <= 0;
+  }
+
+  constexpr bool operator>=(const Derived& other) const {
+    return Compare(other) >= 0;
+  }
+
+  // AdditiveSemigroup methods
+  constexpr Derived& AddInPlace(const Derived& other) {
+    c0_ += other.c0_;
+    c1_ += other.c1_;
+    c2_ += other.c2_;
+    c3_ += other.c3_;
+    c4_ += other.c4_;
+    return *static_cast<Derived*>(this);
+  }
+
+  constexpr Derived& DoubleInPlace() {
+    c0_.DoubleInPlace();
+    c1_.DoubleInPlace();
+    c2_.DoubleInPlace();
+    c3_.DoubleInPlace();
+    c4_.DoubleInPlace();
+    return *static_cast<Derived*>(this);
+  }
+
+  // AdditiveGroup methods
+  constexpr Derived& SubInPlace(const Derived& other) {
+    c0_ -= other.c0_;
+    c1_ -= other.c1_;
+    c2_ -= other.c2_;
+    c3_ -= other.c3_;
+    c4_ -= other.c4_;
+    return *static_cast<Derived*>(this);
+  }
+
+  constexpr Derived& NegInPlace() {
+    c0_.NegInPlace();
+    c1_.NegInPlace();
+    c2_.NegInPlace();
+    c3_.NegInPlace();
+    c4_.NegInPlace();
+    return *static_cast<Derived*>(this);
+  }
+
+  // MultiplicativeSemigroup methods
+  constexpr Derived& MulInPlace(const Derived& other) {
+    // (a₀ + a₁x + a₂x² + a₃x³ + a₄x⁴) * (b₀ + b₁x + b₂x² + b₃x³ + b₄x⁴)
+    //   = Σₖ (Σ_{i + j = k} aᵢbⱼ + q * Σ_{i + j = k + 5} aᵢbⱼ) * xᵏ
+    // Where q is Config::kNonResidue. The multiplication of the base field is
+    // cheap enough that the schoolbook multiplication beats Karatsuba's,
+    // which needs more additions.
+    const BaseField& a0 = c0_;
+    const BaseField& a1 = c1_;
+    const BaseField& a2 = c2_;
+    const BaseField& a3 = c3_;
+    const BaseField& a4 = c4_;
+    const BaseField& b0 = other.c0_;
+    const BaseField& b1 = other.c1_;
+    const BaseField& b2 = other.c2_;
+    const BaseField& b3 = other.c3_;
+    const BaseField& b4 = other.c4_;
+
+    BaseField r0 = a0 * b0 + Config::MulByNonResidue(a1 * b4 + a2 * b3 +
+                                                     a3 * b2 + a4 * b1);
+    BaseField r1 = a0 * b1 + a1 * b0 +
+                   Config::MulByNonResidue(a2 * b4 + a3 * b3 + a4 * b2);
+    BaseField r2 = a0 * b2 + a1 * b1 + a2 * b0 +
+                   Config::MulByNonResidue(a3 * b4 + a4 * b3);
+    BaseField r3 = a0 * b3 + a1 * b2 + a2 * b1 + a3 * b0 +
+                   Config::MulByNonResidue(a4 * b4);
+    BaseField r4 = a0 * b4 + a1 * b3 + a2 * b2 + a3 * b1 + a4 * b0;
+
+    c0_ = std::move(r0);
+    c1_ = std::move(r1);
+    c2_ = std::move(r2);
+    c3_ = std::move(r3);
+    c4_ = std::move(r4);
+    return *static_cast<Derived*>(this);
+  }
+
+  constexpr Derived& MulInPlace(const BaseField& element) {
+    c0_ *= element;
+    c1_ *= element;
+    c2_ *= element;
+    c3_ *= element;
+    c4_ *= element;
+    return *static_cast<Derived*>(this);
+  }
+
+  constexpr Derived& SquareInPlace() {
+    // The cross terms aᵢaⱼ for i ≠ j appear twice, so that only 15
+    // multiplications are needed.
+    const BaseField& a0 = c0_;
+    const BaseField& a1 = c1_;
+    const BaseField& a2 = c2_;
+    const BaseField& a3 = c3_;
+    const BaseField& a4 = c4_;
+    BaseField a0_2 = a0.Double();
+    BaseField a1_2 = a1.Double();
+    BaseField a2_2 = a2.Double();
+    BaseField a3_2 = a3.Double();
+
+    BaseField r0 = a0.Square() + Config::MulByNonResidue(a1_2 * a4 + a2_2 * a3);
+    BaseField r1 = a0_2 * a1 + Config::MulByNonResidue(a2_2 * a4 + a3.Square());
+    BaseField r2 = a0_2 * a2 + a1.Square() + Config::MulByNonResidue(a3_2 * a4);
+    BaseField r3 = a0_2 * a3 + a1_2 * a2 + Config::MulByNonResidue(a4.Square());
+    BaseField r4 = a0_2 * a4 + a1_2 * a3 + a2.Square();
+
+    c0_ = std::move(r0);
+    c1_ = std::move(r1);
+    c2_ = std::move(r2);
+    c3_ = std::move(r3);
+    c4_ = std::move(r4);
+    return *static_cast<Derived*>(this);
+  }
+
+  // MultiplicativeGroup methods
+  Derived& DivInPlace(const Derived& other) {
+    return MulInPlace(other.Inverse());
+  }
+
+  constexpr Derived& InverseInPlace() {
+    // NOTE(chokobole): CHECK(!IsZero()) is not a device code.
+    // See https://github.com/kroma-network/tachyon/issues/76
+    if (IsZero()) return *static_cast<Derived*>(this);
+    // a⁻¹ = (a^q * a^q² * a^q³ * a^q⁴) / Norm(a), where Norm(a) is in
+    // |BaseField|. So only one inversion in |BaseField| is needed.
+    Derived conjugates = ConjugatesProduct();
+    BaseField norm_inv = MulC0(conjugates).Inverse();
+    *static_cast<Derived*>(this) = conjugates.MulInPlace(norm_inv);
+    return *static_cast<Derived*>(this);
+  }
+
+ private:
+  // Returns a^q * a^q² * a^q³ * a^q⁴ with 3 multiplications, reusing the
+  // partial product: (a^q * a^q²)^q² = a^q³ * a^q⁴.
+  constexpr Derived ConjugatesProduct() const {
+    size_t index_multiplier = size_t{BaseField::ExtensionDegree()};
+    Derived f = *static_cast<const Derived*>(this);
+    f.FrobeniusMapInPlace(index_multiplier);
+    Derived f2 = f;
+    f2.FrobeniusMapInPlace(index_multiplier);
+    // f12 = a^q * a^q²
+    Derived f12 = f * f2;
+    Derived f34 = f12;
+    f34.FrobeniusMapInPlace(2 * index_multiplier);
+    return f12 * f34;
+  }
+
+  // Returns the constant term of |this| * |other|, which is all that is
+  // needed when the product is known to be in |BaseField|.
+  constexpr BaseField MulC0(const Derived& other) const {
+    return c0_ * other.c0_ + Config::MulByNonResidue(c1_ * other.c4_ +
+                                                     c2_ * other.c3_ +
+                                                     c3_ * other.c2_ +
+                                                     c4_ * other.c1_);
+  }
+
+  // Compares from the highest coefficient as CubicExtensionField does.
+  constexpr int Compare(const Derived& other) const {
+    const BaseField* lhs[] = {&c4_, &c3_, &c2_, &c1_, &c0_};
+    const BaseField* rhs[] = {&other.c4_, &other.c3_, &other.c2_, &other.c1_,
+                              &other.c0_};
+    for (size_t i = 0; i < 5; ++i) {
+      if (*lhs[i] != *rhs[i]) return *lhs[i] < *rhs[i] ? -1 : 1;
+    }
+    return 0;
+  }
+
+ protected:
+  // c = c0_ + c1_ * X + c2_ * X² + c3_ * X³ + c4_ * X⁴
+  BaseField c0_;
+  BaseField c1_;
+  BaseField c2_;
+  BaseField c3_;
+  BaseField c4_;
+};
+
+template <
+    typename BaseField, typename Derived,
+    std::enable_if_t<std::is_same_v<BaseField, typename Derived::BaseField>>* =
+        nullptr>
+Derived operator*(const BaseField& element,
+                  const QuinticExtensionField<Derived>& f) {
+  return static_cast<const Derived&>(f) * element;
+}
+
+}  // namespace math
+
+namespace base {
+
+template <typename Derived>
+class Copyable<Derived, std::enable_if_t<std::is_base_of_v<
+                            math::QuinticExtensionField<Derived>, Derived>>> {
+ public:
+  static bool WriteTo(
+      const math::QuinticExtensionField<Derived>& quintic_extension_field,
+      Buffer* buffer) {
+    return buffer->WriteMany(
+        quintic_extension_field.c0(), quintic_extension_field.c1(),
+        quintic_extension_field.c2(), quintic_extension_field.c3(),
+        quintic_extension_field.c4());
+  }
+
+  static bool ReadFrom(
+      const ReadOnlyBuffer& buffer,
+      math::QuinticExtensionField<Derived>* quintic_extension_field) {
+    typename Derived::BaseField c0;
+    typename Derived::BaseField c1;
+    typename Derived::BaseField c2;
+    typename Derived::BaseField c3;
+    typename Derived::BaseField c4;
+    if (!buffer.ReadMany(&c0, &c1, &c2, &c3, &c4)) return false;
+
+    *quintic_extension_field = math::QuinticExtensionField<Derived>(
+        std::move(c0), std::move(c1), std::move(c2), std::move(c3),
+        std::move(c4));
+    return true;
+  }
+
+  static size_t EstimateSize(
+      const math::QuinticExtensionField<Derived>& quintic_extension_field) {
+    return base::EstimateSize(
+        quintic_extension_field.c0(), quintic_extension_field.c1(),
+        quintic_extension_field.c2(), quintic_extension_field.c3(),
+        quintic_extension_field.c4());
+  }
+};
+
+template <typename Derived>
+class RapidJsonValueConverter<
+    Derived, std::enable_if_t<std::is_base_of_v<
+                 math::QuinticExtensionField<Derived>, Derived>>> {
+ public:
+  using BaseField = typename math::QuinticExtensionField<Derived>::BaseField;
+
+  template <typename Allocator>
+  static rapidjson::Value From(
+      const math::QuinticExtensionField<Derived>& value, Allocator& allocator) {
+    rapidjson::Value object(rapidjson::kObjectType);
+    AddJsonElement(object, "c0", value.c0(), allocator);
+    AddJsonElement(object, "c1", value.c1(), allocator);
+    AddJsonElement(object, "c2", value.c2(), allocator);
+    AddJsonElement(object, "c3", value.c3(), allocator);
+    AddJsonElement(object, "c4", value.c4(), allocator);
+    return object;
+  }
+
+  static bool To(const rapidjson::Value& json_value, std::string_view key,
+                 math::QuinticExtensionField<Derived>* value,
+                 std::string* error) {
+    BaseField c0;
+    BaseField c1;
+    BaseField c2;
+    BaseField c3;
+    BaseField c4;
+    if (!ParseJsonElement(json_value, "c0", &c0, error)) return false;
+    if (!ParseJsonElement(json_value, "c1", &c1, error)) return false;
+    if (!ParseJsonElement(json_value, "c2", &c2, error)) return false;
+    if (!ParseJsonElement(json_value, "c3", &c3, error)) return false;
+    if (!ParseJsonElement(json_value, "c4", &c4, error)) return false;
+    *value = math::QuinticExtensionField<Derived>(
+        std::move(c0), std::move(c1), std::move(c2), std::move(c3),
+        std::move(c4));
+    return true;
+  }
+};
+
+}  // namespace base
+}  // namespace tachyon
+
+#endif  // TACHYON_MATH_FINITE_FIELDS_QUINTIC_EXTENSION_FIELD_H_
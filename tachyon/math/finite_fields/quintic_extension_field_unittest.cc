@@ -0,0 +1,94 @@
+#include "gtest/gtest.h"
+
+#include "tachyon/base/buffer/vector_buffer.h"
+#include "tachyon/math/finite_fields/baby_bear/baby_bear5.h"
+#include "tachyon/math/finite_fields/test/finite_field_test.h"
+
+namespace tachyon::math {
+
+namespace {
+
+class QuinticExtensionFieldTest : public FiniteFieldTest<BabyBear5> {};
+
+}  // namespace
+
+TEST_F(QuinticExtensionFieldTest, Zero) {
+  EXPECT_TRUE(BabyBear5::Zero().IsZero());
+  EXPECT_FALSE(BabyBear5::One().IsZero());
+}
+
+TEST_F(QuinticExtensionFieldTest, One) {
+  EXPECT_TRUE(BabyBear5::One().IsOne());
+  EXPECT_FALSE(BabyBear5::Zero().IsOne());
+}
+
+TEST_F(QuinticExtensionFieldTest, EqualityOperators) {
+  BabyBear5 f(BabyBear(3), BabyBear(4), BabyBear(5), BabyBear(6), BabyBear(7));
+  BabyBear5 f2(BabyBear(3), BabyBear(4), BabyBear(5), BabyBear(6),
+               BabyBear(8));
+  EXPECT_FALSE(f == f2);
+  EXPECT_TRUE(f != f2);
+  EXPECT_TRUE(f < f2);
+  EXPECT_TRUE(f <= f2);
+  EXPECT_FALSE(f > f2);
+  EXPECT_FALSE(f >= f2);
+
+  BabyBear5 f3(BabyBear(3), BabyBear(4), BabyBear(5), BabyBear(6),
+               BabyBear(7));
+  EXPECT_TRUE(f == f3);
+  EXPECT_TRUE(f <= f3);
+}
+
+TEST_F(QuinticExtensionFieldTest, MultiplicativeOperators) {
+  // x * x⁴ = x⁵ = 2
+  BabyBear5 x(BabyBear::Zero(), BabyBear::One(), BabyBear::Zero(),
+              BabyBear::Zero(), BabyBear::Zero());
+  BabyBear5 x4(BabyBear::Zero(), BabyBear::Zero(), BabyBear::Zero(),
+               BabyBear::Zero(), BabyBear::One());
+  EXPECT_EQ(x * x4, BabyBear5(BabyBear(2), BabyBear::Zero(), BabyBear::Zero(),
+                              BabyBear::Zero(), BabyBear::Zero()));
+
+  for (size_t i = 0; i < 10; ++i) {
+    BabyBear5 a = BabyBear5::Random();
+    BabyBear5 b = BabyBear5::Random();
+    BabyBear5 c = BabyBear5::Random();
+    EXPECT_EQ(a * b, b * a);
+    EXPECT_EQ((a * b) * c, a * (b * c));
+    EXPECT_EQ(a * (b + c), a * b + a * c);
+    EXPECT_EQ(a.Square(), a * a);
+    EXPECT_TRUE((a * a.Inverse()).IsOne());
+    EXPECT_EQ((a * b) / b, a);
+  }
+}
+
+TEST_F(QuinticExtensionFieldTest, Frobenius) {
+  for (size_t i = 0; i < 5; ++i) {
+    BabyBear5 a = BabyBear5::Random();
+    BabyBear5 expected = a;
+    for (size_t exponent = 0; exponent < 5; ++exponent) {
+      BabyBear5 frobenius = a;
+      frobenius.FrobeniusMapInPlace(exponent);
+      EXPECT_EQ(frobenius, expected);
+      expected = expected.Pow(BabyBear::Config::kModulus);
+    }
+    // The norm is in the base field, so it is fixed by the Frobenius map.
+    EXPECT_EQ(a.Norm().Pow(BabyBear::Config::kModulus), a.Norm());
+  }
+}
+
+TEST_F(QuinticExtensionFieldTest, Copyable) {
+  const BabyBear5 expected = BabyBear5::Random();
+
+  base::Uint8VectorBuffer write_buf;
+  ASSERT_TRUE(write_buf.Grow(base::EstimateSize(expected)));
+  ASSERT_TRUE(write_buf.Write(expected));
+  ASSERT_TRUE(write_buf.Done());
+
+  write_buf.set_buffer_offset(0);
+
+  BabyBear5 value;
+  ASSERT_TRUE(write_buf.Read(&value));
+  EXPECT_EQ(expected, value);
+}
+
+}  // namespace tachyon::math
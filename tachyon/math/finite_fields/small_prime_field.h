@@ -0,0 +1,281 @@
+#ifndef TACHYON_MATH_FINITE_FIELDS_SMALL_PRIME_FIELD_H_
+#define TACHYON_MATH_FINITE_FIELDS_SMALL_PRIME_FIELD_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <string>
+
+#include "tachyon/base/logging.h"
+#include "tachyon/math/base/big_int.h"
+#include "tachyon/math/base/gmp/gmp_util.h"
+#include "tachyon/math/finite_fields/prime_field_base.h"
+
+namespace tachyon::math {
+namespace internal {
+
+// p = 2³¹ - 1
+constexpr uint32_t kMersenne31Modulus = 0x7fffffff;
+
+// Returns whether |Config| is a prime field config of the Mersenne-31 prime.
+template <typename Config>
+constexpr bool IsMersenne31Config() {
+  return Config::kModulus[0] == kMersenne31Modulus;
+}
+
+// Returns |x| * 2⁻³² mod p, where |x| is less than p * 2³². |inverse| is
+// -p⁻¹ mod 2³². The result is less than p.
+constexpr uint32_t SmallMontgomeryReduce(uint64_t x, uint32_t modulus,
+                                         uint32_t inverse) {
+  uint32_t m = static_cast<uint32_t>(x) * inverse;
+  // |x| + m * p < 2⁶⁴, since both p and m * p / 2³² are less than 2³¹.
+  uint32_t t = static_cast<uint32_t>((x + uint64_t{m} * modulus) >> 32);
+  return t >= modulus ? t - modulus : t;
+}
+
+// Returns |x| mod p, where p = 2³¹ - 1 and |x| is less than p². Since
+// 2³¹ = 1 mod p, the upper bits are folded onto the lower 31 bits.
+constexpr uint32_t Mersenne31Reduce(uint64_t x) {
+  uint32_t t = static_cast<uint32_t>(x & kMersenne31Modulus) +
+               static_cast<uint32_t>(x >> 31);
+  return t >= kMersenne31Modulus ? t - kMersenne31Modulus : t;
+}
+
+}  // namespace internal
+
+// A prime field whose modulus fits in 31 bits, such as BabyBear and
+// Mersenne-31. The element is held in a single uint32_t instead of a 64-bit
+// limb, so that the product of two elements fits in a uint64_t, and 8 or 16
+// elements fit in a vector register. See packed_small_prime_field.h.
+//
+// The elements of Mersenne-31 are kept in the canonical form, since the
+// reduction modulo 2³¹ - 1 is just a shift and an addition. The elements of
+// the other primes are kept in the Montgomery form with R = 2³².
+//
+// Note that |MontgomeryTy| is still the Montgomery form with R = 2⁶⁴, which
+// the generated config constants and the other prime fields use.
+template <typename _Config>
+class PrimeField<_Config, std::enable_if_t<_Config::kIsSmallPrime>> final
+    : public PrimeFieldBase<PrimeField<_Config>> {
+ public:
+  constexpr static size_t kModulusBits = _Config::kModulusBits;
+  constexpr static size_t kLimbNums = 1;
+  constexpr static size_t N = kLimbNums;
+
+  using Config = _Config;
+  using BigIntTy = BigInt<N>;
+  using MontgomeryTy = BigInt<N>;
+  using value_type = uint32_t;
+
+  using CpuField = PrimeField<Config>;
+  // TODO(chokobole): Implements PrimeFieldGpu for the small primes.
+  using GpuField = PrimeField<Config>;
+
+  static_assert(kModulusBits <= 31,
+                "The sum of two elements should fit in a uint32_t");
+
+  constexpr static uint32_t kModulus = Config::kModulus[0];
+  constexpr static bool kUseMontgomery =
+      !internal::IsMersenne31Config<Config>();
+
+  constexpr PrimeField() = default;
+  template <typename T,
+            std::enable_if_t<std::is_constructible_v<BigInt<N>, T>>* = nullptr>
+  constexpr explicit PrimeField(T value) : PrimeField(BigInt<N>(value)) {}
+  constexpr explicit PrimeField(const BigInt<N>& value)
+      : value_(ToInternal(value[0])) {
+    DCHECK_LT(value, Config::kModulus);
+  }
+  constexpr PrimeField(const PrimeField& other) = default;
+  constexpr PrimeField& operator=(const PrimeField& other) = default;
+  constexpr PrimeField(PrimeField&& other) = default;
+  constexpr PrimeField& operator=(PrimeField&& other) = default;
+
+  constexpr static PrimeField Zero() { return PrimeField(); }
+
+  constexpr static PrimeField One() { return FromInternal(kOne); }
+
+  static PrimeField Random() {
+    return PrimeField(BigInt<N>::Random(Config::kModulus));
+  }
+
+  constexpr static PrimeField FromDecString(std::string_view str) {
+    return PrimeField(BigInt<N>::FromDecString(str));
+  }
+  constexpr static PrimeField FromHexString(std::string_view str) {
+    return PrimeField(BigInt<N>::FromHexString(str));
+  }
+
+  constexpr static PrimeField FromBigInt(const BigInt<N>& big_int) {
+    return PrimeField(big_int);
+  }
+
+  // |mont| is |a| * 2⁶⁴ mod p.
+  constexpr static PrimeField FromMontgomery(const MontgomeryTy& mont) {
+    if constexpr (kUseMontgomery) {
+      // (a * 2⁶⁴) * 2⁻³² = a * 2³²
+      return FromInternal(Reduce(mont[0]));
+    } else {
+      // 2⁻⁶⁴ = 2²⁹ mod 2³¹ - 1
+      return FromInternal(Reduce(mont[0] << 29));
+    }
+  }
+
+  static PrimeField FromMpzClass(const mpz_class& value) {
+    BigInt<N> big_int;
+    gmp::CopyLimbs(value, big_int.limbs);
+    return FromBigInt(big_int);
+  }
+
+  static void Init() { VLOG(1) << Config::kName << " initialized"; }
+
+  // Returns the element in the internal form. See the class comment.
+  constexpr value_type value() const { return value_; }
+  size_t GetLimbSize() const { return N; }
+
+  constexpr bool IsZero() const { return value_ == 0; }
+
+  constexpr bool IsOne() const { return value_ == kOne; }
+
+  std::string ToString() const { return ToBigInt().ToString(); }
+  std::string ToHexString(bool pad_zero = false) const {
+    return ToBigInt().ToHexString(pad_zero);
+  }
+
+  mpz_class ToMpzClass() const {
+    mpz_class ret;
+    gmp::WriteLimbs(ToBigInt().limbs, N, &ret);
+    return ret;
+  }
+
+  constexpr uint32_t ToUint32() const {
+    if constexpr (kUseMontgomery) {
+      return Reduce(value_);
+    } else {
+      return value_;
+    }
+  }
+
+  constexpr BigInt<N> ToBigInt() const { return BigInt<N>(ToUint32()); }
+
+  constexpr MontgomeryTy ToMontgomery() const {
+    // For Montgomery: (a * 2³²) * (2⁶⁴ mod p) * 2⁻³² = a * 2⁶⁴.
+    // For Mersenne-31: a * (2⁶⁴ mod p).
+    return MontgomeryTy(
+        uint64_t{Reduce(uint64_t{value_} * Config::kMontgomeryR[0])});
+  }
+
+  constexpr uint64_t operator[](size_t i) const {
+    DCHECK_EQ(i, size_t{0});
+    return ToUint32();
+  }
+
+  // The internal form is a bijection, so the equality doesn't need the
+  // conversion.
+  constexpr bool operator==(const PrimeField& other) const {
+    return value_ == other.value_;
+  }
+
+  constexpr bool operator!=(const PrimeField& other) const {
+    return value_ != other.value_;
+  }
+
+  constexpr bool operator<(const PrimeField& other) const {
+    return ToUint32() < other.ToUint32();
+  }
+
+  constexpr bool operator>(const PrimeField& other) const {
+    return ToUint32() > other.ToUint32();
+  }
+
+  constexpr bool operator<=(const PrimeField& other) const {
+    return ToUint32() <= other.ToUint32();
+  }
+
+  constexpr bool operator>=(const PrimeField& other) const {
+    return ToUint32() >= other.ToUint32();
+  }
+
+  // This is needed by MSM.
+  // See tachyon/math/elliptic_curves/msm/variable_base_msm.h
+  BigInt<N> DivBy2Exp(uint32_t exp) const {
+    return ToBigInt().DivBy2ExpInPlace(exp);
+  }
+
+  // AdditiveSemigroup methods
+  constexpr PrimeField& AddInPlace(const PrimeField& other) {
+    uint32_t sum = value_ + other.value_;
+    value_ = sum >= kModulus ? sum - kModulus : sum;
+    return *this;
+  }
+
+  constexpr PrimeField& DoubleInPlace() { return AddInPlace(*this); }
+
+  // AdditiveGroup methods
+  constexpr PrimeField& SubInPlace(const PrimeField& other) {
+    uint32_t diff = value_ - other.value_;
+    value_ = value_ < other.value_ ? diff + kModulus : diff;
+    return *this;
+  }
+
+  constexpr PrimeField& NegInPlace() {
+    if (!IsZero()) value_ = kModulus - value_;
+    return *this;
+  }
+
+  // MultiplicativeSemigroup methods
+  constexpr PrimeField& MulInPlace(const PrimeField& other) {
+    value_ = Reduce(uint64_t{value_} * other.value_);
+    return *this;
+  }
+
+  constexpr PrimeField& SquareInPlace() { return MulInPlace(*this); }
+
+  // MultiplicativeGroup methods
+  PrimeField& DivInPlace(const PrimeField& other) {
+    return MulInPlace(other.Inverse());
+  }
+
+  // aᵖ⁻² = a⁻¹ by Fermat's little theorem. The inverse of zero is zero.
+  constexpr PrimeField& InverseInPlace() {
+    *this = this->Pow(uint64_t{kModulus - 2});
+    return *this;
+  }
+
+ private:
+  // The internal form of one: 2³² mod p for Montgomery, 1 for Mersenne-31.
+  constexpr static uint32_t kOne =
+      kUseMontgomery ? static_cast<uint32_t>((uint64_t{1} << 32) % kModulus)
+                     : 1;
+
+  constexpr static PrimeField FromInternal(uint32_t value) {
+    PrimeField ret;
+    ret.value_ = value;
+    return ret;
+  }
+
+  // Reduces |x| less than p². For the Montgomery form, this is the Montgomery
+  // reduction, which returns |x| * 2⁻³² mod p.
+  constexpr static uint32_t Reduce(uint64_t x) {
+    if constexpr (kUseMontgomery) {
+      return internal::SmallMontgomeryReduce(x, kModulus, Config::kInverse32);
+    } else {
+      return internal::Mersenne31Reduce(x);
+    }
+  }
+
+  constexpr static uint32_t ToInternal(uint64_t a) {
+    // a * (2⁶⁴ mod p) * 2⁻³² = a * 2³² for Montgomery.
+    if constexpr (kUseMontgomery) {
+      return Reduce(a * Config::kMontgomeryR[0]);
+    } else {
+      return static_cast<uint32_t>(a);
+    }
+  }
+
+  uint32_t value_ = 0;
+};
+
+}  // namespace tachyon::math
+
+#endif  // TACHYON_MATH_FINITE_FIELDS_SMALL_PRIME_FIELD_H_
@@ -0,0 +1,132 @@
+#include "tachyon/math/finite_fields/small_prime_field.h"
+
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "tachyon/base/buffer/vector_buffer.h"
+#include "tachyon/math/finite_fields/baby_bear/baby_bear.h"
+#include "tachyon/math/finite_fields/mersenne31/mersenne31.h"
+#include "tachyon/math/finite_fields/test/finite_field_test.h"
+
+namespace tachyon::math {
+
+namespace {
+
+template <typename F>
+class SmallPrimeFieldTest : public FiniteFieldTest<F> {
+ public:
+  // Covers the edge cases besides the random elements.
+  static std::vector<F> GetTestValues() {
+    std::vector<F> values = {F::Zero(), F::One(), -F::One(), F(2),
+                             F(uint32_t{1} << 30)};
+    for (size_t i = 0; i < 30; ++i) {
+      values.push_back(F::Random());
+    }
+    return values;
+  }
+};
+
+}  // namespace
+
+using SmallPrimeFieldTypes = testing::Types<BabyBear, Mersenne31>;
+TYPED_TEST_SUITE(SmallPrimeFieldTest, SmallPrimeFieldTypes);
+
+TYPED_TEST(SmallPrimeFieldTest, Zero) {
+  using F = TypeParam;
+
+  EXPECT_TRUE(F::Zero().IsZero());
+  EXPECT_FALSE(F::One().IsZero());
+}
+
+TYPED_TEST(SmallPrimeFieldTest, One) {
+  using F = TypeParam;
+
+  EXPECT_TRUE(F::One().IsOne());
+  EXPECT_FALSE(F::Zero().IsOne());
+  EXPECT_EQ(F::Config::kOne, F(1).ToMontgomery());
+}
+
+TYPED_TEST(SmallPrimeFieldTest, Conversions) {
+  using F = TypeParam;
+
+  for (const F& f : this->GetTestValues()) {
+    EXPECT_EQ(F::FromBigInt(f.ToBigInt()), f);
+    EXPECT_EQ(F::FromMontgomery(f.ToMontgomery()), f);
+    EXPECT_EQ(F::FromMpzClass(f.ToMpzClass()), f);
+    EXPECT_EQ(F::FromDecString(f.ToString()), f);
+  }
+  EXPECT_EQ(F(3).ToString(), "3");
+  EXPECT_EQ((-F::One()).ToBigInt(), F::Config::kModulus - BigInt<1>(1));
+}
+
+TYPED_TEST(SmallPrimeFieldTest, ComparisonOperator) {
+  using F = TypeParam;
+
+  F f(3);
+  F f2(4);
+  EXPECT_TRUE(f < f2);
+  EXPECT_TRUE(f <= f2);
+  EXPECT_FALSE(f > f2);
+  EXPECT_FALSE(f >= f2);
+  EXPECT_TRUE(f2 < -F::One());
+}
+
+TYPED_TEST(SmallPrimeFieldTest, Operations) {
+  using F = TypeParam;
+
+  mpz_class modulus;
+  gmp::WriteLimbs(F::Config::kModulus.limbs, 1, &modulus);
+  auto mod = [&modulus](const mpz_class& v) {
+    mpz_class ret = v % modulus;
+    if (ret < 0) ret += modulus;
+    return ret;
+  };
+
+  std::vector<F> values = this->GetTestValues();
+  for (const F& a : values) {
+    mpz_class a_mpz = a.ToMpzClass();
+    EXPECT_EQ((-a).ToMpzClass(), mod(-a_mpz));
+    EXPECT_EQ(a.Double().ToMpzClass(), mod(a_mpz * 2));
+    EXPECT_EQ(a.Square().ToMpzClass(), mod(a_mpz * a_mpz));
+    if (!a.IsZero()) {
+      EXPECT_TRUE((a * a.Inverse()).IsOne());
+    }
+    for (const F& b : values) {
+      mpz_class b_mpz = b.ToMpzClass();
+      EXPECT_EQ((a + b).ToMpzClass(), mod(a_mpz + b_mpz));
+      EXPECT_EQ((a - b).ToMpzClass(), mod(a_mpz - b_mpz));
+      EXPECT_EQ((a * b).ToMpzClass(), mod(a_mpz * b_mpz));
+    }
+  }
+}
+
+TYPED_TEST(SmallPrimeFieldTest, Copyable) {
+  using F = TypeParam;
+
+  const F expected = F::Random();
+
+  base::Uint8VectorBuffer write_buf;
+  ASSERT_TRUE(write_buf.Grow(base::EstimateSize(expected)));
+  ASSERT_TRUE(write_buf.Write(expected));
+  ASSERT_TRUE(write_buf.Done());
+
+  write_buf.set_buffer_offset(0);
+
+  F value;
+  ASSERT_TRUE(write_buf.Read(&value));
+  EXPECT_EQ(expected, value);
+}
+
+TEST(BabyBearTest, RootOfUnity) {
+  BabyBear::Init();
+  constexpr uint32_t kTwoAdicity = 27;
+  static_assert(BabyBear::Config::kTwoAdicity == kTwoAdicity);
+
+  BabyBear omega;
+  ASSERT_TRUE(BabyBear::GetRootOfUnity(uint64_t{1} << kTwoAdicity, &omega));
+  EXPECT_TRUE(omega.Pow(uint64_t{1} << kTwoAdicity).IsOne());
+  EXPECT_FALSE(omega.Pow(uint64_t{1} << (kTwoAdicity - 1)).IsOne());
+}
+
+}  // namespace tachyon::math
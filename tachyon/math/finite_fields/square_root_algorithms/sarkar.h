@@ -0,0 +1,137 @@
+#ifndef TACHYON_MATH_FINITE_FIELDS_SQUARE_ROOT_ALGORITHMS_SARKAR_H_
+#define TACHYON_MATH_FINITE_FIELDS_SQUARE_ROOT_ALGORITHMS_SARKAR_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <utility>
+
+namespace tachyon::math {
+namespace internal {
+
+// Returns the table element g^(-|index| * 2ᵖ), where p is the position of the
+// |window|-th window. See square_root_table.h for the layout of the table.
+template <typename F>
+constexpr F GetSquareRootTableElement(uint32_t window, uint64_t index) {
+  using Config = typename F::Config;
+  return F::FromMontgomery(
+      Config::kSquareRootTable[(window << Config::kSquareRootWindowBits) +
+                               index]);
+}
+
+// Finds i such that ξⁱ = |root| with a binary search, where ξ is the
+// 2ʷ-th root of unity used in the generation of the table. Returns false if
+// |root| is not a power of ξ.
+template <typename F>
+constexpr bool ComputeSquareRootDlog(const F& root, uint64_t* dlog) {
+  using Config = typename F::Config;
+  uint64_t key = root.ToBigInt()[0];
+  size_t lo = 0;
+  size_t hi = size_t{1} << Config::kSquareRootWindowBits;
+  while (lo < hi) {
+    size_t mid = (lo + hi) / 2;
+    if (Config::kSquareRootDlogKeys[mid] < key) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
+    }
+  }
+  if (lo == (size_t{1} << Config::kSquareRootWindowBits) ||
+      Config::kSquareRootDlogKeys[lo] != key) {
+    return false;
+  }
+  *dlog = Config::kSquareRootDlogIndices[lo];
+  return true;
+}
+
+}  // namespace internal
+
+template <typename F>
+constexpr bool ComputeSarkarSquareRoot(const F& a, F* ret) {
+  // Finds x such that x² = a with the precomputed tables.
+  // Here, modulus M is 2ˢ * T + 1 and g is a 2ˢ-th root of unity.
+  // https://eprint.iacr.org/2020/1407.pdf (algorithm 1)
+  //
+  // Let v = aᵀ, which is a 2ˢ-th root of unity, so that v = gᵉ for some e.
+  // Then a is a quadratic residue if and only if e is even, and
+  //   (a^((T + 1) / 2) * g^(-e / 2))² = aᵀ⁺¹ * g⁻ᵉ = a.
+  // e is split into windows of w bits, where the lowest window has w₀ bits,
+  // and each window is found with a lookup into the discrete logarithm table
+  // of ξ = g^(2ˢ⁻ʷ), walking from the lowest window to the highest.
+  using Config = typename F::Config;
+  constexpr uint32_t kWindowBits = Config::kSquareRootWindowBits;
+  constexpr uint32_t kWindowNums = Config::kSquareRootWindowNums;
+  constexpr uint32_t kLowestWindowBits =
+      Config::kTwoAdicity - kWindowBits * (kWindowNums - 1);
+  constexpr uint64_t kWindowMask = (uint64_t{1} << kWindowBits) - 1;
+  static_assert(kWindowNums >= 2);
+
+  if (a.IsZero()) {
+    *ret = F::Zero();
+    return true;
+  }
+
+  // x = a^((T - 1) / 2)
+  F x = a.Pow(Config::kTraceMinusOneDivTwo);
+  // r = a^((T + 1) / 2)
+  F r = x * a;
+  // v = aᵀ
+  F v = r * x;
+
+  // |powers[k]| = v^(2^(w * (m - 1 - k))), where m is the number of windows.
+  // Once the windows of e below the k-th one are cleared from |powers[k]|, it
+  // becomes ξ^(eₖ), where eₖ is the k-th window of e.
+  F powers[kWindowNums];
+  powers[kWindowNums - 1] = std::move(v);
+  for (size_t k = kWindowNums - 1; k > 0; --k) {
+    powers[k - 1] = powers[k];
+    for (uint32_t i = 0; i < kWindowBits; ++i) {
+      powers[k - 1].SquareInPlace();
+    }
+  }
+
+  // |powers[0]| = ξ^(e₀ * 2^(w - w₀))
+  uint64_t digits[kWindowNums];
+  if (!internal::ComputeSquareRootDlog(powers[0], &digits[0])) return false;
+  digits[0] >>= kWindowBits - kLowestWindowBits;
+  for (uint32_t k = 1; k < kWindowNums; ++k) {
+    // Clears the windows below the k-th one: eⱼ * 2ᵖ⁽ʲ⁾ * 2^(w * (m - 1 - k))
+    // is a multiple of 2ᵖ⁽ᵐ⁻¹⁻ᵏ⁺ʲ⁾ for j ≥ 1, where p(j) is the position of the
+    // j-th window.
+    F t = std::move(powers[k]);
+    if (k == kWindowNums - 1) {
+      t *= internal::GetSquareRootTableElement<F>(0, digits[0]);
+    } else {
+      t *= internal::GetSquareRootTableElement<F>(
+          kWindowNums - 1 - k, digits[0] << (kWindowBits - kLowestWindowBits));
+    }
+    for (uint32_t j = 1; j < k; ++j) {
+      t *= internal::GetSquareRootTableElement<F>(kWindowNums - 1 - k + j,
+                                                  digits[j]);
+    }
+    if (!internal::ComputeSquareRootDlog(t, &digits[k])) return false;
+  }
+
+  uint64_t e = digits[0];
+  for (uint32_t k = 1; k < kWindowNums; ++k) {
+    e |= digits[k] << (kLowestWindowBits + kWindowBits * (k - 1));
+  }
+  // a is a quadratic non-residue.
+  if (e & 1) return false;
+  e >>= 1;
+
+  // x = r * g^(-e / 2)
+  x = std::move(r);
+  x *= internal::GetSquareRootTableElement<F>(
+      0, e & ((uint64_t{1} << kLowestWindowBits) - 1));
+  for (uint32_t k = 1; k < kWindowNums; ++k) {
+    x *= internal::GetSquareRootTableElement<F>(
+        k, (e >> (kLowestWindowBits + kWindowBits * (k - 1))) & kWindowMask);
+  }
+  *ret = std::move(x);
+  return true;
+}
+
+}  // namespace tachyon::math
+
+#endif  // TACHYON_MATH_FINITE_FIELDS_SQUARE_ROOT_ALGORITHMS_SARKAR_H_
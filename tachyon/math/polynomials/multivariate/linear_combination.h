@@ -107,16 +107,21 @@ class LinearCombination {
   // not owned
   absl::node_hash_map<const MLE*, size_t> lookup_table_;
 
+  // The products of the terms are accumulated by F::SumOfProductsSerial(),
+  // which reduces them lazily if F supports it.
   static F EvaluateSerial(
       const Point& point,
       const std::vector<std::shared_ptr<MLE>>& flattened_ml_evaluations,
       absl::Span<const LinearCombinationTerm<F>> terms) {
-    return std::accumulate(terms.begin(), terms.end(), F::Zero(),
-                           [&point, &flattened_ml_evaluations](
-                               F& acc, const LinearCombinationTerm<F>& term) {
-                             return acc += term.Evaluate(
-                                        point, flattened_ml_evaluations);
-                           });
+    std::vector<F> coefficients = base::Map(
+        terms,
+        [](const LinearCombinationTerm<F>& term) { return term.coefficient; });
+    std::vector<F> products = base::Map(
+        terms, [&point, &flattened_ml_evaluations](
+                   const LinearCombinationTerm<F>& term) {
+          return term.EvaluateProduct(point, flattened_ml_evaluations);
+        });
+    return F::SumOfProductsSerial(coefficients, products);
   }
 };
 
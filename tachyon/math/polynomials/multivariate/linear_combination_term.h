@@ -23,17 +23,24 @@ struct LinearCombinationTerm {
   F Evaluate(
       const Container& point,
       const std::vector<std::shared_ptr<MLE>>& flattened_ml_evaluations) const {
+    return coefficient * EvaluateProduct(point, flattened_ml_evaluations);
+  }
+
+  // Evaluates the product of the evaluations without |coefficient|.
+  template <typename Container, typename MLE>
+  F EvaluateProduct(
+      const Container& point,
+      const std::vector<std::shared_ptr<MLE>>& flattened_ml_evaluations) const {
 #if defined(TACHYON_HAS_OPENMP)
     std::vector<F> results = base::ParallelizeMap(
         indexes,
         [&flattened_ml_evaluations, &point](absl::Span<const size_t> chunk) {
           return EvaluateSerial(point, flattened_ml_evaluations, chunk);
         });
-    return coefficient * std::accumulate(results.begin(), results.end(),
-                                         F::One(), std::multiplies<>());
+    return std::accumulate(results.begin(), results.end(), F::One(),
+                           std::multiplies<>());
 #else
-    return coefficient *
-           EvaluateSerial(point, flattened_ml_evaluations, indexes);
+    return EvaluateSerial(point, flattened_ml_evaluations, indexes);
 #endif
   }
 
@@ -347,11 +347,12 @@ class MultivariateSparseCoefficients {
   }
 
   static F EvaluateSerial(absl::Span<const Term> terms, const Point& points) {
-    return std::accumulate(
-        terms.begin(), terms.end(), F::Zero(),
-        [&points](F& acc, const Term& term) {
-          return acc += (term.coefficient * term.literal.Evaluate(points));
-        });
+    std::vector<F> coefficients =
+        base::Map(terms, [](const Term& term) { return term.coefficient; });
+    std::vector<F> literals = base::Map(terms, [&points](const Term& term) {
+      return term.literal.Evaluate(points);
+    });
+    return F::SumOfProductsSerial(coefficients, literals);
   }
 
   size_t num_vars_;
@@ -190,13 +190,18 @@ class Radix2EvaluationDomain : public UnivariateEvaluationDomain<F, MaxDegree> {
       fn = UnivariateEvaluationDomain<F, MaxDegree>::ButterflyFnOutIn;
     }
 
+    size_t start = 0;
+    if constexpr (PackedPrimeFieldTraits<F>::kIsAccelerated) {
+      start = ApplyPackedButterflies<Order>(poly_or_evals, roots, gap);
+    }
+
     // Each butterfly cluster uses 2 * |gap| positions.
     size_t chunk_size = 2 * gap;
     OPENMP_PARALLEL_NESTED_FOR(size_t i = 0; i < poly_or_evals.NumElements();
                                i += chunk_size) {
       // If the chunk is sufficiently big that parallelism helps,
       // we parallelize the butterfly operation within the chunk.
-      for (size_t j = 0; j < gap; ++j) {
+      for (size_t j = start; j < gap; ++j) {
         if (j < roots.size()) {
           fn(poly_or_evals.at(i + j), poly_or_evals.at(i + j + gap), roots[j]);
         }
@@ -204,6 +209,41 @@ class Radix2EvaluationDomain : public UnivariateEvaluationDomain<F, MaxDegree> {
     }
   }
 
+  // Applies the butterflies of every cluster in groups of |PackedF::kLanes|,
+  // and returns the index in a cluster where the rest of the butterflies,
+  // which are left to the caller, start.
+  template <FFTOrder Order, typename PolyOrEvals>
+  static size_t ApplyPackedButterflies(PolyOrEvals& poly_or_evals,
+                                       absl::Span<const F> roots, size_t gap) {
+    using PackedF = typename PackedPrimeFieldTraits<F>::Packed;
+
+    size_t num_packed = std::min(gap, roots.size()) / PackedF::kLanes;
+    if (num_packed == 0) return 0;
+
+    size_t chunk_size = 2 * gap;
+    OPENMP_PARALLEL_NESTED_FOR(size_t i = 0; i < poly_or_evals.NumElements();
+                               i += chunk_size) {
+      for (size_t k = 0; k < num_packed; ++k) {
+        size_t j = k * PackedF::kLanes;
+        F* lo_ptr = &poly_or_evals.at(i + j);
+        F* hi_ptr = &poly_or_evals.at(i + j + gap);
+        PackedF lo = PackedF::Load(lo_ptr);
+        PackedF hi = PackedF::Load(hi_ptr);
+        PackedF root = PackedF::Load(&roots[j]);
+        if constexpr (Order == FFTOrder::kInOut) {
+          UnivariateEvaluationDomain<F, MaxDegree>::ButterflyFnInOut(lo, hi,
+                                                                     root);
+        } else {
+          UnivariateEvaluationDomain<F, MaxDegree>::ButterflyFnOutIn(lo, hi,
+                                                                     root);
+        }
+        lo.Store(lo_ptr);
+        hi.Store(hi_ptr);
+      }
+    }
+    return num_packed * PackedF::kLanes;
+  }
+
   // clang-format off
   // Precompute |roots_vec_| and |inv_roots_vec_| for |OutInHelper()| and |InOutHelper()|.
   // Here is an example where |this->size_| equals 32.
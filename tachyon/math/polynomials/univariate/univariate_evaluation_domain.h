@@ -15,6 +15,7 @@
 #include "tachyon/base/logging.h"
 #include "tachyon/base/openmp_util.h"
 #include "tachyon/base/range.h"
+#include "tachyon/math/finite_fields/packed_prime_field.h"
 #include "tachyon/math/polynomials/evaluation_domain.h"
 #include "tachyon/math/polynomials/univariate/univariate_evaluation_domain_forwards.h"
 #include "tachyon/math/polynomials/univariate/univariate_evaluations.h"
@@ -464,6 +465,29 @@ class UnivariateEvaluationDomain : public EvaluationDomain<F, MaxDegree> {
     hi = std::move(neg);
   }
 
+  // The same as ButterflyFnInOut() above, but applied to the lanes of a
+  // packed field, e.g., PackedPrimeField, at once.
+  template <typename PackedF,
+            std::enable_if_t<std::is_same_v<typename PackedF::Field, F>>* =
+                nullptr>
+  static void ButterflyFnInOut(PackedF& lo, PackedF& hi, const PackedF& root) {
+    PackedF neg = lo - hi;
+    lo += hi;
+    hi = neg * root;
+  }
+
+  // The same as ButterflyFnOutIn() above, but applied to the lanes of a
+  // packed field, e.g., PackedPrimeField, at once.
+  template <typename PackedF,
+            std::enable_if_t<std::is_same_v<typename PackedF::Field, F>>* =
+                nullptr>
+  static void ButterflyFnOutIn(PackedF& lo, PackedF& hi, const PackedF& root) {
+    hi *= root;
+    PackedF neg = lo - hi;
+    lo += hi;
+    hi = neg;
+  }
+
   template <typename PolyOrEvals>
   constexpr static void SwapElements(PolyOrEvals& poly_or_evals, size_t size,
                                      uint32_t log_len) {
@@ -12,6 +12,7 @@
 
 #include "tachyon/base/containers/container_util.h"
 #include "tachyon/base/openmp_util.h"
+#include "tachyon/math/finite_fields/packed_prime_field.h"
 #include "tachyon/math/polynomials/univariate/univariate_evaluations.h"
 
 namespace tachyon::math {
@@ -30,8 +31,13 @@ class UnivariateEvaluationsOp {
       l_evaluations = r_evaluations;
       return self;
     }
+    size_t start = 0;
+    if constexpr (PackedPrimeFieldTraits<F>::kIsAccelerated) {
+      start = ApplyPacked(l_evaluations, r_evaluations,
+                          [](auto& l, const auto& r) { l += r; });
+    }
     // f(x) + 0 skips this for loop.
-    OPENMP_PARALLEL_FOR(size_t i = 0; i < r_evaluations.size(); ++i) {
+    OPENMP_PARALLEL_FOR(size_t i = start; i < r_evaluations.size(); ++i) {
       l_evaluations[i] += r_evaluations[i];
     }
     return self;
@@ -44,8 +50,13 @@ class UnivariateEvaluationsOp {
       // 0 - g(x)
       l_evaluations.resize(r_evaluations.size());
     }
+    size_t start = 0;
+    if constexpr (PackedPrimeFieldTraits<F>::kIsAccelerated) {
+      start = ApplyPacked(l_evaluations, r_evaluations,
+                          [](auto& l, const auto& r) { l -= r; });
+    }
     // f(x) - 0 skips this for loop.
-    OPENMP_PARALLEL_FOR(size_t i = 0; i < r_evaluations.size(); ++i) {
+    OPENMP_PARALLEL_FOR(size_t i = start; i < r_evaluations.size(); ++i) {
       l_evaluations[i] -= r_evaluations[i];
     }
     return self;
@@ -73,7 +84,12 @@ class UnivariateEvaluationsOp {
       l_evaluations.clear();
       return self;
     }
-    OPENMP_PARALLEL_FOR(size_t i = 0; i < r_evaluations.size(); ++i) {
+    size_t start = 0;
+    if constexpr (PackedPrimeFieldTraits<F>::kIsAccelerated) {
+      start = ApplyPacked(l_evaluations, r_evaluations,
+                          [](auto& l, const auto& r) { l *= r; });
+    }
+    OPENMP_PARALLEL_FOR(size_t i = start; i < r_evaluations.size(); ++i) {
       l_evaluations[i] *= r_evaluations[i];
     }
     return self;
@@ -81,7 +97,11 @@ class UnivariateEvaluationsOp {
 
   static Poly& MulInPlace(Poly& self, const F& scalar) {
     std::vector<F>& l_evaluations = self.evaluations_;
-    OPENMP_PARALLEL_FOR(size_t i = 0; i < l_evaluations.size(); ++i) {
+    size_t start = 0;
+    if constexpr (PackedPrimeFieldTraits<F>::kIsAccelerated) {
+      start = ApplyPacked(l_evaluations, scalar);
+    }
+    OPENMP_PARALLEL_FOR(size_t i = start; i < l_evaluations.size(); ++i) {
       l_evaluations[i] *= scalar;
     }
     return self;
@@ -105,11 +125,50 @@ class UnivariateEvaluationsOp {
   static Poly& DivInPlace(Poly& self, const F& scalar) {
     std::vector<F>& l_evaluations = self.evaluations_;
     F scalar_inv = scalar.Inverse();
-    OPENMP_PARALLEL_FOR(size_t i = 0; i < l_evaluations.size(); ++i) {
+    size_t start = 0;
+    if constexpr (PackedPrimeFieldTraits<F>::kIsAccelerated) {
+      start = ApplyPacked(l_evaluations, scalar_inv);
+    }
+    OPENMP_PARALLEL_FOR(size_t i = start; i < l_evaluations.size(); ++i) {
       l_evaluations[i] *= scalar_inv;
     }
     return self;
   }
+
+ private:
+  // Applies |fn| to the packed elements of |l_evaluations| and
+  // |r_evaluations|, and returns the number of elements processed. The rest,
+  // which are fewer than the lanes, are left to the caller.
+  template <typename Fn>
+  static size_t ApplyPacked(std::vector<F>& l_evaluations,
+                            const std::vector<F>& r_evaluations, Fn fn) {
+    using PackedF = typename PackedPrimeFieldTraits<F>::Packed;
+
+    size_t num_packed = r_evaluations.size() / PackedF::kLanes;
+    OPENMP_PARALLEL_FOR(size_t i = 0; i < num_packed; ++i) {
+      size_t offset = i * PackedF::kLanes;
+      PackedF l = PackedF::Load(&l_evaluations[offset]);
+      fn(l, PackedF::Load(&r_evaluations[offset]));
+      l.Store(&l_evaluations[offset]);
+    }
+    return num_packed * PackedF::kLanes;
+  }
+
+  // Multiplies the packed elements of |l_evaluations| by |scalar|, and returns
+  // the number of elements processed.
+  static size_t ApplyPacked(std::vector<F>& l_evaluations, const F& scalar) {
+    using PackedF = typename PackedPrimeFieldTraits<F>::Packed;
+
+    PackedF packed_scalar = PackedF::Broadcast(scalar);
+    size_t num_packed = l_evaluations.size() / PackedF::kLanes;
+    OPENMP_PARALLEL_FOR(size_t i = 0; i < num_packed; ++i) {
+      size_t offset = i * PackedF::kLanes;
+      PackedF l = PackedF::Load(&l_evaluations[offset]);
+      l *= packed_scalar;
+      l.Store(&l_evaluations[offset]);
+    }
+    return num_packed * PackedF::kLanes;
+  }
 };
 
 }  // namespace internal
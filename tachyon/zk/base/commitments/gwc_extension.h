@@ -12,6 +12,8 @@
 #include <utility>
 #include <vector>
 
+#include "absl/types/span.h"
+
 #include "tachyon/crypto/commitments/batch_commitment_state.h"
 #include "tachyon/crypto/commitments/kzg/gwc.h"
 #include "tachyon/zk/base/commitments/univariate_polynomial_commitment_scheme_extension.h"
@@ -124,6 +126,18 @@ class GWCExtension final
     return gwc_.DoCommitLagrange(v, state, index);
   }
 
+  [[nodiscard]] bool DoBatchCommit(absl::Span<const Poly> polys,
+                                   crypto::BatchCommitmentState& state,
+                                   size_t index) {
+    return gwc_.DoBatchCommit(polys, state, index);
+  }
+
+  [[nodiscard]] bool DoBatchCommitLagrange(absl::Span<const Evals> evals_list,
+                                           crypto::BatchCommitmentState& state,
+                                           size_t index) {
+    return gwc_.DoBatchCommitLagrange(evals_list, state, index);
+  }
+
   template <typename Container, typename Proof>
   [[nodiscard]] bool DoCreateOpeningProof(const Container& poly_openings,
                                           Proof* proof) {
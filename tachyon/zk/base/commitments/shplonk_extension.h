@@ -12,6 +12,8 @@
 #include <utility>
 #include <vector>
 
+#include "absl/types/span.h"
+
 #include "tachyon/crypto/commitments/batch_commitment_state.h"
 #include "tachyon/crypto/commitments/kzg/shplonk.h"
 #include "tachyon/zk/base/commitments/univariate_polynomial_commitment_scheme_extension.h"
@@ -125,6 +127,18 @@ class SHPlonkExtension final
     return shplonk_.DoCommitLagrange(v, state, index);
   }
 
+  [[nodiscard]] bool DoBatchCommit(absl::Span<const Poly> polys,
+                                   crypto::BatchCommitmentState& state,
+                                   size_t index) {
+    return shplonk_.DoBatchCommit(polys, state, index);
+  }
+
+  [[nodiscard]] bool DoBatchCommitLagrange(absl::Span<const Evals> evals_list,
+                                           crypto::BatchCommitmentState& state,
+                                           size_t index) {
+    return shplonk_.DoBatchCommitLagrange(evals_list, state, index);
+  }
+
   template <typename Container, typename Proof>
   [[nodiscard]] bool DoCreateOpeningProof(const Container& poly_openings,
                                           Proof* proof) {
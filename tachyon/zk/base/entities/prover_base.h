@@ -13,6 +13,8 @@
 #include <utility>
 #include <vector>
 
+#include "absl/types/span.h"
+
 #include "tachyon/base/logging.h"
 #include "tachyon/crypto/commitments/vector_commitment_scheme_traits_forward.h"
 #include "tachyon/zk/base/blinded_polynomial.h"
@@ -112,6 +114,14 @@ class ProverBase : public Entity<PCS> {
     CHECK(this->pcs_.CommitLagrange(evals, index));
   }
 
+  // Commits to each of |evals_list| and stores the commitments from |index|.
+  template <typename T = PCS,
+            std::enable_if_t<crypto::VectorCommitmentSchemeTraits<
+                T>::kSupportsBatchMode>* = nullptr>
+  void BatchCommitAllAt(absl::Span<const Evals> evals_list, size_t index) {
+    CHECK(this->pcs_.BatchCommitLagrange(evals_list, index));
+  }
+
   void CommitAndWriteToTranscript(const Evals& evals) {
     Commitment commitment = Commit(evals);
     CHECK(GetWriter()->WriteToTranscript(commitment));
@@ -67,6 +67,10 @@ class Synthesizer {
         // Parse only indices related to the |current_phase|.
         const std::vector<Phase>& advice_phases =
             constraint_system_->advice_column_phases();
+        // In batch mode, the columns of a circuit are committed at once so
+        // that the MSMs over the shared bases are computed together.
+        std::vector<Evals> batch;
+        std::vector<size_t> batch_column_indices;
         for (size_t j = 0; j < rational_advice_columns.size(); ++j) {
           if (current_phase != advice_phases[j]) continue;
           const RationalEvals& column = rational_advice_columns[j];
@@ -78,12 +82,21 @@ class Synthesizer {
 
           Evals evaluated_evals(std::move(evaluated));
           if constexpr (PCS::kSupportsBatchMode) {
-            prover->BatchCommitAt(evaluated_evals, write_idx++);
+            batch.push_back(std::move(evaluated_evals));
+            batch_column_indices.push_back(j);
           } else {
             prover->CommitAndWriteToProof(evaluated_evals);
+            SetAdviceColumn(i, j, std::move(evaluated_evals),
+                            prover->blinder().Generate());
+          }
+        }
+        if constexpr (PCS::kSupportsBatchMode) {
+          prover->BatchCommitAllAt(batch, write_idx);
+          write_idx += batch.size();
+          for (size_t k = 0; k < batch.size(); ++k) {
+            SetAdviceColumn(i, batch_column_indices[k], std::move(batch[k]),
+                            prover->blinder().Generate());
           }
-          SetAdviceColumn(i, j, std::move(evaluated_evals),
-                          prover->blinder().Generate());
         }
       }
       if constexpr (PCS::kSupportsBatchMode) {